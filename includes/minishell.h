@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:39:03 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/16 17:48:52 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 04:58:55 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,8 +16,10 @@
 /* =========================== */
 /*          INCLUDES           */
 /* =========================== */
+# define _GNU_SOURCE
 # include "libft.h"
 # include <signal.h>
+# include <ctype.h>
 # include <sys/ioctl.h>
 # include <stdio.h>
 # include <stdlib.h>
@@ -28,12 +30,22 @@
 # include <readline/history.h>
 # include <sys/wait.h>
 # include <fcntl.h>
+# include <dirent.h>
+# include <sys/stat.h>
+# include <sys/uio.h>
+# include <sys/sendfile.h>
+# include <poll.h>
+# include <time.h>
+# include <termios.h>
+# include <pthread.h>
+# include <stdatomic.h>
 
 /* =========================== */
 /*       GLOBAL VARIABLE       */
 /* =========================== */
 
 extern volatile sig_atomic_t		g_signal_received;
+extern const unsigned short			g_char_class[256];
 
 /* =========================== */
 /*         CONSTANTS           */
@@ -41,6 +53,16 @@ extern volatile sig_atomic_t		g_signal_received;
 
 /* minishell prompt */
 # define SHELL_PROMPT "[mini$HELL] "
+# define CONTINUATION_PROMPT "> "
+
+/* value of $0 */
+# define SHELL_NAME "minishell"
+
+/* one-character parameters following '$': status and positional ones */
+# define SPECIAL_PARAMS "?#@0123456789"
+
+/* bytes introducing a parameter name: `$name`, `${name}`, `${#name}` */
+# define PARAM_INTRO "${#"
 
 /* easter egg */
 # define EASTER_EGG "101010"
@@ -54,9 +76,56 @@ extern volatile sig_atomic_t		g_signal_received;
 # define ERR_NOT_VALID_ID "': not a valid identifier"
 # define ERR_NUMERIC_ARG ": numeric argument required"
 # define ERR_TOO_MANY_ARGS "too many arguments"
+# define ERR_OPTION_ARG ": option requires an argument"
 # define ERR_SYNTAX "syntax error near unexpected token `"
+# define ERR_SYNTAX_EOF "syntax error: unexpected end of file"
+# define ERR_BREAK "break: "
+# define ERR_CONTINUE "continue: "
+# define ERR_LOOP_ONLY "only meaningful in a `for', `while', or `until' loop"
+# define ERR_LOOP_RANGE ": loop count out of range"
+# define ERR_RETURN "return: "
+# define ERR_RETURN_ONLY "can only `return' from a function"
 # define ERR_CMD_NOT_FOUND ": command not found"
 # define ERR_NO_SUCH_FILE ": No such file or directory"
+# define ERR_ARITH_SYNTAX ": syntax error in expression"
+# define ERR_ARITH_DIV ": division by 0"
+# define ERR_ARITH_BASE ": value too great for base"
+# define ERR_ARITH_DEPTH ": expression recursion level exceeded"
+# define ERR_WRITE ": write error: "
+# define ERR_AMBIGUOUS_REDIR ": ambiguous redirect"
+# define ERR_BAD_FD ": Bad file descriptor"
+# define ERR_CAT "cat: "
+# define ERR_CAT_SAME ": input file is output file"
+# define ERR_TEST_INT ": integer expression expected"
+# define ERR_TEST_UNARY ": unary operator expected"
+# define ERR_TEST_BINARY ": binary operator expected"
+# define ERR_TEST_BRACKET "missing `]'"
+# define ERR_TEST_PAREN "`)' expected"
+# define ERR_TEST_ARG "argument expected"
+# define ERR_PRINTF "printf: "
+# define ERR_PRINTF_USAGE "usage: printf format [arguments]"
+# define ERR_PRINTF_CONV "': invalid format character"
+# define ERR_PRINTF_MISSING "`%': missing format character"
+# define ERR_PRINTF_NUM ": invalid number"
+# define ERR_PRINTF_RANGE ": Numerical result out of range"
+# define ERR_READ "read: "
+# define ERR_READ_USAGE "usage: read [-r] [-d c] [-n num] [-t sec] [name ...]"
+# define ERR_READ_OPT ": invalid option"
+# define ERR_READ_TIMEOUT ": invalid timeout specification"
+# define ERR_READ_NUM ": invalid number"
+# define ERR_READ_FAIL "read error: "
+# define ERR_SLEEP "sleep: "
+# define ERR_SLEEP_MISSING "missing operand"
+# define ERR_SLEEP_TIME "invalid time interval '"
+# define ERR_KILL "kill: "
+# define ERR_KILL_USAGE "usage: kill [-s sig | -n num | -sig] pid | jobspec ..."
+# define ERR_KILL_SIG ": invalid signal specification"
+# define ERR_KILL_ARG ": arguments must be process or job IDs"
+# define ERR_KILL_JOB ": no such job"
+# define ERR_BAD_SUBST ": bad substitution"
+# define ERR_PARAM_UNSET "parameter null or not set"
+# define ERR_PARAM_ASSIGN ": cannot assign in this way"
+# define ERR_SUBSTR_NEG ": substring expression < 0"
 # define ERR_HEREDOC_EOF "warning: here-document delimited by end-of-file\n"
 
 /* standardized return codes - EXIT_SUCCES 0 - EXIT_FAILURE 1 */
@@ -69,6 +138,92 @@ extern volatile sig_atomic_t		g_signal_received;
 # define EXIT_SIGINT  130
 # define EXIT_SIGQUIT 131
 
+/* heredoc storage: unlinked temporary files, rewindable for loops */
+# define HEREDOC_PATH "/tmp/.minishell_heredoc_"
+# define HEREDOC_MAX_TRIES 1000
+
+/* pipelines: variable holding the pipe capacity, and its system limit */
+# define PIPE_SIZE_VAR "MINISHELL_PIPE_SIZE"
+# define PIPE_MAX_SIZE_PATH "/proc/sys/fs/pipe-max-size"
+
+/* cat builtin: read()/write() buffer, bytes asked per kernel copy call */
+# define CAT_BUF_SIZE 131072
+# define CAT_COPY_MAX 1073741824
+
+/* test builtin: letters of the unary operators (-e, -f, ...) */
+# define TEST_UNARY_OPS "bcdefghknprstuwxzLS"
+
+/* printf builtin: characters %q leaves unquoted, length modifiers skipped */
+# define PRINTF_QUOTE_SAFE "_./,:=@%+-"
+# define PRINTF_LENGTH_MODS "hlLjzt"
+
+/* read builtin: read() size on regular files, defaults, timeout status */
+# define READ_BUF_SIZE 4096
+# define READ_DEFAULT_VAR "REPLY"
+# define READ_DEFAULT_IFS " \t\n"
+# define READ_TIMEOUT_STATUS 142
+
+/* sleep builtin: longest total interval, in seconds (about 100 years) */
+# define SLEEP_MAX_SECONDS 3155760000LL
+
+/* optimizer: variables for its report and to turn it off, file name chars */
+# define OPT_DEBUG_VAR "MINISHELL_OPT_DEBUG"
+# define OPT_DISABLE_VAR "MINISHELL_NO_OPTIMIZE"
+# define OPT_PLAIN_CHARS "/._-+,@%:="
+
+/* arithmetic: nesting limit for variables holding expressions */
+# define ARITH_MAX_DEPTH 1024
+
+/* growable string buffer: first allocation size */
+# define STRBUF_MIN_CAP 64
+
+/* builtin output: buffered per standard fd, flushed at builtin exit */
+# define OUT_BUF_SIZE 8192
+# define OUT_FDS 3
+
+/* descriptors owned by the shell: at most the default RLIMIT_NOFILE */
+# define FD_REGISTRY_SIZE 1024
+
+/* redirections: fds scripts can name (0-9); the shell's own fds live above */
+# define REDIR_FD_MAX 10
+# define SHELL_FD_MIN 10
+# define FD_WAS_CLOSED -2
+
+/* command substitution: minimum free space for each read() of the output */
+# define SUBST_READ_SIZE 65536
+
+/* globbing: characters escaped in patterns when quoted or expanded */
+# define GLOB_SPECIAL "\\*?["
+
+/* globbing: first size of the directory cache hash table (power of two) */
+# define DIR_CACHE_MIN_SIZE 64
+
+/* recursive globbing: worker threads, open directory fds, getdents64 size */
+# define GLOB_MAX_THREADS 8
+# define GLOB_MAX_OPEN_FDS 256
+# define GLOB_DENTS_SIZE 65536
+
+/* shell functions: number of hash table buckets (power of two) */
+# define FUNC_TABLE_SIZE 64
+
+/* character classes of g_char_class (src/utils/char_class.c), as bits */
+# define CC_NUL 0x001
+# define CC_SPACE 0x002
+# define CC_BLANK 0x004
+# define CC_SEP 0x008
+# define CC_OP 0x010
+# define CC_SQUOTE 0x020
+# define CC_DQUOTE 0x040
+# define CC_QUOTE 0x060
+# define CC_DOLLAR 0x080
+# define CC_VAR_START 0x100
+# define CC_VAR_CHAR 0x200
+# define CC_NAME 0x300
+# define CC_GLOB 0x400
+
+/* run scanning: bytes tested one at a time before the vector kernels */
+# define SCAN_SCALAR_BYTES 16
+
 /* =========================== */
 /*           ENUMS             */
 /* =========================== */
@@ -90,6 +245,63 @@ typedef enum e_token_error
 	TOKEN_NOT_OPERATOR
 }	t_token_error;
 
+/* how the cat builtin moves bytes from one fd to another */
+typedef enum e_copy
+{
+	COPY_RANGE,
+	COPY_SPLICE,
+	COPY_SENDFILE,
+	COPY_BUFFER
+}	t_copy;
+
+/* test builtin: operands still to evaluate, and whether one was invalid */
+typedef struct s_test
+{
+	const char	*name;
+	char		**argv;
+	int			argc;
+	int			pos;
+	bool		error;
+}	t_test;
+
+/* kill builtin: name of a signal, without its SIG prefix */
+typedef struct s_signame
+{
+	const char	*name;
+	int			num;
+}	t_signame;
+
+/* printf builtin: one `%` conversion of the format */
+typedef struct s_printf_spec
+{
+	bool	minus;
+	bool	plus;
+	bool	space;
+	bool	hash;
+	bool	zero;
+	int		width;
+	int		precision;
+	char	conv;
+}	t_printf_spec;
+
+/* printf builtin: a formatted field, written as prefix, zeros then text */
+typedef struct s_field
+{
+	const char	*prefix;
+	size_t		zeros;
+	const char	*text;
+	size_t		len;
+}	t_field;
+
+/* printf builtin: arguments left to format, and how the command ends */
+typedef struct s_printf
+{
+	char	**args;
+	bool	used;
+	bool	stop;
+	int		status;
+}	t_printf;
+
 /* detects operation: assign append or key only mode, used in export builtin */
 typedef enum e_export_op
 {
@@ -111,7 +323,16 @@ typedef enum t_node_type
 	NODE_NONE,
 	NODE_CMD,
 	NODE_PIPE,
-	NODE_REDIR
+	NODE_REDIR,
+	NODE_LIST,
+	NODE_WHILE,
+	NODE_UNTIL,
+	NODE_FOR,
+	NODE_GROUP,
+	NODE_FUNCTION,
+	NODE_ARITH,
+	NODE_CASE,
+	NODE_CASE_ITEM
 }	t_node_type;
 
 /* identifies operator types: pipe and redirection operators */
@@ -122,34 +343,342 @@ typedef enum e_operator_type
 	OP_INPUT,
 	OP_OUTPUT,
 	OP_APPEND,
-	OP_HEREDOC
+	OP_HEREDOC,
+	OP_DUP_IN,
+	OP_DUP_OUT,
+	OP_SEMI,
+	OP_LPAREN,
+	OP_RPAREN,
+	OP_DSEMI
 }	t_operator_type;
 
+/* arithmetic operators, also used by compound assignments such as += */
+typedef enum e_arith_op
+{
+	ARITH_NONE,
+	ARITH_OR,
+	ARITH_AND,
+	ARITH_BOR,
+	ARITH_XOR,
+	ARITH_BAND,
+	ARITH_EQ,
+	ARITH_NE,
+	ARITH_LT,
+	ARITH_LE,
+	ARITH_GT,
+	ARITH_GE,
+	ARITH_SHL,
+	ARITH_SHR,
+	ARITH_ADD,
+	ARITH_SUB,
+	ARITH_MUL,
+	ARITH_DIV,
+	ARITH_MOD,
+	ARITH_POW
+}	t_arith_op;
+
+/* parser outcome, lets the reader ask for more lines on open compounds */
+typedef enum e_parse_status
+{
+	PARSE_OK,
+	PARSE_SYNTAX_ERROR,
+	PARSE_INCOMPLETE,
+	PARSE_MALLOC_ERROR
+}	t_parse_status;
+
 /* =========================== */
 /*        STRUCTURES           */
 /* =========================== */
 
-/* env import structure to emulate KEY=VALUE behavior */
+/*
+ * environment variable, stored as one "KEY=value" string (`entry`) that
+ * is passed to execve() as is. The key is the first `key_len` bytes of
+ * the entry; `value` points after the '=', or is NULL for a variable
+ * declared without a value (entry "KEY"). `num` caches the value parsed
+ * as an integer by arithmetic, valid while `num_valid` is set: every
+ * write to the entry must clear it.
+ */
 typedef struct s_env
 {
-	char	*key;
-	char	*value;
-	bool	in_env;
+	char		*entry;
+	size_t		key_len;
+	char		*value;
+	bool		in_env;
+	bool		num_valid;
+	long long	num;
 }	t_env;
 
-/* shell state and configuration */
 typedef struct s_ast				t_ast;
+typedef struct s_dirlist			t_dirlist;
 
+/* shell function: name and private copy of its parsed body, hash chained */
+typedef struct s_func
+{
+	char			*name;
+	t_ast			*body;
+	struct s_func	*next;
+}	t_func;
+
+/* directory listings cached for one input line, hash chained by path */
+typedef struct s_dircache
+{
+	t_dirlist	**buckets;
+	size_t		size;
+	size_t		count;
+}	t_dircache;
+
+/* shell state and configuration */
 typedef struct s_shell
 {
-	t_list	*env_list;
-	int		status;
-	bool	is_tty;
-	bool	is_child;
-	bool	should_exit;
-	t_ast	*curr_ast;
+	t_list		*env_list;
+	int			status;
+	bool		is_tty;
+	bool		is_child;
+	bool		should_exit;
+	int			loop_depth;
+	int			break_count;
+	int			continue_count;
+	t_ast		*curr_ast;
+	t_func		*functions[FUNC_TABLE_SIZE];
+	t_list		*retired_bodies;
+	int			func_depth;
+	bool		returning;
+	bool		aborting;
+	bool		can_exec;
+	char		**pos_params;
+	t_dircache	dir_cache;
 }	t_shell;
 
+/* binary operator of the arithmetic evaluator: spelling and precedence */
+typedef struct s_arith_binop
+{
+	const char	*str;
+	size_t		len;
+	t_arith_op	op;
+	int			prec;
+}	t_arith_binop;
+
+/* arithmetic evaluator cursor over one expression */
+typedef struct s_arith
+{
+	const char	*expr;
+	size_t		pos;
+	t_shell		*data;
+	int			noeval;
+	int			depth;
+	bool		error;
+}	t_arith;
+
+/* growable string buffer, doubled when full */
+typedef struct s_strbuf
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+}	t_strbuf;
+
+/*
+ * read builtin: options, field separators, and the line read so far with a
+ * mask marking the bytes escaped by a backslash, which never separate fields
+ */
+typedef struct s_read
+{
+	int			fd;
+	char		delim;
+	bool		raw;
+	bool		escape;
+	long		nchars;
+	long long	deadline;
+	const char	*ifs;
+	t_strbuf	line;
+	t_strbuf	quoted;
+}	t_read;
+
+/*
+ * parameter expansion `${name op word}`: the text between the braces, with
+ * the operator and its operand pointing into it, and the value of the
+ * parameter (NULL when it is unset)
+ */
+typedef struct s_param
+{
+	char		*text;
+	char		*name;
+	char		*value;
+	char		*op;
+	char		*word;
+	bool		colon;
+	bool		twice;
+	t_strbuf	*buf;
+	t_shell		*data;
+}	t_param;
+
+/*
+ * output buffer of a standard fd. `capture` diverts the flushed bytes to a
+ * command substitution; `failed`/`err` keep the first write error until
+ * out_flush() reports it.
+ */
+typedef struct s_outbuf
+{
+	char		data[OUT_BUF_SIZE];
+	size_t		len;
+	t_strbuf	*capture;
+	bool		failed;
+	int			err;
+}	t_outbuf;
+
+/*
+ * descriptors created by the shell (heredoc stores, pipes, saved standard
+ * fds), all close-on-exec, in no particular order
+ */
+typedef struct s_fd_registry
+{
+	int		fds[FD_REGISTRY_SIZE];
+	size_t	count;
+}	t_fd_registry;
+
+/* growable NULL-terminable array of strings */
+typedef struct s_strvec
+{
+	char	**items;
+	size_t	len;
+	size_t	cap;
+}	t_strvec;
+
+/* bottom-up merge sort state: one pass merges runs from src into dst */
+typedef struct s_merge
+{
+	char	**src;
+	char	**dst;
+	size_t	n;
+	int		(*cmp)(const char *, const char *);
+}	t_merge;
+
+/* glob pattern element: one literal char, '?', a bracket set or '*' */
+typedef enum e_pat_kind
+{
+	PAT_CHAR,
+	PAT_ANY,
+	PAT_SET,
+	PAT_STAR
+}	t_pat_kind;
+
+/*
+ * shape of a compiled pattern: a literal, `*`, `abc*`, `*abc` and `*abc*`
+ * are matched directly, any other pattern by backtracking on its elements
+ */
+typedef enum e_pat_shape
+{
+	SHAPE_LITERAL,
+	SHAPE_ANY,
+	SHAPE_PREFIX,
+	SHAPE_SUFFIX,
+	SHAPE_INFIX,
+	SHAPE_GENERAL
+}	t_pat_shape;
+
+typedef struct s_pat_elem
+{
+	t_pat_kind		kind;
+	unsigned char	c;
+	unsigned char	set[32];
+}	t_pat_elem;
+
+/*
+ * pattern matcher cursor: element, string position, element following
+ * the last star (0: no star yet) and where that star's match ends
+ */
+typedef struct s_match_pos
+{
+	size_t	pi;
+	size_t	si;
+	size_t	star;
+	size_t	mark;
+}	t_match_pos;
+
+/*
+ * compiled glob pattern, shared by pathname expansion (one per path
+ * component) and `case`. `literal` is the pattern without escapes when
+ * it has no wildcard (`magic`), else the fixed text of a prefix, suffix
+ * or infix shape. `globstar` marks a `**` component.
+ */
+typedef struct s_pattern
+{
+	t_pat_elem	*elems;
+	size_t		count;
+	bool		magic;
+	bool		globstar;
+	t_pat_shape	shape;
+	char		*literal;
+	size_t		fixed_len;
+}	t_pattern;
+
+/*
+ * cached listing of a directory, valid for one input line while the
+ * directory keeps its device, inode and mtime. Each entry is the d_type
+ * byte followed by the name, and entries are sorted by name. `tree` is
+ * set when the whole subtree was listed by the recursive walker.
+ */
+typedef struct s_dirlist
+{
+	char				*path;
+	size_t				hash;
+	dev_t				dev;
+	ino_t				ino;
+	struct timespec		mtime;
+	time_t				listed_at;
+	bool				tree;
+	t_strvec			entries;
+	struct s_dirlist	*next;
+}	t_dirlist;
+
+/* pathname expansion of one word: compiled components and current path */
+typedef struct s_glob
+{
+	t_shell		*data;
+	t_pattern	*comps;
+	size_t		ncomps;
+	t_strbuf	path;
+	t_strvec	matches;
+}	t_glob;
+
+/* directory waiting to be listed by the recursive walker (fd -1: closed) */
+typedef struct s_walk_task
+{
+	char	*path;
+	int		fd;
+}	t_walk_task;
+
+/* work-stealing deque: its owner works at the tail, thieves at the head */
+typedef struct s_walk_deque
+{
+	pthread_mutex_t	lock;
+	t_walk_task		*tasks;
+	size_t			head;
+	size_t			len;
+	size_t			cap;
+}	t_walk_deque;
+
+/*
+ * recursive walker: one deque and one result list per worker, the count
+ * of directories queued or being listed and the count of open fds
+ */
+typedef struct s_walk_pool
+{
+	t_walk_deque	deques[GLOB_MAX_THREADS];
+	t_dirlist		*results[GLOB_MAX_THREADS];
+	size_t			nworkers;
+	atomic_size_t	pending;
+	atomic_int		open_fds;
+}	t_walk_pool;
+
+/* worker of the recursive walker, with its getdents64() buffer */
+typedef struct s_walker
+{
+	t_walk_pool	*pool;
+	size_t		id;
+	char		*dents;
+}	t_walker;
+
 /* for builtin functions array, stores cmd and function's pointer*/
 typedef struct s_builtin
 {
@@ -157,29 +686,53 @@ typedef struct s_builtin
 	int		(*f)(char **tokens, t_shell *data);
 }	t_builtin;
 
-/* lexer token structure: represents a token with its type and metadata */
+/*
+ * lexer token structure: represents a token with its type and metadata.
+ * The `<<` token of a line read by parse_line() owns the store holding
+ * its here-document body (`heredoc_fd`, -1 otherwise).
+ */
 typedef struct s_token
 {
 	char			*value;
 	t_token_type	type;
 	t_operator_type	op_type;
+	int				heredoc_fd;
 	struct s_token	*next;
 }	t_token;
 
-/* AST node structure: represents a node in the abstract syntax tree */
+/*
+ * AST node structure: represents a node in the abstract syntax tree.
+ * `words` keeps the raw (unexpanded) arguments of a command so the node can
+ * be executed many times; `argv` is rebuilt from them on every execution.
+ * Compound commands (loops) use left/right for condition and body and keep
+ * their own trailing redirections in `redirs`. A pipe whose left side is a
+ * plain `cat FILE` keeps FILE in `filename`, and a command made only of
+ * redirections is marked `in_shell` (see optimize_ast()).
+ */
 typedef struct s_ast
 {
 	t_node_type		type;
 	t_operator_type	op_type;
 	char			*value;
+	char			**words;
 	char			**argv;
 	char			*filename;
 	int				heredoc_fd;
 	struct s_ast	*left;
 	struct s_ast	*right;
 	struct s_ast	*next;
+	struct s_ast	*redirs;
+	t_pattern		*patterns;
+	bool			in_shell;
 }	t_ast;
 
+/* recursive descent parser cursor over the typed token list */
+typedef struct s_parser
+{
+	t_token			*curr;
+	t_parse_status	status;
+}	t_parser;
+
 /* =========================== */
 /*          BUILTINS           */
 /* =========================== */
@@ -189,9 +742,78 @@ void		update_env_var_value(t_list **env_list, const char *key,
 				const char *value);
 void		update_pwd_from_target(t_shell *data);
 
+/* src/builtins/loop_control.c */
+int			builtin_break(char **argv, t_shell *data);
+int			builtin_continue(char **argv, t_shell *data);
+
+/* src/builtins/return.c */
+int			builtin_return(char **argv, t_shell *data);
+
+/* src/builtins/printf.c */
+int			builtin_printf(char **argv, t_shell *data);
+
+/* src/builtins/printf_conv.c */
+const char	*printf_next_arg(t_printf *st);
+size_t		printf_conversion(const char *fmt, t_printf *st);
+
+/* src/builtins/printf_escape.c */
+int			printf_escape(const char *s, size_t *len, bool in_arg);
+int			printf_expand_escapes(t_strbuf *buf, const char *s, bool *stop);
+
+/* src/builtins/printf_field.c */
+void		printf_field(const t_printf_spec *spec, const t_field *field);
+void		printf_text(const t_printf_spec *spec, const char *s, size_t len);
+
+/* src/builtins/printf_int.c */
+void		printf_integer(const t_printf_spec *spec, t_printf *st);
+
+/* src/builtins/printf_num.c */
+void		printf_arg_value(t_printf *st, bool is_signed,
+				unsigned long long *mag, bool *neg);
+long long	printf_arg_int(t_printf *st);
+
+/* src/builtins/printf_quote.c */
+int			printf_quote(t_strbuf *buf, const char *s);
+
+/* src/builtins/kill.c */
+int			builtin_kill(char **argv, t_shell *data);
+
+/* src/builtins/kill_list.c */
+int			kill_list(char **argv, t_shell *data);
+
+/* src/builtins/kill_signals.c */
+int			signal_number(const char *spec);
+const char	*signal_name(int num);
+void		print_signal_list(void);
+
 /* src/builtins/pwd.c */
 int			builtin_pwd(char **argv, t_shell *data);
 
+/* src/builtins/read.c */
+int			builtin_read(char **argv, t_shell *data);
+
+/* src/builtins/read_input.c */
+int			read_input(t_read *r);
+
+/* src/builtins/read_opts.c */
+int			read_options(t_read *r, char **argv, t_shell *data);
+
+/* src/builtins/read_split.c */
+int			read_assign(t_read *r, char **names, t_shell *data);
+
+/* src/builtins/read_wait.c */
+long long	read_now(void);
+int			read_wait(int fd, long long deadline);
+bool		read_term_raw(int fd, struct termios *saved);
+
+/* src/builtins/cat.c */
+bool		cat_is_plain(char **argv);
+int			builtin_cat(char **argv, t_shell *data);
+
+/* src/builtins/cat_copy.c */
+int			cat_copy(int in, int out, const struct stat *in_st,
+				const struct stat *out_st);
+
 /* src/builtins/cd.c */
 int			builtin_cd(char **argv, t_shell *data);
 
@@ -202,20 +824,6 @@ int			builtin_env(char **argv, t_shell *data);
 int			set_env_node(t_list **env_list, const char *arg);
 int			builtin_export(char **argv, t_shell *data);
 
-/* src/builtins/export_array.c */
-t_env		**export_list_to_array(t_list *list, int *size);
-void		print_sorted_export(t_env **array, int size);
-
-/* src/builtins/export_sort.c */
-void		quicksort(t_env **array, int low, int high);
-void		insertion_sort_env(t_env **array, int size);
-void		sort_export_array(t_env **array, int size);
-
-/* src/builtins/export_sort_utils.c */
-int			median_of_three(t_env **array, int low, int high);
-void		swap_env(t_env **a, t_env **b);
-int			partition(t_env **array, int low, int high);
-
 /* src/builtins/export_update.c */
 t_env		*create_new_env_node(char *key, const char *arg, t_export_op op);
 int			update_existing_env_node(t_env *env_node, const char *arg);
@@ -231,9 +839,38 @@ t_env		*get_env_node_by_key(t_list *env_list, const char *key);
 /* src/builtins/echo.c */
 int			builtin_echo(char **argv, t_shell *data);
 
+/* src/builtins/exec.c */
+int			builtin_exec(char **argv, t_shell *data);
+
 /* src/builtins/exit.c */
 int			builtin_exit(char **argv, t_shell *data);
 
+/* src/builtins/sleep.c */
+int			builtin_sleep(char **argv, t_shell *data);
+
+/* src/builtins/true.c */
+int			builtin_true(char **argv, t_shell *data);
+int			builtin_false(char **argv, t_shell *data);
+
+/* src/builtins/test.c */
+void		test_error(t_test *t, const char *arg, const char *msg);
+int			builtin_test(char **argv, t_shell *data);
+
+/* src/builtins/test_expr.c */
+bool		test_or(t_test *t);
+bool		test_expression(t_test *t);
+
+/* src/builtins/test_file.c */
+bool		test_file(char op, const char *path);
+bool		test_file_cmp(const char *left, const char *op, const char *right);
+
+/* src/builtins/test_ops.c */
+bool		is_unary_op(const char *s);
+bool		is_binary_op(const char *s);
+bool		test_unary(t_test *t, const char *op, const char *arg);
+bool		test_binary(t_test *t, const char *left, const char *op,
+				const char *right);
+
 /* src/builtins/unset.c */
 int			remove_env_node(t_list **env_list, const char *arg);
 int			builtin_unset(char **argv, t_shell *data);
@@ -254,6 +891,14 @@ int			minishell_loop(t_shell *data);
 bool		prompt_user(char *prompt, t_shell *data);
 int			process_line(char *line, t_shell *data);
 
+/* src/core/parse_continue.c */
+int			continue_line(t_strbuf *text, t_token **tail, t_shell *data);
+
+/* src/core/parse_line.c */
+int			tokenize_line(char *line, t_shell *data, t_token **token_list);
+int			parse_line(char **line, t_shell *data, t_ast **ast);
+int			parse_string(const char *str, t_shell *data, t_ast **ast);
+
 /* src/core/init_shell.c */
 int			init_shell(t_shell *data, char **envp);
 
@@ -263,16 +908,36 @@ void		display_easter_egg(void);
 bool		check_and_handle_easter_egg(char *line);
 void		select_random_ascii_art(void);
 
+/* src/core/script_line.c */
+char		*read_script_line(int fd);
+
 /* =========================== */
 /*     ENVIRONMENT IMPORT      */
 /* =========================== */
 
+/* src/env/env_entry.c */
+t_env		*env_new(const char *key, size_t key_len, const char *value);
+int			env_entry_set(t_env *env, const char *key, size_t key_len,
+				const char *value);
+int			env_key_order(const t_env *env, const char *key, size_t len);
+
 /* src/env/env_import.c      */
 void		del_env(void *content);
 int			print_env_list(t_list *env_list);
 t_env		*create_env_node(const char *str);
 t_list		*init_env_from_envp(char **envp);
 
+/* src/env/env_order.c */
+t_list		**env_find_slot(t_list **env_list, const char *key, size_t len);
+t_env		*env_slot_var(t_list **slot, const char *key, size_t len);
+t_env		*env_insert(t_list **slot, t_env *env);
+int			env_string_cmp(const char *a, const char *b);
+
+/* src/env/env_set.c */
+int			set_env_value(t_list **env_list, const char *key,
+				const char *value);
+int			set_env_number(t_list **env_list, const char *key, long long n);
+
 /* =========================== */
 /*         EXECUTION           */
 /* =========================== */
@@ -280,78 +945,270 @@ t_list		*init_env_from_envp(char **envp);
 /* src/execution/ast_utils.c */
 bool		should_fork(t_ast *node, t_shell *data);
 bool		is_builtin(t_ast *node);
-bool		is_nonforking_builtin(t_ast *node);
 
 /* src/execution/build_env_array.c */
 char		**env_list_to_array(t_list *env_list);
 
+/* src/execution/execute_case.c */
+int			execute_case(t_ast *node, t_shell *data);
+
 /* src/execution/execute_ast_tree.c */
 int			execute_ast_tree(t_ast *node, t_shell *data);
 
+/* src/execution/execute_compound.c */
+bool		should_stop_sequence(t_shell *data);
+int			execute_arith_command(t_ast *node, t_shell *data);
+int			execute_compound(t_ast *node, t_shell *data);
+
+/* src/execution/execute_loops.c */
+int			execute_while(t_ast *node, t_shell *data);
+int			execute_for(t_ast *node, t_shell *data);
+
+/* src/execution/execute_in_shell.c */
+void		release_retired_bodies(t_shell *data);
+int			execute_in_shell(t_ast *node, t_func *func, t_shell *data);
+int			define_function(t_ast *node, t_shell *data);
+
+/* src/execution/function_table.c */
+t_func		*find_function(t_shell *data, const char *name);
+int			store_function(t_shell *data, const char *name, t_ast *body);
+void		free_function_table(t_shell *data);
+
 /* src/execution/execute_builtin.c */
 int			execute_builtin(t_ast *node, t_shell *data);
 
 /* src/execution/execute_external_cmd.c */
 int			execute_external_command(char **tokens, t_shell *data);
 
+/* src/execution/execute_optimized.c */
+bool		execute_cat_shortcut(t_ast *node, t_shell *data);
+int			execute_redirect_only(t_ast *redirs, t_shell *data);
+
 /* src/execution/execute_pipeline.c */
+pid_t		fork_right_child(t_ast *node, t_shell *data, int pipefd[2]);
 int			execute_pipeline(t_ast *node, t_shell *data);
 
+/* src/execution/fd_registry.c */
+int			fd_track(int fd);
+void		fd_untrack(int fd);
+void		fd_close_all(void);
+int			fd_pipe(int fds[2]);
+
 /* src/execution/fd_utils.c */
 void		close_fds(int *fd);
 void		close_all_heredocs(t_ast *node);
 void		close_pipe_fds(int pipefd[2]);
-int			save_std_fds(int saved_fds[3]);
-void		restore_std_fds(int saved_fds[3]);
+int			save_redir_fds(t_ast *redirs, int saved_fds[REDIR_FD_MAX]);
+void		restore_redir_fds(int saved_fds[REDIR_FD_MAX]);
 
 /* src/execution/find_executable.c */
 char		*find_executable(char *cmd, t_shell *data);
 
 /* src/execution/heredoc.c */
+int			read_line_heredocs(t_token *tokens, t_shell *data);
 int			preprocess_heredocs(t_ast *node, t_shell *data);
 
+/* src/execution/heredoc_read.c */
+int			read_heredoc_lines(const char *limiter, int pipefd[2],
+				t_shell *data);
+
+/* src/execution/heredoc_store.c */
+int			open_heredoc_store(int fds[2]);
+
+/* src/execution/pipe_size.c */
+void		apply_pipe_size(int fd, t_shell *data);
+
 /* src/execution/pipeline_wait.c */
 int			handle_pipeline_status(int status, t_shell *data);
 int			wait_pipeline(pid_t left_pid, pid_t right_pid, t_shell *data);
 
 /* src/execution/redirections.c */
+int			redir_target_fd(t_ast *node);
 int			apply_redirections(t_ast *node, t_shell *data);
 
+/* src/execution/redirections_open.c */
+int			open_redir_file(t_ast *node, t_shell *data);
+int			dup_redir_source(t_ast *node, t_shell *data, int *src);
+
 /* =========================== */
 /*         EXPANSION           */
 /* =========================== */
 
+/* src/expansion/arith_eval.c */
+long long	arith_comma(t_arith *a);
+long long	arith_assignment(t_arith *a);
+int			arith_evaluate(const char *expr, t_shell *data, int depth,
+				long long *result);
+
+/* src/expansion/arith_expand.c */
+void		arith_fail(t_arith *a, const char *msg);
+size_t		arith_span(const char *s);
+int			append_arith(t_strbuf *buf, const char *s, size_t span,
+				t_shell *data);
+
+/* src/expansion/arith_lexer.c */
+void		arith_skip_spaces(t_arith *a);
+size_t		arith_name_length(const char *s);
+bool		arith_binary_op(t_arith *a, t_arith_binop *binop);
+size_t		arith_assign_op(const char *s, t_arith_op *op);
+long long	arith_read_number(t_arith *a);
+
+/* src/expansion/arith_ops.c */
+long long	arith_apply(t_arith *a, t_arith_op op, long long lhs,
+				long long rhs);
+
+/* src/expansion/arith_unary.c */
+long long	arith_unary(t_arith *a);
+
+/* src/expansion/arith_vars.c */
+long long	arith_get_var(t_arith *a, const char *name, size_t len);
+long long	arith_set_var(t_arith *a, const char *name, size_t len,
+				long long value);
+
+/* src/expansion/command_subst.c */
+int			command_substitution(t_strbuf *buf, const char *s, size_t span,
+				t_shell *data);
+
+/* src/expansion/command_subst_child.c */
+int			capture_child(t_strbuf *buf, t_ast *ast, t_shell *data);
+
+/* src/expansion/expand_command.c */
+char		**expand_argv(char **words, t_shell *data);
+int			expand_cmd_node(t_ast *node, t_shell *data);
+
+/* src/expansion/expand_word.c */
+char		*expand_word(const char *word, t_shell *data);
+char		*expand_pattern(const char *word, t_shell *data);
+
 /* src/expansion/expansion_extract.c */
 char		*extract_var_name(const char *str, size_t start_pos);
 char		*get_var_value(const char *var_name, t_shell *data);
+int			append_variable(t_strbuf *buf, const char *s, size_t *len,
+				t_shell *data);
 
-/* src/expansion/expansion_integrate.c */
-int			expand_tokens_list(t_token *tokens_list, t_shell *data);
-
-/* src/expansion/expansion_replace.c */
-void		fill_expanded_string(char *result, const char *str, t_shell *data);
-char		*expand_variables_in_string(const char *str, t_shell *data);
+/* src/expansion/expansion_params.c */
+size_t		count_params(t_shell *data);
+char		*get_param_value(const char *name, t_shell *data);
+bool		is_params_word(const char *word);
+int			append_params(t_strvec *argv, t_shell *data);
 
 /* src/expansion/expansion_utils.c */
-bool		should_expand_at_position(const char *str, size_t pos);
-size_t		calculate_expanded_size(const char *str, t_shell *data);
-size_t		get_variable_size(const char *str, size_t *i, t_shell *data);
+bool		is_plain_word(const char *word);
+
+/* src/expansion/glob.c */
+bool		is_glob_word(const char *word);
+int			expand_glob(t_strvec *argv, const char *word, t_shell *data);
+
+/* src/expansion/glob_cache.c */
+t_dirlist	*dircache_get(t_shell *data, const char *path);
+bool		dircache_has_tree(t_shell *data, const char *path);
+
+/* src/expansion/glob_cache_table.c */
+size_t		dircache_hash(const char *path);
+int			dircache_insert(t_shell *data, t_dirlist *dir);
+void		del_dir_listing(t_dirlist *dir);
+
+/* src/expansion/glob_dents.c */
+int			glob_scan_dir(t_walker *w, t_walk_task *task, t_dirlist *dir);
+
+/* src/expansion/glob_deque.c */
+int			deque_init(t_walk_deque *dq);
+int			deque_push(t_walk_deque *dq, t_walk_task *task);
+bool		deque_pop(t_walk_deque *dq, t_walk_task *task);
+bool		deque_steal(t_walk_deque *dq, t_walk_task *task);
+void		deque_destroy(t_walk_deque *dq);
+
+/* src/expansion/glob_globstar.c */
+int			walk_globstar(t_glob *g, size_t idx);
+
+/* src/expansion/glob_prefetch.c */
+void		glob_prefetch(t_shell *data, const char *path);
+
+/* src/expansion/glob_readdir.c */
+char		*dir_entry_new(unsigned char type, const char *name);
+t_dirlist	*dirlist_new(const char *path, struct stat *st);
+int			sort_dir_entries(t_dirlist *dir);
+int			read_dir_entries(t_dirlist *dir);
+
+/* src/expansion/glob_walk.c */
+int			glob_path_set(t_glob *g, size_t len, const char *s, size_t n);
+int			glob_walk(t_glob *g, size_t idx);
+
+/* src/expansion/glob_worker.c */
+void		walk_task_release(t_walk_pool *pool, t_walk_task *task);
+void		*glob_worker(void *arg);
+size_t		start_workers(t_walk_pool *pool, t_walker *walkers,
+				pthread_t *threads);
+
+/* src/expansion/param_default.c */
+int			param_default(t_param *p);
+int			param_length(t_param *p);
+int			param_substring(t_param *p);
+
+/* src/expansion/param_expand.c */
+int			param_bad_subst(t_param *p);
+int			append_param(t_strbuf *buf, const char *s, size_t span,
+				t_shell *data);
+
+/* src/expansion/param_match.c */
+int			param_compile(t_param *p, const char *word, size_t len,
+				t_pattern *pat);
+ssize_t		match_prefix(const t_pattern *pat, char *s, size_t len,
+				bool longest);
+ssize_t		match_suffix(const t_pattern *pat, const char *s, size_t len,
+				bool longest);
+
+/* src/expansion/param_pattern.c */
+int			param_remove(t_param *p);
+int			param_replace(t_param *p);
+
+/* src/expansion/pattern_class.c */
+size_t		pattern_set_class(const char *s, size_t len, unsigned char *set);
+
+/* src/expansion/pattern_compile.c */
+int			pattern_compile(const char *s, size_t len, t_pattern *p);
+void		pattern_free(t_pattern *p);
+
+/* src/expansion/pattern_match.c */
+bool		pattern_match(const t_pattern *p, const char *str);
+
+/* src/expansion/pattern_shape.c */
+void		pattern_set_shape(t_pattern *p);
 
 /* =========================== */
 /*           PARSER            */
 /* =========================== */
 
+/* src/parser/case_patterns.c */
+int			compile_case_patterns(t_ast *item);
+void		free_case_patterns(t_ast *item);
+
+/* src/parser/parse_case.c */
+t_ast		*parse_case(t_parser *p);
+
 /* src/ast_build.c */
-t_token		*find_first_pipe(t_token *start, t_token *end);
 t_ast		*build_simple_command(t_token *start, t_token *end);
-t_ast		*build_ast_from_tokens(t_token *tokens);
+t_ast		*build_ast_from_tokens(t_token *tokens, t_parse_status *status);
 
 /* src/ast_build_utils.c */
 bool		is_redir_operator(t_operator_type op_type);
 bool		has_redirections(t_token *start, t_token *end);
-bool		is_redir_filename(t_token *start, t_token *end, t_token *target);
+bool		is_redir_filename(t_token *prev, t_token *target);
 int			count_command_words(t_token *start, t_token *end);
 
+/* src/parser/ast_create_compound.c */
+t_ast		*create_list_node(t_ast *left, t_ast *right);
+t_ast		*create_compound_node(t_node_type type, t_ast *left, t_ast *right);
+t_ast		*create_for_node(const char *name);
+t_ast		*create_function_node(const char *name, t_ast *body);
+
+/* src/parser/ast_optimize.c */
+void		optimize_ast(t_ast *ast, t_shell *data);
+
+/* src/parser/ast_copy.c */
+char		**copy_strings_array(char **arr);
+t_ast		*copy_ast(t_ast *node);
+
 /* src/ast_create_nodes.c */
 char		**collect_argv(t_token *start, t_token *end);
 t_ast		*collect_redirections(t_token *start, t_token *end);
@@ -375,15 +1232,46 @@ t_token		*create_token_type_list(char **tokens);
 char		**execute_tokenizer(char *line, t_shell *data);
 bool		validate_tokens(char **tokens);
 
+/* src/parser/parse_compound.c */
+t_ast		*parse_arith_command(t_parser *p);
+t_ast		*parse_redirect_suffix(t_parser *p, t_ast *node);
+t_ast		*parse_do_group(t_parser *p);
+t_ast		*parse_loop(t_parser *p, t_node_type type);
+
+/* src/parser/parse_function.c */
+bool		is_function_definition(t_parser *p);
+t_ast		*parse_group(t_parser *p);
+t_ast		*parse_function(t_parser *p);
+
+/* src/parser/parse_for.c */
+t_ast		*parse_for(t_parser *p);
+
+/* src/parser/parse_list.c */
+t_ast		*parse_command(t_parser *p);
+t_ast		*parse_pipeline(t_parser *p);
+t_ast		*parse_list(t_parser *p, const char **stops);
+
+/* src/parser/parse_utils.c */
+bool		is_keyword(t_token *tok, const char *keyword);
+bool		is_reserved_word(t_token *tok);
+void		skip_separators(t_parser *p, bool newlines_only);
+t_ast		*parser_error(t_parser *p, t_token *tok);
+bool		expect_keyword(t_parser *p, const char *keyword);
+
 /* src/parser/quote_trimming.c */
 char		*trim_quotes(const char *str);
-int			trim_quotes_in_token_list(t_token *token_list);
 
 /* src/parser/tokenizer_utils.c */
 t_quote		update_quote_state(t_quote current_quote_state, char c);
 bool		is_a_shell_separator(t_quote current_quote_state, char c);
 bool		has_unclosed_quotes(char const *s);
 void		skip_whitespace(char const *s, size_t *i);
+size_t		operator_length(const char *s);
+
+/* src/parser/tokenizer_words.c */
+size_t		paren_group_length(const char *s);
+size_t		brace_group_length(const char *s);
+size_t		word_length(const char *s);
 
 /* src/parser/tokenizer_count_tokens.c */
 int			count_shell_tokens(const char *s);
@@ -413,6 +1301,19 @@ void		setup_signals_heredoc(void);
 /*           UTILS             */
 /* =========================== */
 
+/* src/utils/char_class.c */
+size_t		plain_run_length(const char *s, t_quote quote_state,
+				bool separators);
+
+/* src/utils/char_scan_avx2.c */
+size_t		scan_stop_avx2(const char *s, unsigned short stop);
+
+/* src/utils/char_scan_scalar.c */
+size_t		scan_stop_scalar(const char *s, unsigned short stop);
+
+/* src/utils/char_scan_sse2.c */
+size_t		scan_stop_sse2(const char *s, unsigned short stop);
+
 /* src/utils/is_whitespace.c */
 bool		is_whitespace(char c);
 
@@ -421,8 +1322,39 @@ void		free_string_array(char **tab, size_t count);
 void		cleanup_shell(t_shell *data);
 void		cleanup_line(char **tokens, t_token *token_list, t_ast *ast,
 				char *line);
+void		free_dir_cache(t_shell *data);
+
+/* src/utils/output.c */
+t_outbuf	*out_buffer(int fd);
+int			out_write(int fd, const char *s, size_t len);
+int			out_flush(int fd);
+
+/* src/utils/output_utils.c */
+int			out_str(int fd, const char *s);
+int			out_char(int fd, char c);
+int			out_finish(const char *cmd);
+void		out_perror(const char *s);
+t_strbuf	*out_capture(t_strbuf *capture);
 
 /* src/utils/print_errors.c */
 void		print_error(char *p1, char *p2, char *p3, char *p4);
 
+/* src/utils/strbuf.c */
+void		strbuf_init(t_strbuf *buf);
+int			strbuf_reserve(t_strbuf *buf, size_t extra);
+int			strbuf_append(t_strbuf *buf, const char *src, size_t len);
+char		*strbuf_finish(t_strbuf *buf);
+int			strbuf_escape(t_strbuf *buf, size_t start, const char *set);
+
+/* src/utils/sort_strings.c */
+int			sort_strings(char **items, size_t n,
+				int (*cmp)(const char *, const char *));
+
+/* src/utils/strvec.c */
+void		strvec_init(t_strvec *vec);
+int			strvec_push(t_strvec *vec, char *str);
+int			strvec_move_all(t_strvec *dst, t_strvec *src);
+char		**strvec_finish(t_strvec *vec);
+void		strvec_clear(t_strvec *vec);
+
 #endif
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/15 14:39:49 by diade-so          #+#    #+#             */
-/*   Updated: 2025/09/25 12:56:26 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:04:34 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,6 +25,21 @@
 # include <unistd.h>
 # include <colors.h>
 
+/*
+ * word-at-a-time kernels (ft_strlen, ft_strchr, ft_strcmp, ft_memchr,
+ * ft_memcpy, ft_memset) work on eight bytes per step. A word holds a zero
+ * byte when (w - FT_WORD_ONES) & ~w & FT_WORD_HIGHS is non-zero, and its
+ * lowest set bit marks the first one. KERNELS=byte (FT_BYTEWISE) keeps
+ * the plain byte loops.
+ */
+# if !defined(FT_BYTEWISE) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#  define FT_BYTEWISE
+# endif
+# define FT_WORD_ONES 0x0101010101010101ULL
+# define FT_WORD_HIGHS 0x8080808080808080ULL
+
+typedef uint64_t __attribute__((may_alias, aligned(1)))	t_word;
+
 typedef struct s_list
 {
 	void			*content;
@@ -44,6 +59,7 @@ int		ft_toupper(int c);
 // conv
 int		ft_atosize(const char *str, size_t *out);
 char	*ft_itoa(int n);
+char	*ft_lltoa(long long n);
 int		ft_safe_atoi(const char *str, int *out);
 int		ft_safe_atoll(const char *str, long long *out);
 
@@ -92,6 +108,7 @@ size_t	ft_strlen(const char *s);
 char	*ft_strmapi(char const*s, char (*f)(unsigned int, char));
 int		ft_strcmp(const char *s1, const char *s2);
 int		ft_strncmp(const char *s1, const char *s2, size_t n);
+char	*ft_strndup(const char *s, size_t n);
 char	*ft_strnstr(const char *big, const char *little, size_t len);
 char	*ft_strrchr(const char *s, int c);
 char	*ft_strtrim(char const *s1, char const *set);
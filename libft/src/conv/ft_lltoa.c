@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_lltoa.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:10:24 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:10:24 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include "libft.h"
+
+static int	count_digits(long long n)
+{
+	int	count;
+
+	count = 0;
+	if (n <= 0)
+		count = 1;
+	while (n != 0)
+	{
+		n /= 10;
+		count++;
+	}
+	return (count);
+}
+
+char	*ft_lltoa(long long n)
+{
+	int		len;
+	int		sign;
+	char	*array;
+
+	sign = 1;
+	len = count_digits(n);
+	array = malloc(len + 1);
+	if (!array)
+		return (NULL);
+	array[0] = '0';
+	if (n < 0)
+	{
+		array[0] = '-';
+		sign = -1;
+	}
+	array[len] = '\0';
+	while (n != 0)
+	{
+		array[--len] = (n % 10) * sign + '0';
+		n /= 10;
+	}
+	return (array);
+}
@@ -6,12 +6,13 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/23 17:01:13 by diade-so          #+#    #+#             */
-/*   Updated: 2024/11/25 14:08:39 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:04:34 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include <string.h>
-#include <stddef.h>
+#include "libft.h"
+
+#ifdef FT_BYTEWISE
 
 void	*ft_memchr(const void *s, int c, size_t n)
 {
@@ -27,3 +28,33 @@ void	*ft_memchr(const void *s, int c, size_t n)
 	}
 	return (NULL);
 }
+
+#else
+
+void	*ft_memchr(const void *s, int c, size_t n)
+{
+	const unsigned char	*p;
+	t_word				spread;
+	t_word				x;
+
+	p = s;
+	spread = FT_WORD_ONES * (unsigned char)c;
+	while (n >= sizeof(t_word))
+	{
+		x = *(const t_word *)p ^ spread;
+		x = (x - FT_WORD_ONES) & ~x & FT_WORD_HIGHS;
+		if (x)
+			return ((void *)(p + (__builtin_ctzll(x) >> 3)));
+		p += sizeof(t_word);
+		n -= sizeof(t_word);
+	}
+	while (n--)
+	{
+		if (*p == (unsigned char)c)
+			return ((void *)p);
+		p++;
+	}
+	return (NULL);
+}
+
+#endif
@@ -6,11 +6,13 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/20 16:05:58 by diade-so          #+#    #+#             */
-/*   Updated: 2024/11/27 15:19:15 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:04:34 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include <stddef.h>
+#include "libft.h"
+
+#ifdef FT_BYTEWISE
 
 void	*ft_memcpy(void *dest, const void *src, size_t n)
 {
@@ -27,3 +29,49 @@ void	*ft_memcpy(void *dest, const void *src, size_t n)
 	}
 	return (dest);
 }
+
+#else
+
+/* four words per step, the source may be unaligned */
+static void	copy_words(unsigned char **d, const unsigned char **s, size_t *n)
+{
+	while (*n >= 4 * sizeof(t_word))
+	{
+		((t_word *)*d)[0] = ((const t_word *)*s)[0];
+		((t_word *)*d)[1] = ((const t_word *)*s)[1];
+		((t_word *)*d)[2] = ((const t_word *)*s)[2];
+		((t_word *)*d)[3] = ((const t_word *)*s)[3];
+		*d += 4 * sizeof(t_word);
+		*s += 4 * sizeof(t_word);
+		*n -= 4 * sizeof(t_word);
+	}
+	while (*n >= sizeof(t_word))
+	{
+		*(t_word *)*d = *(const t_word *)*s;
+		*d += sizeof(t_word);
+		*s += sizeof(t_word);
+		*n -= sizeof(t_word);
+	}
+}
+
+void	*ft_memcpy(void *dest, const void *src, size_t n)
+{
+	unsigned char		*d;
+	const unsigned char	*s;
+
+	d = (unsigned char *)dest;
+	s = (const unsigned char *)src;
+	if (!dest && !src)
+		return (0);
+	while (n && (uintptr_t)d % sizeof(t_word))
+	{
+		*d++ = *s++;
+		n--;
+	}
+	copy_words(&d, &s, &n);
+	while (n--)
+		*d++ = *s++;
+	return (dest);
+}
+
+#endif
@@ -6,11 +6,13 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/16 18:47:51 by diade-so          #+#    #+#             */
-/*   Updated: 2024/11/19 15:57:25 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:04:34 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include <stddef.h>
+#include "libft.h"
+
+#ifdef FT_BYTEWISE
 
 void	*ft_memset(void *s, int c, size_t n)
 {
@@ -26,3 +28,31 @@ void	*ft_memset(void *s, int c, size_t n)
 	}
 	return (s);
 }
+
+#else
+
+void	*ft_memset(void *s, int c, size_t n)
+{
+	unsigned char	*p;
+	t_word			spread;
+
+	p = s;
+	while (n && (uintptr_t)p % sizeof(t_word))
+	{
+		*p++ = (unsigned char)c;
+		n--;
+	}
+	spread = FT_WORD_ONES * (unsigned char)c;
+	while (n >= 2 * sizeof(t_word))
+	{
+		((t_word *)p)[0] = spread;
+		((t_word *)p)[1] = spread;
+		p += 2 * sizeof(t_word);
+		n -= 2 * sizeof(t_word);
+	}
+	while (n--)
+		*p++ = (unsigned char)c;
+	return (s);
+}
+
+#endif
@@ -6,12 +6,13 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/22 16:59:31 by diade-so          #+#    #+#             */
-/*   Updated: 2024/11/22 19:01:57 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:04:34 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include <string.h>
-#include <stddef.h>
+#include "libft.h"
+
+#ifdef FT_BYTEWISE
 
 char	*ft_strchr(const char *s, int c)
 {
@@ -26,3 +27,44 @@ char	*ft_strchr(const char *s, int c)
 	}
 	return ((char *)(s + i));
 }
+
+#else
+
+/* bytes of w equal to the terminator or to c (spread over the word) */
+static t_word	stop_bytes(t_word w, t_word spread)
+{
+	t_word	x;
+
+	x = w ^ spread;
+	return (((w - FT_WORD_ONES) & ~w) | ((x - FT_WORD_ONES) & ~x));
+}
+
+/* aligned word loads, see ft_strlen */
+__attribute__((no_sanitize_address))
+char	*ft_strchr(const char *s, int c)
+{
+	t_word	spread;
+	t_word	stop;
+
+	while ((uintptr_t)s % sizeof(t_word))
+	{
+		if (*s == (char)c)
+			return ((char *)s);
+		if (!*s)
+			return (NULL);
+		s++;
+	}
+	spread = FT_WORD_ONES * (unsigned char)c;
+	stop = stop_bytes(*(const t_word *)s, spread) & FT_WORD_HIGHS;
+	while (!stop)
+	{
+		s += sizeof(t_word);
+		stop = stop_bytes(*(const t_word *)s, spread) & FT_WORD_HIGHS;
+	}
+	s += __builtin_ctzll(stop) >> 3;
+	if (*s == (char)c)
+		return ((char *)s);
+	return (NULL);
+}
+
+#endif
@@ -6,12 +6,14 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/09/09 10:18:06 by diade-so          #+#    #+#             */
-/*   Updated: 2025/09/09 10:22:34 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:04:34 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
+#ifdef FT_BYTEWISE
+
 /**
  * @brief Compare two null-terminated strings (env keys).
  *
@@ -33,3 +35,57 @@ int	ft_strcmp(const char *s1, const char *s2)
 	}
 	return ((unsigned char)*s1 - (unsigned char)*s2);
 }
+
+#else
+
+static int	byte_cmp(const unsigned char *s1, const unsigned char *s2)
+{
+	while (*s1 && *s1 == *s2)
+	{
+		s1++;
+		s2++;
+	}
+	return (*s1 - *s2);
+}
+
+/**
+ * @brief Compare two null-terminated strings (env keys).
+ *
+ * Works like strcmp. When both strings share the same alignment, whole
+ * words are compared until one differs or holds the terminator, and the
+ * byte loop finishes inside that word. Other strings are compared byte
+ * by byte, so a load never crosses into an unmapped page.
+ *
+ * @param s1 First string to compare.
+ * @param s2 Second string to compare.
+ * @return int Comparison result.
+ */
+__attribute__((no_sanitize_address))
+int	ft_strcmp(const char *s1, const char *s2)
+{
+	t_word	w1;
+	t_word	w2;
+
+	if (((uintptr_t)s1 ^ (uintptr_t)s2) % sizeof(t_word))
+		return (byte_cmp((const unsigned char *)s1,
+				(const unsigned char *)s2));
+	while ((uintptr_t)s1 % sizeof(t_word))
+	{
+		if (!*s1 || *s1 != *s2)
+			return ((unsigned char)*s1 - (unsigned char)*s2);
+		s1++;
+		s2++;
+	}
+	w1 = *(const t_word *)s1;
+	w2 = *(const t_word *)s2;
+	while (w1 == w2 && !((w1 - FT_WORD_ONES) & ~w1 & FT_WORD_HIGHS))
+	{
+		s1 += sizeof(t_word);
+		s2 += sizeof(t_word);
+		w1 = *(const t_word *)s1;
+		w2 = *(const t_word *)s2;
+	}
+	return (byte_cmp((const unsigned char *)s1, (const unsigned char *)s2));
+}
+
+#endif
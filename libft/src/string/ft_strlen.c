@@ -6,11 +6,13 @@
 /*   By: diade-so <diade-so@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/16 10:50:43 by diade-so          #+#    #+#             */
-/*   Updated: 2024/11/19 15:53:39 by diade-so         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:04:34 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include <stddef.h>
+#include "libft.h"
+
+#ifdef FT_BYTEWISE
 
 size_t	ft_strlen(const char *s)
 {
@@ -21,3 +23,36 @@ size_t	ft_strlen(const char *s)
 		i++;
 	return (i);
 }
+
+#else
+
+/*
+ * The word loads are aligned: they never cross into the next page, but
+ * they read past the terminator, which ASan would report.
+ */
+__attribute__((no_sanitize_address))
+size_t	ft_strlen(const char *s)
+{
+	const char	*p;
+	t_word		w;
+	t_word		zero;
+
+	p = s;
+	while ((uintptr_t)p % sizeof(t_word))
+	{
+		if (!*p)
+			return (p - s);
+		p++;
+	}
+	w = *(const t_word *)p;
+	zero = (w - FT_WORD_ONES) & ~w & FT_WORD_HIGHS;
+	while (!zero)
+	{
+		p += sizeof(t_word);
+		w = *(const t_word *)p;
+		zero = (w - FT_WORD_ONES) & ~w & FT_WORD_HIGHS;
+	}
+	return (p - s + (__builtin_ctzll(zero) >> 3));
+}
+
+#endif
@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cat.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:32:01 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:32:46 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check that a cat command line only uses what the builtin knows.
+ *
+ * The builtin is POSIX cat: operands and `-u` (ignored, output is never
+ * buffered). Any other option (`-n`, `-A`, ...) is left to the cat
+ * program.
+ *
+ * @param argv Expanded argv (argv[0] is "cat")
+ * @return true if the builtin can run this command
+ */
+bool	cat_is_plain(char **argv)
+{
+	size_t	i;
+
+	i = 1;
+	while (argv[i] && ft_strcmp(argv[i], "--") != 0)
+	{
+		if (argv[i][0] == '-' && argv[i][1] && ft_strcmp(argv[i], "-u") != 0)
+			return (false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Print "cat: <path>: <system error message>" to stderr.
+ *
+ * @param path Operand that failed
+ * @return EXIT_FAILURE
+ */
+static int	cat_error(const char *path)
+{
+	out_str(STDERR_FILENO, ERR_PREFIX ERR_CAT);
+	out_perror(path);
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Copy an open input to the standard output.
+ *
+ * A regular file that is also the output is refused while some of it is
+ * left to read: copying it would never reach its end. An empty one, as
+ * in `cat f > f`, is fine, like in GNU cat.
+ *
+ * @param fd Input fd
+ * @param path Operand name, for error messages
+ * @return Exit status for this operand
+ */
+static int	cat_fd(int fd, const char *path)
+{
+	struct stat	in_st;
+	struct stat	out_st;
+	int			ret;
+
+	if (fstat(fd, &in_st) == -1)
+		return (cat_error(path));
+	if (fstat(STDOUT_FILENO, &out_st) == -1)
+		out_st.st_mode = 0;
+	if (S_ISREG(in_st.st_mode) && S_ISREG(out_st.st_mode)
+		&& in_st.st_dev == out_st.st_dev && in_st.st_ino == out_st.st_ino
+		&& lseek(fd, 0, SEEK_CUR) < in_st.st_size)
+	{
+		print_error(ERR_PREFIX, ERR_CAT, (char *)path, ERR_CAT_SAME);
+		return (EXIT_FAILURE);
+	}
+	ret = cat_copy(fd, STDOUT_FILENO, &in_st, &out_st);
+	if (ret == -1 && errno == EINTR)
+		return (EXIT_SIGINT);
+	if (ret == -1)
+		return (cat_error(path));
+	if (ret == -2)
+		return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Copy one operand (`-` is the standard input) to the output.
+ *
+ * The output is checked first: with fd 1 closed, the operand would be
+ * opened as fd 1 and taken for the output.
+ *
+ * @param path Operand
+ * @return Exit status for this operand
+ */
+static int	cat_path(const char *path)
+{
+	struct stat	st;
+	int			fd;
+	int			status;
+
+	if (fstat(STDOUT_FILENO, &st) == -1)
+		return (cat_error("standard output"));
+	if (ft_strcmp(path, "-") == 0)
+		return (cat_fd(STDIN_FILENO, path));
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (cat_error(path));
+	status = cat_fd(fd, path);
+	close(fd);
+	return (status);
+}
+
+/**
+ * @brief Builtin command: cat [-u] [file...]
+ *
+ * Concatenates the files (the standard input without operands) to the
+ * standard output without running a program: in a pipeline the stage
+ * child copies the data itself, through the kernel where it can (see
+ * cat_copy()). A failing operand is reported and the next one is still
+ * copied. Only reached when cat_is_plain() accepts the options.
+ *
+ * @param argv Command argv (argv[0] is "cat")
+ * @param data Shell state structure
+ * @return 0 on success, 1 if an operand failed, 130 if interrupted
+ */
+int	builtin_cat(char **argv, t_shell *data)
+{
+	size_t	i;
+	size_t	operands;
+	bool	end_of_options;
+	int		status;
+
+	data->status = EXIT_SUCCESS;
+	operands = 0;
+	end_of_options = false;
+	i = 1;
+	while (argv[i] && data->status != EXIT_SIGINT)
+	{
+		if (!end_of_options && ft_strcmp(argv[i], "--") == 0)
+			end_of_options = true;
+		else if (end_of_options || ft_strcmp(argv[i], "-u") != 0)
+		{
+			operands++;
+			status = cat_path(argv[i]);
+			if (status != EXIT_SUCCESS)
+				data->status = status;
+		}
+		i++;
+	}
+	if (!operands)
+		data->status = cat_path("-");
+	return (data->status);
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cat_copy.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:32:01 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:32:01 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Copy one buffer of data with read() and write().
+ *
+ * The bytes go through the stdout buffer, so they follow a capture of
+ * the builtin's output; a full buffer is written straight from here.
+ *
+ * @param in Input fd
+ * @param out Output fd
+ * @return Bytes copied, 0 at end of input, -1 on read error, -2 on write
+ *         error (reported by out_finish())
+ */
+static ssize_t	copy_buffer(int in, int out)
+{
+	static char	buf[CAT_BUF_SIZE];
+	ssize_t		n;
+
+	n = read(in, buf, CAT_BUF_SIZE);
+	if (n > 0 && out_write(out, buf, n) == -1)
+		return (-2);
+	return (n);
+}
+
+/**
+ * @brief Move the next chunk of input to the output.
+ *
+ * @param in Input fd
+ * @param out Output fd
+ * @param method System call to use
+ * @return As copy_buffer()
+ */
+static ssize_t	copy_chunk(int in, int out, t_copy method)
+{
+	if (method == COPY_RANGE)
+		return (copy_file_range(in, NULL, out, NULL, CAT_COPY_MAX, 0));
+	if (method == COPY_SPLICE)
+		return (splice(in, NULL, out, NULL, CAT_COPY_MAX, SPLICE_F_MOVE));
+	if (method == COPY_SENDFILE)
+		return (sendfile(out, in, NULL, CAT_COPY_MAX));
+	return (copy_buffer(in, out));
+}
+
+/**
+ * @brief Pick the cheapest way to copy between two fds.
+ *
+ * Between two files the kernel copies (or reflinks) the data itself; a
+ * pipe on either side moves pages with splice(); a file is sent to a
+ * socket with sendfile(). The data only crosses user space for anything
+ * else, or when the output is captured.
+ *
+ * @param out Output fd
+ * @param in_st Status of the input
+ * @param out_st Status of the output
+ * @return Copy method
+ */
+static t_copy	pick_method(int out, const struct stat *in_st,
+	const struct stat *out_st)
+{
+	t_outbuf	*buf;
+
+	buf = out_buffer(out);
+	if (buf && buf->capture)
+		return (COPY_BUFFER);
+	if (S_ISREG(in_st->st_mode) && S_ISREG(out_st->st_mode))
+		return (COPY_RANGE);
+	if (S_ISFIFO(in_st->st_mode) || S_ISFIFO(out_st->st_mode))
+		return (COPY_SPLICE);
+	if (S_ISREG(in_st->st_mode) && S_ISSOCK(out_st->st_mode))
+		return (COPY_SENDFILE);
+	return (COPY_BUFFER);
+}
+
+/**
+ * @brief Check whether a failed copy call can be retried with read().
+ *
+ * The kernel paths refuse some fd pairs only when asked: files on two
+ * filesystems, an output opened with O_APPEND, a terminal, an old kernel.
+ *
+ * @param method Method that failed
+ * @param err errno of the failure
+ * @return true if the copy should go on with COPY_BUFFER
+ */
+static bool	can_fall_back(t_copy method, int err)
+{
+	if (method == COPY_BUFFER)
+		return (false);
+	return (err == EINVAL || err == EXDEV || err == ENOSYS
+		|| err == EOPNOTSUPP || err == EBADF);
+}
+
+/**
+ * @brief Copy everything from one fd to another.
+ *
+ * A Ctrl-C in the shell process interrupts the copy (errno EINTR), like
+ * it would stop the cat program.
+ *
+ * @param in Input fd
+ * @param out Output fd
+ * @param in_st Status of the input
+ * @param out_st Status of the output
+ * @return 0 on success, -1 on error (errno set), -2 on a buffered write
+ *         error
+ */
+int	cat_copy(int in, int out, const struct stat *in_st,
+	const struct stat *out_st)
+{
+	t_copy	method;
+	ssize_t	n;
+
+	method = pick_method(out, in_st, out_st);
+	if (method != COPY_BUFFER && out_flush(out) == -1)
+		return (-2);
+	n = 1;
+	while (n != 0)
+	{
+		n = copy_chunk(in, out, method);
+		if (n == -2)
+			return (-2);
+		if (n >= 0 || (errno == EINTR && g_signal_received != SIGINT))
+			continue ;
+		if (!can_fall_back(method, errno))
+			return (-1);
+		method = COPY_BUFFER;
+		n = 1;
+	}
+	return (0);
+}
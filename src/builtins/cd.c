@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:39:17 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/16 18:06:04 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:08:29 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -61,10 +61,8 @@ static void	print_cd_error(char *target)
 {
 	if (!target)
 		return ;
-	ft_putstr_fd("[mini$HELL]: cd: ", STDERR_FILENO);
-	ft_putstr_fd(target, STDERR_FILENO);
-	ft_putstr_fd(": ", STDERR_FILENO);
-	ft_putendl_fd(strerror(errno), STDERR_FILENO);
+	out_str(STDERR_FILENO, ERR_PREFIX ERR_CD);
+	out_perror(target);
 }
 
 /**
@@ -105,7 +103,7 @@ int	builtin_cd(char **argv, t_shell *data)
 	oldpwd = getcwd(NULL, 0);
 	if (!oldpwd)
 	{
-		perror("getcwd");
+		out_perror("getcwd");
 		oldpwd = NULL;
 	}
 	target = get_cd_target(argv, data);
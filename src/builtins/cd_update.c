@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/16 17:56:35 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/16 17:56:49 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:08:29 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,7 +57,7 @@ void	update_pwd_from_target(t_shell *data)
 	cwd = getcwd(NULL, 0);
 	if (!cwd)
 	{
-		perror("[mini$HELL]: cd: getcwd");
+		out_perror("[mini$HELL]: cd: getcwd");
 		return ;
 	}
 	update_env_var_value(&data->env_list, "PWD", cwd);
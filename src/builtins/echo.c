@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:39:22 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:39:23 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:08:29 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -50,9 +50,9 @@ static void	print_echo_cmd(char **argv, int start_print_index)
 {
 	while (argv[start_print_index] != NULL)
 	{
-		printf("%s", argv[start_print_index]);
+		out_str(STDOUT_FILENO, argv[start_print_index]);
 		if (argv[start_print_index + 1])
-			printf(" ");
+			out_char(STDOUT_FILENO, ' ');
 		start_print_index++;
 	}
 }
@@ -86,7 +86,7 @@ int	builtin_echo(char **argv, t_shell *data)
 
 	if (argv[1] == NULL)
 	{
-		printf("\n");
+		out_char(STDOUT_FILENO, '\n');
 		data->status = EXIT_SUCCESS;
 		return (data->status);
 	}
@@ -100,7 +100,7 @@ int	builtin_echo(char **argv, t_shell *data)
 	}
 	print_echo_cmd(argv, start_print_index);
 	if (print_new_line)
-		printf("\n");
+		out_char(STDOUT_FILENO, '\n');
 	data->status = EXIT_SUCCESS;
 	return (data->status);
 }
@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:22:23 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Builtin command: exec [command [args...]]
+ *
+ * Without a command, the redirections written with `exec` have already
+ * been applied by execute_in_shell() and are not undone: they change the
+ * shell's own descriptors for the following commands (`exec 3>>log`,
+ * `exec 3>&-`). With a command, the shell process is replaced by it
+ * without forking; if it cannot be run, the shell exits with the status
+ * a child would have returned.
+ *
+ * @param argv Command argv (argv[0] is "exec")
+ * @param data Shell state structure
+ * @return Exit status stored in `data->status` (no command given)
+ */
+int	builtin_exec(char **argv, t_shell *data)
+{
+	if (!argv[1])
+	{
+		data->status = EXIT_SUCCESS;
+		return (data->status);
+	}
+	setup_signals_child();
+	execute_external_command(argv + 1, data);
+	return (data->status);
+}
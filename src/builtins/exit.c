@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:39:30 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:39:31 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:08:29 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -87,7 +87,7 @@ int	builtin_exit(char **argv, t_shell *data)
 	long long	exit_code;
 
 	if (data->is_tty && !data->is_child)
-		printf("exit\n");
+		out_str(STDOUT_FILENO, "exit\n");
 	if (argv[1] == NULL)
 		return (handle_exit_no_args(data));
 	if (ft_safe_atoll(argv[1], &exit_code) != 1)
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:40:02 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:40:09 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 04:27:36 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -35,8 +35,8 @@ static int	handle_invalid_key(const char *arg)
  * @brief Handle environment variable updates for an existing key.
  *
  * Applies the correct action depending on the detected export operation:
- *  - EXPORT_NONE: mark the variable as declared but not exported
- *                 (env_node->in_env = false).
+ *  - EXPORT_NONE: keep the value and mark the variable as exported
+ *                 (env_node->in_env = true), as bash does.
  *  - EXPORT_ASSIGN: replace the current value with the new one.
  *  - EXPORT_APPEND: concatenate the new value onto the existing one.
  *
@@ -49,7 +49,7 @@ static int	handle_invalid_key(const char *arg)
 static int	handle_env_ops(t_env *env_node, const char *arg, t_export_op op)
 {
 	if (op == EXPORT_NONE)
-		env_node->in_env = false;
+		env_node->in_env = true;
 	else if (op == EXPORT_ASSIGN)
 	{
 		if (!update_existing_env_node(env_node, arg))
@@ -74,7 +74,8 @@ static int	handle_env_ops(t_env *env_node, const char *arg, t_export_op op)
  *  - Detect the export operation type (assignment, append, or none).
  *  - Extract and validate the key from the given arg.
  *  - If a node with the key already exists, update or append its value.
- *  - Otherwise, create and append a new environment node to the list.
+ *  - Otherwise, create a new environment node and link it at its place in
+ *    the list, which is kept sorted by key.
  *
  * @param env_list Pointer to the environment list (linked list of t_env).
  * @param arg    The input string containing the assignment or declaration.
@@ -89,6 +90,7 @@ int	set_env_node(t_list **env_list, const char *arg)
 {
 	char		*key;
 	t_env		*env_node;
+	t_list		**slot;
 	t_export_op	op;
 
 	if (!arg || !env_list)
@@ -97,49 +99,49 @@ int	set_env_node(t_list **env_list, const char *arg)
 	key = get_env_key(arg);
 	if (!key)
 		return (handle_invalid_key(arg));
-	env_node = get_env_node_by_key(*env_list, key);
+	slot = env_find_slot(env_list, key, ft_strlen(key));
+	env_node = env_slot_var(slot, key, ft_strlen(key));
 	if (env_node)
 	{
 		free(key);
 		if (!handle_env_ops(env_node, arg, op))
 			return (-1);
 	}
-	else
-	{
-		env_node = create_new_env_node(key, arg, op);
-		if (!env_node)
-			return (-1);
-		ft_lstadd_back(env_list, ft_lstnew(env_node));
-	}
+	else if (!env_insert(slot, create_new_env_node(key, arg, op)))
+		return (-1);
 	return (0);
 }
 
 /**
- * @brief Convert the environment list to a sorted array and print it.
+ * @brief Print the environment list in `declare -x` form.
  *
  * This helper function handles the "export" command with no arguments.
- * It converts the linked list of environment variables to an array,
- * sorts it lexicographically, prints the result, and frees the array.
+ * The list is kept sorted by key as variables are set, so it is printed
+ * in one walk through the stdout buffer, without sorting anything.
  * Updates data->status accordingly.
  *
  * @param env_list Linked list of environment variables
  * @param data Shell data structure
- * @return int Updated exit status (EXIT_SUCCESS or EXIT_FAILURE)
+ * @return int Updated exit status (EXIT_SUCCESS)
  */
 static int	print_sorted_env(t_list *env_list, t_shell *data)
 {
-	int		size;
-	t_env	**env_array;
+	t_env	*env;
 
-	env_array = export_list_to_array(env_list, &size);
-	if (!env_array)
+	while (env_list)
 	{
-		data->status = EXIT_FAILURE;
-		return (data->status);
+		env = env_list->content;
+		out_str(STDOUT_FILENO, "declare -x ");
+		out_write(STDOUT_FILENO, env->entry, env->key_len);
+		if (env->value)
+		{
+			out_str(STDOUT_FILENO, "=\"");
+			out_str(STDOUT_FILENO, env->value);
+			out_char(STDOUT_FILENO, '"');
+		}
+		out_char(STDOUT_FILENO, '\n');
+		env_list = env_list->next;
 	}
-	sort_export_array(env_array, size);
-	print_sorted_export(env_array, size);
-	free(env_array);
 	data->status = EXIT_SUCCESS;
 	return (data->status);
 }
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:39:50 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:39:51 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:10:45 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,37 +23,30 @@
  * - Otherwise, the node is created without a value and `in_env` is set to
  *   false.
  *
- * @param key   A malloc'ed key string (ownership is transferred to the node).
+ * @param key   A malloc'ed key string (always freed: it is copied into the
+ *              node's entry).
  * @param arg The input string containing the assignment.
  * @param op    The detected export operation (assign, append, or none).
  *
  * @return Pointer to the newly created t_env node, or NULL on malloc failure.
- *         On failure, the provided key is freed.
  */
 t_env	*create_new_env_node(char *key, const char *arg, t_export_op op)
 {
 	t_env	*new;
+	char	*value;
 
-	new = malloc(sizeof (t_env));
-	if (!new)
-		return (free(key), NULL);
-	new->key = key;
+	value = NULL;
 	if (op == EXPORT_ASSIGN)
 	{
-		new->value = get_env_value(arg);
-		if (!new->value)
-		{
-			free(new->key);
-			free(new);
-			return (NULL);
-		}
-		new->in_env = true;
+		value = get_env_value(arg);
+		if (!value)
+			return (free(key), NULL);
 	}
-	else
-	{
-		new->value = NULL;
+	new = env_new(key, ft_strlen(key), value);
+	free(key);
+	free(value);
+	if (new && op != EXPORT_ASSIGN)
 		new->in_env = false;
-	}
 	return (new);
 }
 
@@ -76,13 +69,14 @@ int	update_existing_env_node(t_env *env_node, const char *arg)
 	if (!env_node || !arg)
 		return (0);
 	new_value = get_env_value(arg);
-	if (!new_value)
+	if (!new_value || env_entry_set(env_node, env_node->entry,
+			env_node->key_len, new_value) == -1)
 	{
+		free(new_value);
 		errno = ENOMEM;
 		return (0);
 	}
-	free(env_node->value);
-	env_node->value = new_value;
+	free(new_value);
 	env_node->in_env = true;
 	return (1);
 }
@@ -100,7 +94,7 @@ int	update_existing_env_node(t_env *env_node, const char *arg)
  *
  * @return 1 on success, 0 on failure (malloc error or invalid input).
  *
- * @note Frees and replaces the old `env_node->value` with the appended result.
+ * @note Replaces the entry of `env_node` with one holding the appended value.
  */
 int	append_env_value(t_env *env_node, const char *arg)
 {
@@ -119,10 +113,10 @@ int	append_env_value(t_env *env_node, const char *arg)
 		old_value = "";
 	appended = ft_strjoin(old_value, new_value);
 	free(new_value);
-	if (!appended)
-		return (0);
-	free(env_node->value);
-	env_node->value = appended;
+	if (!appended || env_entry_set(env_node, env_node->entry,
+			env_node->key_len, appended) == -1)
+		return (free(appended), 0);
+	free(appended);
 	env_node->in_env = true;
 	return (1);
 }
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:39:55 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:39:57 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:10:45 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -144,6 +144,8 @@ char	*get_env_value(const char *arg)
 /**
  * @brief Find an environment node by key in the list.
  *
+ * The list is sorted by key, so the search stops at the key's place.
+ *
  * @param env_list The linked list of environment variables.
  * @param key The key to search for.
  *
@@ -151,16 +153,10 @@ char	*get_env_value(const char *arg)
  */
 t_env	*get_env_node_by_key(t_list *env_list, const char *key)
 {
-	t_env	*env_node;
+	size_t	len;
 
 	if (!env_list || !key)
 		return (NULL);
-	while (env_list)
-	{
-		env_node = env_list->content;
-		if (env_node && ft_strcmp(env_node->key, key) == 0)
-			return (env_node);
-		env_list = env_list->next;
-	}
-	return (NULL);
+	len = ft_strlen(key);
+	return (env_slot_var(env_find_slot(&env_list, key, len), key, len));
 }
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kill.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:50:51 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:50:51 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Report a misused kill and show its usage.
+ *
+ * @param data Shell state structure
+ * @return MISUSAGE_ERROR
+ */
+static int	kill_usage(t_shell *data)
+{
+	print_error(ERR_PREFIX, ERR_KILL, ERR_KILL_USAGE, NULL);
+	data->status = MISUSAGE_ERROR;
+	return (data->status);
+}
+
+/**
+ * @brief Parse the signal option: `-s sig`, `-n num` or `-sig`.
+ *
+ * @param argv Position in the arguments (advanced past the option)
+ * @param sig Receives the signal (unchanged without option)
+ * @param data Shell state structure
+ * @return 0 on success, the exit status of the command on error
+ */
+static int	parse_signal(char ***argv, int *sig, t_shell *data)
+{
+	char	*spec;
+
+	spec = **argv;
+	if (!spec || spec[0] != '-' || !spec[1] || ft_strcmp(spec, "--") == 0)
+		return (0);
+	if (ft_strcmp(spec, "-s") == 0 || ft_strcmp(spec, "-n") == 0)
+		spec = *++*argv;
+	else
+		spec++;
+	if (!spec)
+		print_error(ERR_PREFIX, ERR_KILL, (*argv)[-1], ERR_OPTION_ARG);
+	else
+	{
+		(*argv)++;
+		*sig = signal_number(spec);
+		if (*sig >= 0)
+			return (0);
+		print_error(ERR_PREFIX, ERR_KILL, spec, ERR_KILL_SIG);
+	}
+	data->status = EXIT_FAILURE;
+	return (data->status);
+}
+
+/**
+ * @brief Send the signal to one operand.
+ *
+ * The shell runs no background jobs, so a job specification (`%1`,
+ * `%%`) never names a job.
+ *
+ * @param arg Process ID, or negative process group ID
+ * @param sig Signal (0 only checks that the process exists)
+ * @return 0 on success, 1 on error
+ */
+static int	kill_operand(const char *arg, int sig)
+{
+	int	pid;
+
+	if (arg[0] == '%')
+	{
+		print_error(ERR_PREFIX, ERR_KILL, (char *)arg, ERR_KILL_JOB);
+		return (EXIT_FAILURE);
+	}
+	if (ft_safe_atoi(arg, &pid) != 1)
+	{
+		print_error(ERR_PREFIX, ERR_KILL, (char *)arg, ERR_KILL_ARG);
+		return (EXIT_FAILURE);
+	}
+	if (kill(pid, sig) == 0)
+		return (EXIT_SUCCESS);
+	out_str(STDERR_FILENO, ERR_PREFIX ERR_KILL "(");
+	out_str(STDERR_FILENO, arg);
+	out_str(STDERR_FILENO, ") - ");
+	out_perror(NULL);
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Builtin command: kill [-s sig | -n num | -sig] pid ...
+ *                         kill -l [sig | status ...]
+ *
+ * Sends the signal (SIGTERM by default) with one kill() call per
+ * operand, without a process. `-l` lists or converts signals.
+ *
+ * @param argv Command argv (argv[0] is "kill")
+ * @param data Shell state structure
+ * @return 0 if every operand was signaled, 1 otherwise, 2 on usage error
+ */
+int	builtin_kill(char **argv, t_shell *data)
+{
+	int	sig;
+	int	status;
+
+	argv++;
+	if (*argv && (ft_strcmp(*argv, "-l") == 0 || ft_strcmp(*argv, "-L") == 0))
+		return (kill_list(argv + 1, data));
+	sig = SIGTERM;
+	if (parse_signal(&argv, &sig, data) != 0)
+		return (data->status);
+	if (*argv && ft_strcmp(*argv, "--") == 0)
+		argv++;
+	if (!*argv)
+		return (kill_usage(data));
+	status = EXIT_SUCCESS;
+	while (*argv)
+	{
+		if (kill_operand(*argv, sig) != EXIT_SUCCESS)
+			status = EXIT_FAILURE;
+		argv++;
+	}
+	data->status = status;
+	return (data->status);
+}
@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kill_list.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:50:51 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:50:51 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Convert one argument of `kill -l`: a number to a name, a name
+ * to a number.
+ *
+ * A number above 128 is taken as the exit status of a killed command.
+ *
+ * @param arg Argument
+ * @return false if it is not a signal
+ */
+static bool	list_one(const char *arg)
+{
+	const char	*name;
+	char		*digits;
+	int			num;
+
+	if (!ft_isdigit(*arg))
+	{
+		num = signal_number(arg);
+		if (num < 0)
+			return (false);
+		digits = ft_itoa(num);
+		out_str(STDOUT_FILENO, digits);
+		out_char(STDOUT_FILENO, '\n');
+		free(digits);
+		return (true);
+	}
+	if (ft_safe_atoi(arg, &num) != 1)
+		return (false);
+	if (num > 128)
+		num -= 128;
+	name = signal_name(num);
+	if (!name)
+		return (false);
+	out_str(STDOUT_FILENO, name);
+	out_char(STDOUT_FILENO, '\n');
+	return (true);
+}
+
+/**
+ * @brief `kill -l [sig | status ...]`: list the signals, or convert the
+ * arguments.
+ *
+ * @param argv Arguments after -l
+ * @param data Shell state structure
+ * @return 0 on success, 1 if an argument is not a signal
+ */
+int	kill_list(char **argv, t_shell *data)
+{
+	data->status = EXIT_SUCCESS;
+	if (!*argv)
+		print_signal_list();
+	while (*argv)
+	{
+		if (!list_one(*argv))
+		{
+			print_error(ERR_PREFIX, ERR_KILL, *argv, ERR_KILL_SIG);
+			data->status = EXIT_FAILURE;
+		}
+		argv++;
+	}
+	return (data->status);
+}
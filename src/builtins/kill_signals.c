@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   kill_signals.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:50:51 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:50:51 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Get the table of the signal names kill knows.
+ *
+ * @return Names and numbers, ended by a NULL name
+ */
+static const t_signame	*signal_table(void)
+{
+	static const t_signame	table[] = {
+	{"HUP", SIGHUP}, {"INT", SIGINT}, {"QUIT", SIGQUIT}, {"ILL", SIGILL},
+	{"TRAP", SIGTRAP}, {"ABRT", SIGABRT}, {"BUS", SIGBUS}, {"FPE", SIGFPE},
+	{"KILL", SIGKILL}, {"USR1", SIGUSR1}, {"SEGV", SIGSEGV},
+	{"USR2", SIGUSR2}, {"PIPE", SIGPIPE}, {"ALRM", SIGALRM},
+	{"TERM", SIGTERM}, {"STKFLT", SIGSTKFLT}, {"CHLD", SIGCHLD},
+	{"CONT", SIGCONT}, {"STOP", SIGSTOP}, {"TSTP", SIGTSTP},
+	{"TTIN", SIGTTIN}, {"TTOU", SIGTTOU}, {"URG", SIGURG},
+	{"XCPU", SIGXCPU}, {"XFSZ", SIGXFSZ}, {"VTALRM", SIGVTALRM},
+	{"PROF", SIGPROF}, {"WINCH", SIGWINCH}, {"IO", SIGIO},
+	{"PWR", SIGPWR}, {"SYS", SIGSYS}, {NULL, 0}};
+
+	return (table);
+}
+
+/**
+ * @brief Compare a signal specification with a name, ignoring case.
+ *
+ * @param spec Specification
+ * @param name Upper case name
+ * @param prefix Whether `name` only has to start `spec`
+ * @return true if they match
+ */
+static bool	same_name(const char *spec, const char *name, bool prefix)
+{
+	while (*spec && ft_toupper(*spec) == *name)
+	{
+		spec++;
+		name++;
+	}
+	return (*name == '\0' && (prefix || *spec == '\0'));
+}
+
+/**
+ * @brief Convert a signal specification to its number.
+ *
+ * @param spec Number (`9`), or name with or without SIG prefix, in any
+ *             case (`KILL`, `sigkill`)
+ * @return The signal number, or -1 if the specification is invalid
+ */
+int	signal_number(const char *spec)
+{
+	const t_signame	*table;
+	int				num;
+
+	if (ft_isdigit(*spec))
+	{
+		if (ft_safe_atoi(spec, &num) != 1 || num >= NSIG)
+			return (-1);
+		return (num);
+	}
+	if (ft_strlen(spec) > 3 && same_name(spec, "SIG", true))
+		spec += 3;
+	table = signal_table();
+	while (table->name && !same_name(spec, table->name, false))
+		table++;
+	if (!table->name)
+		return (-1);
+	return (table->num);
+}
+
+/**
+ * @brief Get the name of a signal.
+ *
+ * @param num Signal number
+ * @return Its name without SIG prefix, or NULL if it has none
+ */
+const char	*signal_name(int num)
+{
+	const t_signame	*table;
+
+	table = signal_table();
+	while (table->name && table->num != num)
+		table++;
+	return (table->name);
+}
+
+/**
+ * @brief Print the known signals as `kill -l` does, five per line.
+ */
+void	print_signal_list(void)
+{
+	const t_signame	*table;
+	size_t			i;
+
+	table = signal_table();
+	i = 0;
+	while (table[i].name)
+	{
+		if (table[i].num >= 10)
+			out_char(STDOUT_FILENO, '0' + table[i].num / 10);
+		else
+			out_char(STDOUT_FILENO, ' ');
+		out_char(STDOUT_FILENO, '0' + table[i].num % 10);
+		out_str(STDOUT_FILENO, ") SIG");
+		out_str(STDOUT_FILENO, table[i].name);
+		i++;
+		if (i % 5 == 0 || !table[i].name)
+			out_char(STDOUT_FILENO, '\n');
+		else
+			out_char(STDOUT_FILENO, '\t');
+	}
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   loop_control.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:22:42 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Compute the number of loops affected by `break`/`continue`.
+ *
+ * Outside of any loop the builtin only prints a warning and succeeds,
+ * like bash. The optional argument must be a positive number; it is
+ * capped to the current loop depth. A non-numeric or out of range
+ * argument fails and leaves all the enclosing loops, even for
+ * `continue`, as in bash.
+ *
+ * @param argv Builtin arguments (argv[1] is the optional loop count)
+ * @param name Error prefix for the builtin ("break: " or "continue: ")
+ * @param data Shell state structure
+ * @param count Receives the number of loops to leave
+ * @return true if the builtin must act, false if it is already handled
+ */
+static bool	get_loop_count(char **argv, char *name, t_shell *data, int *count)
+{
+	data->status = EXIT_SUCCESS;
+	if (data->loop_depth == 0)
+	{
+		print_error(ERR_PREFIX, name, ERR_LOOP_ONLY, NULL);
+		return (false);
+	}
+	*count = 1;
+	if (argv[1] && ft_safe_atoi(argv[1], count) != 1)
+		print_error(ERR_PREFIX, name, argv[1], ERR_NUMERIC_ARG);
+	else if (*count <= 0)
+		print_error(ERR_PREFIX, name, argv[1], ERR_LOOP_RANGE);
+	else
+	{
+		if (*count > data->loop_depth)
+			*count = data->loop_depth;
+		return (true);
+	}
+	data->status = EXIT_FAILURE;
+	data->break_count = data->loop_depth;
+	return (false);
+}
+
+/**
+ * @brief Builtin command: break [n]
+ *
+ * Leaves the n innermost enclosing loops (1 by default). The loops notice
+ * the pending break through `data->break_count` once the current command
+ * returns.
+ *
+ * @param argv Command argv (argv[0] is "break")
+ * @param data Shell state structure
+ * @return Exit status stored in `data->status`
+ */
+int	builtin_break(char **argv, t_shell *data)
+{
+	int	count;
+
+	if (get_loop_count(argv, ERR_BREAK, data, &count))
+		data->break_count = count;
+	return (data->status);
+}
+
+/**
+ * @brief Builtin command: continue [n]
+ *
+ * Skips the rest of the current iteration and resumes the next iteration
+ * of the n-th enclosing loop (1 by default).
+ *
+ * @param argv Command argv (argv[0] is "continue")
+ * @param data Shell state structure
+ * @return Exit status stored in `data->status`
+ */
+int	builtin_continue(char **argv, t_shell *data)
+{
+	int	count;
+
+	if (get_loop_count(argv, ERR_CONTINUE, data, &count))
+		data->continue_count = count;
+	return (data->status);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:39:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:39:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Write the literal text of the format up to the next `%` or `\`.
+ *
+ * @param fmt Format at the first literal character
+ * @return Number of characters written
+ */
+static size_t	put_literal(const char *fmt)
+{
+	size_t	len;
+
+	len = 0;
+	while (fmt[len] && fmt[len] != '%' && fmt[len] != '\\')
+		len++;
+	out_write(STDOUT_FILENO, fmt, len);
+	return (len);
+}
+
+/**
+ * @brief Output the format once, consuming arguments for its conversions.
+ *
+ * @param fmt Format string
+ * @param st Arguments and state of the command
+ */
+static void	run_format(const char *fmt, t_printf *st)
+{
+	size_t	i;
+	size_t	len;
+	int		c;
+
+	i = 0;
+	while (fmt[i] && !st->stop)
+	{
+		if (fmt[i] == '\\')
+		{
+			c = printf_escape(fmt + i + 1, &len, false);
+			out_char(STDOUT_FILENO, (char)c);
+			i += len + 1;
+		}
+		else if (fmt[i] == '%' && fmt[i + 1] == '%')
+		{
+			out_char(STDOUT_FILENO, '%');
+			i += 2;
+		}
+		else if (fmt[i] == '%')
+			i += printf_conversion(fmt + i + 1, st) + 1;
+		else
+			i += put_literal(fmt + i);
+	}
+}
+
+/**
+ * @brief Builtin command: printf format [arguments]
+ *
+ * Formats in the shell process through the buffered output of builtins:
+ * a loop printing thousands of lines makes a few large writes instead
+ * of a fork and an exec per line. The format is reused while arguments
+ * remain; missing arguments read as an empty string or 0. Supports the
+ * flags `-+ #0`, width and precision (also `*`), the conversions
+ * `d i o u x X c s`, `%b` (escapes in the argument, `\c` stops the
+ * output) and `%q` (quoted for the shell).
+ *
+ * @param argv Command argv (argv[0] is "printf")
+ * @param data Shell state structure
+ * @return 0 on success, 1 if an argument or the format was invalid, 2 on
+ *         usage error
+ */
+int	builtin_printf(char **argv, t_shell *data)
+{
+	t_printf	st;
+
+	if (argv[1] && ft_strcmp(argv[1], "--") == 0)
+		argv++;
+	if (!argv[1])
+	{
+		print_error(ERR_PREFIX, ERR_PRINTF, ERR_PRINTF_USAGE, NULL);
+		data->status = MISUSAGE_ERROR;
+		return (data->status);
+	}
+	st.args = argv + 2;
+	st.used = false;
+	st.stop = false;
+	st.status = EXIT_SUCCESS;
+	run_format(argv[1], &st);
+	while (!st.stop && st.used && *st.args)
+	{
+		st.used = false;
+		run_format(argv[1], &st);
+	}
+	data->status = st.status;
+	return (data->status);
+}
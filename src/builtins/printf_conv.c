@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_conv.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:39:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:39:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Take the next argument of printf.
+ *
+ * @param st Arguments and state of the command
+ * @return The argument, or NULL when there is none left
+ */
+const char	*printf_next_arg(t_printf *st)
+{
+	if (!*st->args)
+		return (NULL);
+	st->used = true;
+	return (*st->args++);
+}
+
+/**
+ * @brief Read a width or precision: digits, or `*` for an argument.
+ *
+ * @param fmt Position in the format (advanced)
+ * @param st Arguments and state of the command
+ * @return The number, clamped to the int range
+ */
+static int	spec_number(const char **fmt, t_printf *st)
+{
+	long long	n;
+
+	if (**fmt == '*')
+	{
+		(*fmt)++;
+		n = printf_arg_int(st);
+		if (n > INT_MAX)
+			return (INT_MAX);
+		if (n < -INT_MAX)
+			return (-INT_MAX);
+		return ((int)n);
+	}
+	n = 0;
+	while (ft_isdigit(**fmt))
+	{
+		if (n < INT_MAX / 10)
+			n = n * 10 + (**fmt - '0');
+		(*fmt)++;
+	}
+	return ((int)n);
+}
+
+/**
+ * @brief Parse the flags, width, precision and conversion after a `%`.
+ *
+ * Length modifiers (`l`, `ll`, `h`, ...) are accepted and ignored: every
+ * integer is converted on 64 bits.
+ *
+ * @param fmt Format after the `%`
+ * @param spec Receives the conversion (conv is '\0' at end of format)
+ * @param st Arguments and state of the command
+ * @return Position of the conversion character
+ */
+static const char	*parse_spec(const char *fmt, t_printf_spec *spec,
+	t_printf *st)
+{
+	ft_bzero(spec, sizeof(*spec));
+	while (*fmt && ft_strchr("-+ #0", *fmt))
+	{
+		spec->minus |= (*fmt == '-');
+		spec->plus |= (*fmt == '+');
+		spec->space |= (*fmt == ' ');
+		spec->hash |= (*fmt == '#');
+		spec->zero |= (*fmt == '0');
+		fmt++;
+	}
+	spec->width = spec_number(&fmt, st);
+	if (spec->width < 0)
+		spec->minus = true;
+	if (spec->width < 0)
+		spec->width = -spec->width;
+	spec->precision = -1;
+	if (*fmt == '.')
+	{
+		fmt++;
+		spec->precision = spec_number(&fmt, st);
+		if (spec->precision < 0)
+			spec->precision = -1;
+	}
+	while (*fmt && ft_strchr(PRINTF_LENGTH_MODS, *fmt))
+		fmt++;
+	spec->conv = *fmt;
+	return (fmt);
+}
+
+/**
+ * @brief Convert the next argument with `%c`, `%s`, `%b` or `%q`.
+ *
+ * @param spec Conversion
+ * @param st Arguments and state of the command
+ */
+static void	convert_string(const t_printf_spec *spec, t_printf *st)
+{
+	const char	*arg;
+	t_strbuf	buf;
+	int			ret;
+
+	arg = printf_next_arg(st);
+	if (!arg)
+		arg = "";
+	if (spec->conv == 'c' || spec->conv == 's')
+	{
+		printf_text(spec, arg, ft_strlen(arg));
+		return ;
+	}
+	strbuf_init(&buf);
+	if (spec->conv == 'b')
+		ret = printf_expand_escapes(&buf, arg, &st->stop);
+	else
+		ret = printf_quote(&buf, arg);
+	if (ret == 0)
+		printf_text(spec, buf.data, buf.len);
+	else
+	{
+		st->status = EXIT_FAILURE;
+		st->stop = true;
+	}
+	free(buf.data);
+}
+
+/**
+ * @brief Output one `%` conversion of the format.
+ *
+ * An unknown or missing conversion character is an error that stops the
+ * output, as in bash.
+ *
+ * @param fmt Format after the `%`
+ * @param st Arguments and state of the command
+ * @return Number of format characters used after the `%`
+ */
+size_t	printf_conversion(const char *fmt, t_printf *st)
+{
+	t_printf_spec	spec;
+	const char		*end;
+	char			conv[2];
+
+	end = parse_spec(fmt, &spec, st);
+	if (spec.conv && ft_strchr("diouxX", spec.conv))
+		printf_integer(&spec, st);
+	else if (spec.conv && ft_strchr("csbq", spec.conv))
+		convert_string(&spec, st);
+	else
+	{
+		conv[0] = spec.conv;
+		conv[1] = '\0';
+		if (!spec.conv)
+			print_error(ERR_PREFIX, ERR_PRINTF, ERR_PRINTF_MISSING, NULL);
+		else
+			print_error(ERR_PREFIX, ERR_PRINTF "`", conv, ERR_PRINTF_CONV);
+		st->status = EXIT_FAILURE;
+		st->stop = true;
+		return (end - fmt);
+	}
+	return (end - fmt + 1);
+}
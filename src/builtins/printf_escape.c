@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_escape.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:39:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:39:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Value of a digit in base 8 or 16.
+ *
+ * @param c Character
+ * @param base 8 or 16
+ * @return The value, or -1 if c is not a digit of the base
+ */
+static int	digit_value(char c, int base)
+{
+	const char	*digits;
+	const char	*found;
+
+	digits = "0123456789abcdef";
+	if (!c)
+		return (-1);
+	found = ft_strchr(digits, ft_tolower(c));
+	if (!found || found - digits >= base)
+		return (-1);
+	return (found - digits);
+}
+
+/**
+ * @brief Read the digits of a numeric escape (`\101`, `\x41`).
+ *
+ * @param s First digit
+ * @param base 8 or 16
+ * @param max Maximum number of digits
+ * @param len Receives the number of digits read
+ * @return The byte value
+ */
+static int	escape_number(const char *s, int base, size_t max, size_t *len)
+{
+	int	value;
+
+	value = 0;
+	*len = 0;
+	while (*len < max && digit_value(s[*len], base) >= 0)
+	{
+		value = value * base + digit_value(s[*len], base);
+		(*len)++;
+	}
+	return (value & 0xff);
+}
+
+/**
+ * @brief Decode a numeric escape: octal, or `\x` with hex digits.
+ *
+ * @param s Text after the backslash
+ * @param len Receives the number of characters used after the backslash
+ * @param in_arg true for a `%b` argument, where `\0NNN` is octal too
+ * @return The byte, or -1 if the escape is not numeric
+ */
+static int	numeric_escape(const char *s, size_t *len, bool in_arg)
+{
+	int	value;
+
+	if (s[0] == 'x' && digit_value(s[1], 16) >= 0)
+	{
+		value = escape_number(s + 1, 16, 2, len);
+		*len += 1;
+		return (value);
+	}
+	if (in_arg && s[0] == '0')
+	{
+		value = escape_number(s + 1, 8, 3, len);
+		*len += 1;
+		return (value);
+	}
+	if (digit_value(s[0], 8) >= 0)
+		return (escape_number(s, 8, 3, len));
+	return (-1);
+}
+
+/**
+ * @brief Decode the backslash escape of a format or of a `%b` argument.
+ *
+ * Knows `\a \b \e \E \f \n \r \t \v \\ \" \' \?`, up to three octal
+ * digits and `\x` with up to two hex digits. In a `%b` argument, `\c`
+ * ends the output. An unknown escape stands for the backslash itself.
+ *
+ * @param s Text after the backslash
+ * @param len Receives the number of characters used after the backslash
+ * @param in_arg true for a `%b` argument
+ * @return The byte, or -1 for `\c`
+ */
+int	printf_escape(const char *s, size_t *len, bool in_arg)
+{
+	static const char	names[] = "abeEfnrtv\\\"'?";
+	static const char	codes[] = "\a\b\033\033\f\n\r\t\v\\\"'?";
+	const char			*found;
+	int					value;
+
+	*len = 1;
+	if (in_arg && s[0] == 'c')
+		return (-1);
+	value = numeric_escape(s, len, in_arg);
+	if (value >= 0)
+		return (value);
+	*len = 1;
+	found = NULL;
+	if (s[0])
+		found = ft_strchr(names, s[0]);
+	if (found)
+		return (codes[found - names]);
+	*len = 0;
+	return ('\\');
+}
+
+/**
+ * @brief Append a `%b` argument with its escapes decoded.
+ *
+ * @param buf Output
+ * @param s Argument
+ * @param stop Set when `\c` ends the output (the text before is kept)
+ * @return 0 on success, -1 on allocation failure
+ */
+int	printf_expand_escapes(t_strbuf *buf, const char *s, bool *stop)
+{
+	size_t	len;
+	int		c;
+	char	byte;
+
+	while (*s)
+	{
+		len = 0;
+		while (s[len] && s[len] != '\\')
+			len++;
+		if (strbuf_append(buf, s, len) == -1)
+			return (-1);
+		s += len;
+		if (!*s)
+			return (0);
+		c = printf_escape(s + 1, &len, true);
+		*stop = (c == -1);
+		if (*stop)
+			return (0);
+		byte = (char)c;
+		if (strbuf_append(buf, &byte, 1) == -1)
+			return (-1);
+		s += len + 1;
+	}
+	return (0);
+}
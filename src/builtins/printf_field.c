@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_field.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:39:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:39:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Write a character n times through the stdout buffer.
+ *
+ * @param c ' ' or '0'
+ * @param n Count
+ */
+static void	put_repeat(char c, size_t n)
+{
+	static const char	spaces[] = "                                ";
+	static const char	zeros[] = "00000000000000000000000000000000";
+	const char			*src;
+	size_t				chunk;
+
+	src = spaces;
+	if (c == '0')
+		src = zeros;
+	while (n > 0)
+	{
+		chunk = n;
+		if (chunk > sizeof(spaces) - 1)
+			chunk = sizeof(spaces) - 1;
+		out_write(STDOUT_FILENO, src, chunk);
+		n -= chunk;
+	}
+}
+
+/**
+ * @brief Write a field padded to the width of its conversion.
+ *
+ * Spaces go before the field, or after it with `-`. With `0`, a numeric
+ * conversion without precision is padded with zeros after its sign or
+ * base prefix instead.
+ *
+ * @param spec Conversion
+ * @param field Prefix, zeros of the precision and text
+ */
+void	printf_field(const t_printf_spec *spec, const t_field *field)
+{
+	size_t	total;
+	size_t	pad;
+	bool	zero_pad;
+
+	total = ft_strlen(field->prefix) + field->zeros + field->len;
+	pad = 0;
+	if (spec->width > 0 && (size_t)spec->width > total)
+		pad = spec->width - total;
+	zero_pad = (spec->zero && !spec->minus && spec->precision < 0
+			&& ft_strchr("diouxX", spec->conv));
+	if (!spec->minus && !zero_pad)
+		put_repeat(' ', pad);
+	out_str(STDOUT_FILENO, field->prefix);
+	if (zero_pad)
+		put_repeat('0', pad);
+	put_repeat('0', field->zeros);
+	out_write(STDOUT_FILENO, field->text, field->len);
+	if (spec->minus)
+		put_repeat(' ', pad);
+}
+
+/**
+ * @brief Write a text conversion, cut to its precision.
+ *
+ * `%c` writes the first byte of its argument, a NUL for an empty one.
+ *
+ * @param spec Conversion
+ * @param s Text
+ * @param len Length of the text
+ */
+void	printf_text(const t_printf_spec *spec, const char *s, size_t len)
+{
+	t_field	field;
+
+	if (spec->conv == 'c')
+		len = 1;
+	else if (spec->precision >= 0 && (size_t)spec->precision < len)
+		len = spec->precision;
+	field.prefix = "";
+	field.zeros = 0;
+	field.text = s;
+	field.len = len;
+	printf_field(spec, &field);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_int.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:39:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:39:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Write the digits of a number in the base of its conversion.
+ *
+ * @param n Value
+ * @param conv 'd', 'i', 'u' (10), 'o' (8), 'x' or 'X' (16)
+ * @param end End of the output buffer; digits are written before it
+ * @return Number of digits
+ */
+static size_t	to_base(unsigned long long n, char conv, char *end)
+{
+	const char	*digits;
+	unsigned	base;
+	size_t		len;
+
+	digits = "0123456789abcdef";
+	if (conv == 'X')
+		digits = "0123456789ABCDEF";
+	base = 10;
+	if (conv == 'o')
+		base = 8;
+	else if (conv == 'x' || conv == 'X')
+		base = 16;
+	len = 0;
+	*(end - ++len) = digits[n % base];
+	n /= base;
+	while (n)
+	{
+		*(end - ++len) = digits[n % base];
+		n /= base;
+	}
+	return (len);
+}
+
+/**
+ * @brief Get the sign or base prefix of an integer conversion.
+ *
+ * @param spec Conversion
+ * @param neg Whether the value is negative
+ * @param value Absolute value
+ * @return "-", "+", " ", "0x", "0X" or ""
+ */
+static const char	*integer_prefix(const t_printf_spec *spec, bool neg,
+	unsigned long long value)
+{
+	if (spec->conv == 'd' || spec->conv == 'i')
+	{
+		if (neg)
+			return ("-");
+		if (spec->plus)
+			return ("+");
+		if (spec->space)
+			return (" ");
+		return ("");
+	}
+	if (spec->hash && value != 0 && spec->conv == 'x')
+		return ("0x");
+	if (spec->hash && value != 0 && spec->conv == 'X')
+		return ("0X");
+	return ("");
+}
+
+/**
+ * @brief Convert the next argument with `%d %i %o %u %x %X`.
+ *
+ * Unsigned conversions of a negative number print its 64-bit two's
+ * complement, like `printf %x -1`.
+ *
+ * @param spec Conversion
+ * @param st Arguments and state of the command
+ */
+void	printf_integer(const t_printf_spec *spec, t_printf *st)
+{
+	char				buf[64];
+	unsigned long long	value;
+	bool				neg;
+	bool				is_signed;
+	t_field				field;
+
+	is_signed = (spec->conv == 'd' || spec->conv == 'i');
+	printf_arg_value(st, is_signed, &value, &neg);
+	if (neg && !is_signed)
+		value = -value;
+	field.len = to_base(value, spec->conv, buf + sizeof(buf));
+	field.text = buf + sizeof(buf) - field.len;
+	if (spec->precision == 0 && value == 0)
+		field.len = 0;
+	field.zeros = 0;
+	if (spec->precision > 0 && (size_t)spec->precision > field.len)
+		field.zeros = spec->precision - field.len;
+	if (spec->conv == 'o' && spec->hash && !field.zeros
+		&& (!field.len || field.text[0] != '0'))
+		field.zeros = 1;
+	field.prefix = integer_prefix(spec, neg && is_signed, value);
+	printf_field(spec, &field);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_num.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:39:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:39:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Read the digits of a number in base 10, 16 (`0x`) or 8 (`0`).
+ *
+ * @param s First character after the sign
+ * @param mag Receives the value, ULLONG_MAX if it does not fit
+ * @param overflow Set if the value does not fit
+ * @return First character after the number
+ */
+static const char	*parse_magnitude(const char *s, unsigned long long *mag,
+	bool *overflow)
+{
+	const char	*digits;
+	const char	*found;
+	unsigned	base;
+
+	digits = "0123456789abcdef";
+	base = 10;
+	if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+		base = 16;
+	else if (s[0] == '0')
+		base = 8;
+	if (base == 16)
+		s += 2;
+	*mag = 0;
+	found = ft_strchr(digits, ft_tolower(*s));
+	while (*s && found && (unsigned)(found - digits) < base)
+	{
+		if (*mag > (ULLONG_MAX - (found - digits)) / base)
+			*overflow = true;
+		if (*overflow)
+			*mag = ULLONG_MAX;
+		else
+			*mag = *mag * base + (found - digits);
+		found = ft_strchr(digits, ft_tolower(*++s));
+	}
+	return (s);
+}
+
+/**
+ * @brief Parse a numeric argument like strtoimax() in base 0.
+ *
+ * A leading quote gives the code of the next character (`'A` is 65).
+ *
+ * @param arg Argument
+ * @param mag Receives the absolute value
+ * @param neg Receives the sign
+ * @param overflow Set if the value does not fit in 64 bits
+ * @return true if the whole argument is a number
+ */
+static bool	parse_number(const char *arg, unsigned long long *mag, bool *neg,
+	bool *overflow)
+{
+	const char	*end;
+
+	*mag = 0;
+	*neg = false;
+	if (arg[0] == '\'' || arg[0] == '"')
+	{
+		*mag = (unsigned char)arg[1];
+		return (true);
+	}
+	while (ft_isspace(*arg))
+		arg++;
+	if (*arg == '-' || *arg == '+')
+		*neg = (*arg++ == '-');
+	end = parse_magnitude(arg, mag, overflow);
+	if (end == arg)
+		return (false);
+	return (*end == '\0');
+}
+
+/**
+ * @brief Take the next argument of printf as a number.
+ *
+ * A missing or empty argument is 0. An invalid one is reported and
+ * makes the command fail, but the value read so far is still printed;
+ * an out-of-range one is clamped with a warning, as in bash.
+ *
+ * @param st Arguments and state of the command
+ * @param is_signed Whether the conversion is signed (range of long long)
+ * @param mag Receives the absolute value
+ * @param neg Receives the sign (false for 0)
+ */
+void	printf_arg_value(t_printf *st, bool is_signed,
+	unsigned long long *mag, bool *neg)
+{
+	const char			*arg;
+	bool				overflow;
+	unsigned long long	limit;
+
+	arg = printf_next_arg(st);
+	overflow = false;
+	*mag = 0;
+	*neg = false;
+	if (!arg || !*arg)
+		return ;
+	if (!parse_number(arg, mag, neg, &overflow))
+	{
+		print_error(ERR_PREFIX, ERR_PRINTF, (char *)arg, ERR_PRINTF_NUM);
+		st->status = EXIT_FAILURE;
+	}
+	limit = ULLONG_MAX;
+	if (is_signed)
+		limit = (unsigned long long)LLONG_MAX + *neg;
+	if (overflow || *mag > limit)
+	{
+		print_error(ERR_PREFIX, ERR_PRINTF "warning: ", (char *)arg,
+			ERR_PRINTF_RANGE);
+		*mag = limit;
+	}
+	*neg = (*neg && *mag != 0);
+}
+
+/**
+ * @brief Take the next argument of printf as a signed number (for `*`).
+ *
+ * @param st Arguments and state of the command
+ * @return The value
+ */
+long long	printf_arg_int(t_printf *st)
+{
+	unsigned long long	mag;
+	bool				neg;
+
+	printf_arg_value(st, true, &mag, &neg);
+	if (neg)
+		return (-(long long)(mag - 1) - 1);
+	return ((long long)mag);
+}
@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_quote.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:39:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:39:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if a string needs the $'...' form to be quoted.
+ *
+ * @param s String
+ * @return true if it holds a control or non-ASCII byte
+ */
+static bool	needs_ansic(const char *s)
+{
+	while (*s)
+	{
+		if (!ft_isprint((unsigned char)*s))
+			return (true);
+		s++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Write one byte as it appears inside $'...'.
+ *
+ * @param c Byte
+ * @param esc Receives the escaped form (at most 4 bytes)
+ * @return Length of the escaped form
+ */
+static size_t	ansic_char(unsigned char c, char *esc)
+{
+	static const char	names[] = "abEfnrtv\\'";
+	static const char	codes[] = "\a\b\033\f\n\r\t\v\\'";
+	const char			*found;
+
+	esc[0] = '\\';
+	found = ft_strchr(codes, c);
+	if (c && found)
+	{
+		esc[1] = names[found - codes];
+		return (2);
+	}
+	if (ft_isprint(c))
+	{
+		esc[0] = c;
+		return (1);
+	}
+	esc[1] = '0' + (c >> 6);
+	esc[2] = '0' + ((c >> 3) & 7);
+	esc[3] = '0' + (c & 7);
+	return (4);
+}
+
+/**
+ * @brief Quote a string with control bytes as $'...'.
+ *
+ * @param buf Output
+ * @param s String
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	quote_ansic(t_strbuf *buf, const char *s)
+{
+	char	esc[4];
+	size_t	len;
+
+	if (strbuf_append(buf, "$'", 2) == -1)
+		return (-1);
+	while (*s)
+	{
+		len = ansic_char((unsigned char)*s, esc);
+		if (strbuf_append(buf, esc, len) == -1)
+			return (-1);
+		s++;
+	}
+	return (strbuf_append(buf, "'", 1));
+}
+
+/**
+ * @brief Quote a printable string with backslashes.
+ *
+ * Shell metacharacters get a backslash; `~` and `#` only at the start of
+ * the word, where they are special.
+ *
+ * @param buf Output
+ * @param s String
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	quote_backslash(t_strbuf *buf, const char *s)
+{
+	size_t	i;
+
+	i = 0;
+	while (s[i])
+	{
+		if (!ft_isalnum(s[i]) && !ft_strchr(PRINTF_QUOTE_SAFE, s[i])
+			&& !(i > 0 && (s[i] == '~' || s[i] == '#'))
+			&& strbuf_append(buf, "\\", 1) == -1)
+			return (-1);
+		if (strbuf_append(buf, s + i, 1) == -1)
+			return (-1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Append a string quoted so that the shell reads it back as one
+ * word (`%q`).
+ *
+ * @param buf Output
+ * @param s String
+ * @return 0 on success, -1 on allocation failure
+ */
+int	printf_quote(t_strbuf *buf, const char *s)
+{
+	if (!*s)
+		return (strbuf_append(buf, "''", 2));
+	if (needs_ansic(s))
+		return (quote_ansic(buf, s));
+	return (quote_backslash(buf, s));
+}
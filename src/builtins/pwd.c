@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:40:05 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:40:06 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:08:29 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,7 +24,7 @@
 * @return Exit status of the command (0 on success, 1 on failure).
 *
 * @note Memory is automatically allocated by getcwd(NULL, 0) and freed
-* @note Errors are handled with perror() which displays appropriate message
+* @note Errors are reported with out_perror(), like perror()
 */
 int	builtin_pwd(char **argv, t_shell *data)
 {
@@ -34,11 +34,12 @@ int	builtin_pwd(char **argv, t_shell *data)
 	path = getcwd(NULL, 0);
 	if (!path)
 	{
-		perror("pwd");
+		out_perror("pwd");
 		data->status = EXIT_FAILURE;
 		return (data->status);
 	}
-	printf("%s\n", path);
+	out_str(STDOUT_FILENO, path);
+	out_char(STDOUT_FILENO, '\n');
 	free(path);
 	data->status = EXIT_SUCCESS;
 	return (data->status);
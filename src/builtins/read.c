@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:45:09 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:45:09 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check that every name is a valid variable name.
+ *
+ * @param names Variables to assign
+ * @param data Shell state structure
+ * @return true if all are valid
+ */
+static bool	valid_names(char **names, t_shell *data)
+{
+	while (*names)
+	{
+		if (!is_valid_key(*names) || ft_strchr(*names, '=')
+			|| ft_strchr(*names, '+'))
+		{
+			print_error(ERR_PREFIX, ERR_READ "`", *names, ERR_NOT_VALID_ID);
+			data->status = EXIT_FAILURE;
+			return (false);
+		}
+		names++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Builtin command: read [-r] [-d c] [-n num] [-t sec] [name ...]
+ *
+ * Reads a line of the standard input and splits it on IFS into the
+ * variables: REPLY without names, the last name gets the rest of the
+ * line. A regular file is read in blocks and its offset moved back to
+ * the end of the line, so the next command starts reading there; other
+ * inputs are read one byte at a time so that nothing past the line is
+ * taken. `-t 0` only tells whether input is waiting.
+ *
+ * @param argv Command argv (argv[0] is "read")
+ * @param data Shell state structure
+ * @return 0 when a full line was read, 1 at end of file or on error,
+ *         READ_TIMEOUT_STATUS after the -t timeout, 130 on SIGINT,
+ *         2 on usage error
+ */
+int	builtin_read(char **argv, t_shell *data)
+{
+	t_read	r;
+	int		i;
+	int		status;
+
+	i = read_options(&r, argv, data);
+	if (i < 0 || !valid_names(argv + i, data))
+		return (data->status);
+	if (r.deadline == 0)
+	{
+		data->status = (read_wait(r.fd, read_now()) != 0);
+		return (data->status);
+	}
+	if (r.deadline > 0)
+		r.deadline += read_now();
+	status = read_input(&r);
+	if (status != EXIT_SIGINT && read_assign(&r, argv + i, data) == -1)
+		status = EXIT_FAILURE;
+	free(r.line.data);
+	free(r.quoted.data);
+	data->status = status;
+	return (data->status);
+}
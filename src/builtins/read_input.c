@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_input.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:45:09 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:45:09 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Get the status of read after a failed or empty read().
+ *
+ * @param n Result of read() (0 at end of file, -1 on error)
+ * @return 1 at end of file or on error, EXIT_SIGINT on SIGINT
+ */
+static int	read_status(ssize_t n)
+{
+	if (n == 0)
+		return (EXIT_FAILURE);
+	if (errno == EINTR)
+		return (EXIT_SIGINT);
+	out_str(STDERR_FILENO, ERR_PREFIX ERR_READ ERR_READ_FAIL);
+	out_perror("0");
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Add one input byte to the line.
+ *
+ * Unless -r is given, a backslash escapes the next byte, which is kept
+ * and marked in `quoted`, and a backslash-newline pair is removed. NUL
+ * bytes cannot be stored in a variable and are dropped.
+ *
+ * @param r Line read so far
+ * @param c Byte
+ * @return 1 when the line is complete, 0 if it goes on, -1 on allocation
+ *         failure
+ */
+static int	read_feed(t_read *r, char c)
+{
+	char	mark;
+
+	mark = 0;
+	if (r->escape)
+	{
+		r->escape = false;
+		if (c == '\n')
+			return (0);
+		mark = 1;
+	}
+	else if (c == r->delim)
+		return (1);
+	else if (c == '\\' && !r->raw)
+	{
+		r->escape = true;
+		return (0);
+	}
+	if (c == '\0')
+		return (0);
+	if (strbuf_append(&r->line, &c, 1) == -1
+		|| strbuf_append(&r->quoted, &mark, 1) == -1)
+		return (-1);
+	return (r->nchars >= 0 && r->line.len >= (size_t)r->nchars);
+}
+
+/**
+ * @brief Read a line from a regular file, a block at a time.
+ *
+ * The bytes read past the end of the line are given back by moving the
+ * file offset backwards, as if the line had been read byte by byte.
+ *
+ * @param r Line and options
+ * @return 0 when the line is complete, else the status of read_status()
+ */
+static int	read_block(t_read *r)
+{
+	char	buf[READ_BUF_SIZE];
+	ssize_t	n;
+	ssize_t	i;
+	int		done;
+
+	while (1)
+	{
+		n = read(r->fd, buf, sizeof(buf));
+		if (n < 0 && errno == EINTR && g_signal_received != SIGINT)
+			continue ;
+		if (n <= 0)
+			return (read_status(n));
+		i = 0;
+		done = 0;
+		while (i < n && done == 0)
+			done = read_feed(r, buf[i++]);
+		if (done == -1)
+			return (read_status(-1));
+		if (done == 1 && i < n)
+			lseek(r->fd, i - n, SEEK_CUR);
+		if (done == 1)
+			return (EXIT_SUCCESS);
+	}
+}
+
+/**
+ * @brief Read a line from a pipe, a terminal or a socket, byte by byte.
+ *
+ * These inputs cannot be rewound, so nothing past the line is read.
+ * With -t, each byte is waited for until the deadline.
+ *
+ * @param r Line and options
+ * @return 0 when the line is complete, else the status of read_status()
+ *         or read_wait()
+ */
+static int	read_bytes(t_read *r)
+{
+	char	c;
+	ssize_t	n;
+	int		done;
+
+	done = 0;
+	while (done == 0)
+	{
+		if (r->deadline >= 0)
+			done = read_wait(r->fd, r->deadline);
+		if (done != 0)
+			return (done);
+		n = read(r->fd, &c, 1);
+		if (n < 0 && errno == EINTR && g_signal_received != SIGINT)
+			continue ;
+		if (n <= 0)
+			return (read_status(n));
+		done = read_feed(r, c);
+	}
+	if (done == -1)
+		return (read_status(-1));
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Read the input of the read builtin up to its delimiter.
+ *
+ * A terminal is switched out of line mode for -n and -d, as in bash.
+ *
+ * @param r Options, receives the line
+ * @return 0 when the delimiter (or the -n count) was reached, 1 at end
+ *         of file or on error, READ_TIMEOUT_STATUS or EXIT_SIGINT
+ */
+int	read_input(t_read *r)
+{
+	struct stat		st;
+	struct termios	saved;
+	bool			raw;
+	int				status;
+
+	if (r->nchars == 0)
+		return (EXIT_SUCCESS);
+	if (fstat(r->fd, &st) == 0 && S_ISREG(st.st_mode))
+		return (read_block(r));
+	raw = ((r->nchars > 0 || r->delim != '\n')
+			&& read_term_raw(r->fd, &saved));
+	status = read_bytes(r);
+	if (raw)
+		tcsetattr(r->fd, TCSANOW, &saved);
+	return (status);
+}
@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_opts.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:45:09 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:45:09 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Report a misused option of read, followed by the usage.
+ *
+ * @param opt Option, as "-x"
+ * @param msg Reason
+ * @param data Shell state structure
+ * @return MISUSAGE_ERROR
+ */
+static int	read_usage(const char *opt, const char *msg, t_shell *data)
+{
+	print_error(ERR_PREFIX, ERR_READ, (char *)opt, (char *)msg);
+	print_error(ERR_PREFIX, ERR_READ, ERR_READ_USAGE, NULL);
+	data->status = MISUSAGE_ERROR;
+	return (data->status);
+}
+
+/**
+ * @brief Parse the timeout of -t: seconds, with an optional fraction.
+ *
+ * @param s Argument of -t
+ * @param ms Receives the timeout in milliseconds
+ * @return true if the argument is a valid timeout
+ */
+static bool	parse_timeout(const char *s, long long *ms)
+{
+	long long	sec;
+	long long	frac;
+	int			digits;
+
+	if (!ft_isdigit(*s) && !(*s == '.' && ft_isdigit(s[1])))
+		return (false);
+	sec = 0;
+	while (ft_isdigit(*s))
+	{
+		if (sec < INT_MAX)
+			sec = sec * 10 + (*s - '0');
+		s++;
+	}
+	frac = 0;
+	digits = 0;
+	if (*s == '.')
+		s++;
+	while (ft_isdigit(*s) && digits++ < 3)
+		frac = frac * 10 + (*s++ - '0');
+	while (ft_isdigit(*s))
+		s++;
+	while (digits++ < 3)
+		frac *= 10;
+	*ms = sec * 1000 + frac;
+	return (*s == '\0');
+}
+
+/**
+ * @brief Store the value of -d, -n or -t.
+ *
+ * @param r Options of the command
+ * @param opt Option letter
+ * @param value Its argument
+ * @param data Shell state structure
+ * @return 0 on success, 1 if the value is invalid
+ */
+static int	set_option(t_read *r, char opt, const char *value, t_shell *data)
+{
+	long long	n;
+
+	if (opt == 'd')
+	{
+		r->delim = value[0];
+		return (0);
+	}
+	if (opt == 't' && !parse_timeout(value, &r->deadline))
+		print_error(ERR_PREFIX, ERR_READ, (char *)value, ERR_READ_TIMEOUT);
+	else if (opt == 'n' && (ft_safe_atoll(value, &n) != 1 || n < 0))
+		print_error(ERR_PREFIX, ERR_READ, (char *)value, ERR_READ_NUM);
+	else
+	{
+		if (opt == 'n')
+			r->nchars = n;
+		return (0);
+	}
+	data->status = EXIT_FAILURE;
+	return (data->status);
+}
+
+/**
+ * @brief Parse one option word, like `-r`, `-n3` or `-rd :`.
+ *
+ * The letter taking a value ends the word: the rest of it, or the next
+ * word, is the value.
+ *
+ * @param r Options of the command
+ * @param argv Command argv
+ * @param i Index of the word (advanced past a separate value)
+ * @param data Shell state structure
+ * @return 0 on success, the exit status of the command on error
+ */
+static int	read_option(t_read *r, char **argv, int *i, t_shell *data)
+{
+	char		opt[3];
+	const char	*word;
+
+	word = argv[*i] + 1;
+	while (*word == 'r')
+		r->raw = (*word++ == 'r');
+	if (!*word)
+		return (0);
+	opt[0] = '-';
+	opt[1] = *word;
+	opt[2] = '\0';
+	if (!ft_strchr("dnt", *word))
+		return (read_usage(opt, ERR_READ_OPT, data));
+	if (!*++word)
+		word = argv[++*i];
+	if (!word)
+		return (read_usage(opt, ERR_OPTION_ARG, data));
+	return (set_option(r, opt[1], word, data));
+}
+
+/**
+ * @brief Set the defaults of read, then parse its options.
+ *
+ * IFS is looked up here, before anything is read.
+ *
+ * @param r Receives the options
+ * @param argv Command argv
+ * @param data Shell state structure
+ * @return Index of the first name in argv, or -1 on error
+ */
+int	read_options(t_read *r, char **argv, t_shell *data)
+{
+	t_env	*ifs;
+	int		i;
+
+	ft_bzero(r, sizeof(*r));
+	r->fd = STDIN_FILENO;
+	r->delim = '\n';
+	r->nchars = -1;
+	r->deadline = -1;
+	r->ifs = READ_DEFAULT_IFS;
+	ifs = get_env_node_by_key(data->env_list, "IFS");
+	if (ifs && ifs->value)
+		r->ifs = ifs->value;
+	i = 1;
+	while (argv[i] && argv[i][0] == '-' && argv[i][1]
+		&& ft_strcmp(argv[i], "--") != 0)
+	{
+		if (read_option(r, argv, &i, data) != 0)
+			return (-1);
+		i++;
+	}
+	if (argv[i] && ft_strcmp(argv[i], "--") == 0)
+		i++;
+	return (i);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_split.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:45:09 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:45:09 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tell whether a byte of the line separates fields.
+ *
+ * @param r Line read, with its mask of escaped bytes and IFS
+ * @param i Position in the line
+ * @return 0 for a field byte, 1 for an IFS space, tab or newline, 2 for
+ *         another IFS character
+ */
+static int	sep_kind(const t_read *r, size_t i)
+{
+	char	c;
+
+	c = r->line.data[i];
+	if (r->quoted.data[i] || !c || !ft_strchr(r->ifs, c))
+		return (0);
+	if (c == ' ' || c == '\t' || c == '\n')
+		return (1);
+	return (2);
+}
+
+/**
+ * @brief Skip the separator after a field: IFS white space around at
+ * most one other IFS character.
+ *
+ * @param r Line read
+ * @param i Position after the field
+ * @return Position of the next field
+ */
+static size_t	skip_separator(const t_read *r, size_t i)
+{
+	while (i < r->line.len && sep_kind(r, i) == 1)
+		i++;
+	if (i < r->line.len && sep_kind(r, i) == 2)
+		i++;
+	while (i < r->line.len && sep_kind(r, i) == 1)
+		i++;
+	return (i);
+}
+
+/**
+ * @brief Get the length of the rest of the line, for the last name.
+ *
+ * Trailing IFS white space is removed, and so is a final separator that
+ * ends the only field left (`a:` gives `a`, `a::` stays).
+ *
+ * @param r Line read
+ * @param start Position of the rest of the line
+ * @return Its length
+ */
+static size_t	last_field_len(const t_read *r, size_t start)
+{
+	size_t	end;
+	size_t	i;
+
+	end = r->line.len;
+	while (end > start && sep_kind(r, end - 1) == 1)
+		end--;
+	if (end == start || sep_kind(r, end - 1) != 2)
+		return (end - start);
+	i = start;
+	while (sep_kind(r, i) == 0)
+		i++;
+	if (i == end - 1)
+		end--;
+	return (end - start);
+}
+
+/**
+ * @brief Assign a part of the line to a variable.
+ *
+ * @param data Shell state structure
+ * @param name Variable
+ * @param s Start of the value in the line (one byte past it is writable)
+ * @param len Length of the value
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	assign_field(t_shell *data, const char *name, char *s, size_t len)
+{
+	char	saved;
+	int		ret;
+
+	saved = s[len];
+	s[len] = '\0';
+	ret = set_env_value(&data->env_list, name, s);
+	s[len] = saved;
+	return (ret);
+}
+
+/**
+ * @brief Split the line read on IFS and assign the fields to the names.
+ *
+ * Without names, REPLY gets the whole line. Names left without a field
+ * are set to the empty string.
+ *
+ * @param r Line read
+ * @param names Variables to assign
+ * @param data Shell state structure
+ * @return 0 on success, -1 on allocation failure
+ */
+int	read_assign(t_read *r, char **names, t_shell *data)
+{
+	size_t	i;
+	size_t	end;
+
+	if (strbuf_reserve(&r->line, 0) == -1)
+		return (-1);
+	if (!*names)
+		return (assign_field(data, READ_DEFAULT_VAR, r->line.data,
+				r->line.len));
+	i = 0;
+	while (i < r->line.len && sep_kind(r, i) == 1)
+		i++;
+	while (names[1])
+	{
+		end = i;
+		while (end < r->line.len && sep_kind(r, end) == 0)
+			end++;
+		if (assign_field(data, *names++, r->line.data + i, end - i) == -1)
+			return (-1);
+		i = skip_separator(r, end);
+	}
+	return (assign_field(data, *names, r->line.data + i,
+			last_field_len(r, i)));
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_wait.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:45:09 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:45:09 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Read the monotonic clock.
+ *
+ * @return Milliseconds since an arbitrary point
+ */
+long long	read_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+/**
+ * @brief Wait until an input is readable, or the deadline has passed.
+ *
+ * A deadline already passed still polls once, which is how `read -t 0`
+ * checks for waiting input.
+ *
+ * @param fd Input
+ * @param deadline Time limit, in read_now() milliseconds
+ * @return 0 when readable (or on a poll() error, left to read() to
+ *         report), READ_TIMEOUT_STATUS after the deadline, EXIT_SIGINT
+ *         on SIGINT
+ */
+int	read_wait(int fd, long long deadline)
+{
+	struct pollfd	pfd;
+	long long		left;
+	int				ret;
+
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	while (1)
+	{
+		left = deadline - read_now();
+		if (left < 0)
+			left = 0;
+		if (left > INT_MAX)
+			left = INT_MAX;
+		ret = poll(&pfd, 1, (int)left);
+		if (ret > 0 || (ret < 0 && errno != EINTR))
+			return (0);
+		if (ret < 0 && g_signal_received == SIGINT)
+			return (EXIT_SIGINT);
+		if (ret == 0 && left < INT_MAX)
+			return (READ_TIMEOUT_STATUS);
+	}
+}
+
+/**
+ * @brief Let a terminal deliver each byte as soon as it is typed.
+ *
+ * Used for -n and -d, which must end the read without waiting for the
+ * end of the line. Echo and signals keep working.
+ *
+ * @param fd Input
+ * @param saved Receives the settings to restore
+ * @return true if fd is a terminal whose settings were changed
+ */
+bool	read_term_raw(int fd, struct termios *saved)
+{
+	struct termios	raw;
+
+	if (!isatty(fd) || tcgetattr(fd, saved) == -1)
+		return (false);
+	raw = *saved;
+	raw.c_lflag &= ~ICANON;
+	raw.c_cc[VMIN] = 1;
+	raw.c_cc[VTIME] = 0;
+	return (tcsetattr(fd, TCSANOW, &raw) == 0);
+}
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   return.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:01:15 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:01:15 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Builtin command: return [n]
+ *
+ * Leaves the current shell function with status n (the status of the
+ * last command by default). The remaining commands of the body are
+ * skipped through `data->returning`, like `break` does for loops.
+ *
+ * @param argv Command argv (argv[0] is "return")
+ * @param data Shell state structure
+ * @return Exit status stored in `data->status`
+ */
+int	builtin_return(char **argv, t_shell *data)
+{
+	long long	code;
+
+	if (data->func_depth == 0)
+	{
+		print_error(ERR_PREFIX, ERR_RETURN, ERR_RETURN_ONLY, NULL);
+		data->status = MISUSAGE_ERROR;
+		return (data->status);
+	}
+	data->returning = true;
+	if (!argv[1])
+		return (data->status);
+	if (ft_safe_atoll(argv[1], &code) != 1)
+	{
+		print_error(ERR_PREFIX, ERR_RETURN, argv[1], ERR_NUMERIC_ARG);
+		data->status = MISUSAGE_ERROR;
+		return (data->status);
+	}
+	if (argv[2])
+	{
+		print_error(ERR_PREFIX, ERR_RETURN, ERR_TOO_MANY_ARGS, NULL);
+		data->status = EXIT_FAILURE;
+		return (data->status);
+	}
+	data->status = (unsigned char)code;
+	return (data->status);
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sleep.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:50:51 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:50:51 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Get the length of a time unit suffix.
+ *
+ * @param c Suffix: none or 's' (seconds), 'm', 'h' or 'd'
+ * @return Its length in seconds, 0 for an unknown suffix
+ */
+static long long	unit_seconds(char c)
+{
+	if (c == '\0' || c == 's')
+		return (1);
+	if (c == 'm')
+		return (60);
+	if (c == 'h')
+		return (3600);
+	if (c == 'd')
+		return (86400);
+	return (0);
+}
+
+/**
+ * @brief Read a number of seconds with an optional fraction.
+ *
+ * @param s Operand
+ * @param sec Receives the whole seconds, capped to SLEEP_MAX_SECONDS
+ * @param nsec Receives the fraction, in nanoseconds
+ * @return First character after the number, NULL if there is none
+ */
+static const char	*parse_seconds(const char *s, long long *sec,
+	long long *nsec)
+{
+	long long	scale;
+
+	if (!ft_isdigit(*s) && !(*s == '.' && ft_isdigit(s[1])))
+		return (NULL);
+	*sec = 0;
+	while (ft_isdigit(*s))
+	{
+		if (*sec < SLEEP_MAX_SECONDS)
+			*sec = *sec * 10 + (*s - '0');
+		s++;
+	}
+	*nsec = 0;
+	scale = 100000000;
+	if (*s == '.')
+		s++;
+	while (ft_isdigit(*s))
+	{
+		*nsec += (*s++ - '0') * scale;
+		scale /= 10;
+	}
+	return (s);
+}
+
+/**
+ * @brief Parse an interval like `2`, `0.25` or `1.5m` and add it.
+ *
+ * @param s Operand
+ * @param total Receives the sum of the intervals, capped to
+ *              SLEEP_MAX_SECONDS
+ * @return true if the operand is a valid interval
+ */
+static bool	add_interval(const char *s, struct timespec *total)
+{
+	long long	sec;
+	long long	nsec;
+	long long	unit;
+
+	s = parse_seconds(s, &sec, &nsec);
+	if (!s)
+		return (false);
+	unit = unit_seconds(*s);
+	if (unit == 0 || (*s && s[1]))
+		return (false);
+	nsec = total->tv_nsec + nsec * unit;
+	total->tv_sec += sec * unit + nsec / 1000000000;
+	total->tv_nsec = nsec % 1000000000;
+	if (total->tv_sec > SLEEP_MAX_SECONDS)
+		total->tv_sec = SLEEP_MAX_SECONDS;
+	return (true);
+}
+
+/**
+ * @brief Wait with clock_nanosleep() on the monotonic clock.
+ *
+ * A signal handled by the shell resumes the wait for the time left,
+ * except SIGINT, which ends it.
+ *
+ * @param total Interval
+ * @return 0 after the full wait, 130 on SIGINT
+ */
+static int	sleep_for(struct timespec *total)
+{
+	struct timespec	left;
+
+	while (clock_nanosleep(CLOCK_MONOTONIC, 0, total, &left) == EINTR)
+	{
+		if (g_signal_received == SIGINT)
+			return (EXIT_SIGINT);
+		*total = left;
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Builtin command: sleep interval ...
+ *
+ * Waits for the sum of the intervals without a process, so a polling
+ * loop costs one system call per pass instead of a fork and an exec.
+ *
+ * @param argv Command argv (argv[0] is "sleep")
+ * @param data Shell state structure
+ * @return 0 after the full wait, 1 on an invalid operand, 130 on SIGINT
+ */
+int	builtin_sleep(char **argv, t_shell *data)
+{
+	struct timespec	total;
+	int				i;
+
+	total.tv_sec = 0;
+	total.tv_nsec = 0;
+	if (argv[1] && ft_strcmp(argv[1], "--") == 0)
+		argv++;
+	data->status = EXIT_FAILURE;
+	if (!argv[1])
+		print_error(ERR_PREFIX, ERR_SLEEP, ERR_SLEEP_MISSING, NULL);
+	i = 1;
+	while (argv[i] && add_interval(argv[i], &total))
+		i++;
+	if (argv[i])
+		print_error(ERR_PREFIX, ERR_SLEEP ERR_SLEEP_TIME, argv[i], "'");
+	if (!argv[1] || argv[i])
+		return (data->status);
+	data->status = sleep_for(&total);
+	return (data->status);
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:34:49 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:34:49 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Report the first error of a test command on stderr.
+ *
+ * Prints "[mini$HELL]: test: <arg><msg>"; later errors of the same
+ * command are not reported.
+ *
+ * @param t Test being evaluated
+ * @param arg Operand at fault (can be NULL)
+ * @param msg Message
+ */
+void	test_error(t_test *t, const char *arg, const char *msg)
+{
+	if (t->error)
+		return ;
+	t->error = true;
+	out_str(STDERR_FILENO, ERR_PREFIX);
+	out_str(STDERR_FILENO, t->name);
+	out_str(STDERR_FILENO, ": ");
+	out_str(STDERR_FILENO, arg);
+	out_str(STDERR_FILENO, msg);
+	out_char(STDERR_FILENO, '\n');
+}
+
+/**
+ * @brief Evaluate a test of two operands: `! s` or a unary operator.
+ *
+ * @param t Test being evaluated
+ * @param av The two operands
+ * @return Result of the test
+ */
+static bool	test_two(t_test *t, char **av)
+{
+	if (ft_strcmp(av[0], "!") == 0)
+		return (av[1][0] == '\0');
+	if (is_unary_op(av[0]))
+		return (test_unary(t, av[0], av[1]));
+	test_error(t, av[0], ERR_TEST_UNARY);
+	return (false);
+}
+
+/**
+ * @brief Evaluate a test of three operands.
+ *
+ * A binary operator in the middle wins, then `-a`/`-o` between two
+ * strings, `! a b` and `( s )`.
+ *
+ * @param t Test being evaluated
+ * @param av The three operands
+ * @return Result of the test
+ */
+static bool	test_three(t_test *t, char **av)
+{
+	if (is_binary_op(av[1]))
+		return (test_binary(t, av[0], av[1], av[2]));
+	if (ft_strcmp(av[1], "-a") == 0)
+		return (av[0][0] != '\0' && av[2][0] != '\0');
+	if (ft_strcmp(av[1], "-o") == 0)
+		return (av[0][0] != '\0' || av[2][0] != '\0');
+	if (ft_strcmp(av[0], "!") == 0)
+		return (!test_two(t, av + 1));
+	if (ft_strcmp(av[0], "(") == 0 && ft_strcmp(av[2], ")") == 0)
+		return (av[1][0] != '\0');
+	test_error(t, av[1], ERR_TEST_BINARY);
+	return (false);
+}
+
+/**
+ * @brief Evaluate a test by its number of operands, as POSIX specifies.
+ *
+ * Up to four operands the meaning only depends on their count, so that
+ * `test -n = -n` or `[ ! = x ]` compare strings. Longer tests are parsed
+ * as expressions with `!`, `(`, `)`, `-a` and `-o`.
+ *
+ * @param t Test to evaluate
+ * @return Result of the test
+ */
+static bool	test_posix(t_test *t)
+{
+	char	**av;
+
+	av = t->argv;
+	if (t->argc == 0)
+		return (false);
+	if (t->argc == 1)
+		return (av[0][0] != '\0');
+	if (t->argc == 2)
+		return (test_two(t, av));
+	if (t->argc == 3)
+		return (test_three(t, av));
+	if (t->argc == 4 && ft_strcmp(av[0], "!") == 0)
+		return (!test_three(t, av + 1));
+	if (t->argc == 4 && ft_strcmp(av[0], "(") == 0
+		&& ft_strcmp(av[3], ")") == 0)
+		return (test_two(t, av + 1));
+	return (test_expression(t));
+}
+
+/**
+ * @brief Builtin command: test expr, [ expr ]
+ *
+ * Evaluates string, integer and file predicates in the shell process, so
+ * an `if` or `while` condition needs no fork. `[` requires a last `]`.
+ *
+ * @param argv Command argv (argv[0] is "test" or "[")
+ * @param data Shell state structure
+ * @return 0 if the expression is true, 1 if false, 2 if it is invalid
+ */
+int	builtin_test(char **argv, t_shell *data)
+{
+	t_test	t;
+	bool	result;
+
+	t.name = argv[0];
+	t.argv = argv + 1;
+	t.argc = 0;
+	t.pos = 0;
+	t.error = false;
+	while (t.argv[t.argc])
+		t.argc++;
+	if (ft_strcmp(argv[0], "[") == 0)
+	{
+		if (t.argc == 0 || ft_strcmp(t.argv[t.argc - 1], "]") != 0)
+			test_error(&t, NULL, ERR_TEST_BRACKET);
+		else
+			t.argc--;
+	}
+	result = false;
+	if (!t.error)
+		result = test_posix(&t);
+	data->status = !result;
+	if (t.error)
+		data->status = MISUSAGE_ERROR;
+	return (data->status);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_expr.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:34:49 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:34:49 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Evaluate a parenthesized expression, the `(` already consumed.
+ *
+ * @param t Test being evaluated
+ * @return Result of the expression
+ */
+static bool	test_group(t_test *t)
+{
+	bool	result;
+
+	result = test_or(t);
+	if (t->pos >= t->argc || ft_strcmp(t->argv[t->pos], ")") != 0)
+	{
+		test_error(t, NULL, ERR_TEST_PAREN);
+		return (false);
+	}
+	t->pos++;
+	return (result);
+}
+
+/**
+ * @brief Evaluate `! term`, `( expr )`, `a OP b`, `-OP a` or a string.
+ *
+ * A binary operator after the operand is tried first, so `-f = -f`
+ * compares two strings.
+ *
+ * @param t Test being evaluated
+ * @return Result of the term
+ */
+static bool	test_primary(t_test *t)
+{
+	const char	*arg;
+
+	if (t->pos >= t->argc)
+	{
+		test_error(t, NULL, ERR_TEST_ARG);
+		return (false);
+	}
+	arg = t->argv[t->pos++];
+	if (ft_strcmp(arg, "!") == 0)
+		return (!test_primary(t));
+	if (ft_strcmp(arg, "(") == 0)
+		return (test_group(t));
+	if (t->pos + 1 < t->argc && is_binary_op(t->argv[t->pos]))
+	{
+		t->pos += 2;
+		return (test_binary(t, arg, t->argv[t->pos - 2],
+				t->argv[t->pos - 1]));
+	}
+	if (is_unary_op(arg) && t->pos < t->argc)
+		return (test_unary(t, arg, t->argv[t->pos++]));
+	return (arg[0] != '\0');
+}
+
+/**
+ * @brief Evaluate terms joined by `-a`.
+ *
+ * @param t Test being evaluated
+ * @return Result of the conjunction
+ */
+static bool	test_and(t_test *t)
+{
+	bool	result;
+
+	result = test_primary(t);
+	while (t->pos < t->argc && ft_strcmp(t->argv[t->pos], "-a") == 0)
+	{
+		t->pos++;
+		result = (test_primary(t) && result);
+	}
+	return (result);
+}
+
+/**
+ * @brief Evaluate conjunctions joined by `-o` (lowest precedence).
+ *
+ * @param t Test being evaluated
+ * @return Result of the disjunction
+ */
+bool	test_or(t_test *t)
+{
+	bool	result;
+
+	result = test_and(t);
+	while (t->pos < t->argc && ft_strcmp(t->argv[t->pos], "-o") == 0)
+	{
+		t->pos++;
+		result = (test_and(t) || result);
+	}
+	return (result);
+}
+
+/**
+ * @brief Evaluate a whole test expression of more than four operands.
+ *
+ * @param t Test to evaluate
+ * @return Result of the expression
+ */
+bool	test_expression(t_test *t)
+{
+	bool	result;
+
+	result = test_or(t);
+	if (t->pos < t->argc)
+		test_error(t, NULL, ERR_TOO_MANY_ARGS);
+	return (result);
+}
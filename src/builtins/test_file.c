@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_file.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:34:49 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:34:49 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check a file type operator (`-f`, `-d`, `-b`, `-c`, `-p`, `-S`,
+ * `-h`, `-L`) against a status.
+ *
+ * @param op Operator letter
+ * @param st Status of the file
+ * @return true if the type matches
+ */
+static bool	type_matches(char op, const struct stat *st)
+{
+	static const char	types[] = "fdbcpShL";
+	static const mode_t	modes[] = {S_IFREG, S_IFDIR, S_IFBLK, S_IFCHR,
+		S_IFIFO, S_IFSOCK, S_IFLNK, S_IFLNK};
+
+	return ((st->st_mode & S_IFMT) == modes[ft_strchr(types, op) - types]);
+}
+
+/**
+ * @brief Evaluate a file operator from the status of its file.
+ *
+ * @param op Operator letter (see TEST_UNARY_OPS)
+ * @param st Status of the file
+ * @return Result of the test
+ */
+static bool	mode_matches(char op, const struct stat *st)
+{
+	if (op == 'e')
+		return (true);
+	if (op == 's')
+		return (st->st_size > 0);
+	if (op == 'g')
+		return ((st->st_mode & S_ISGID) != 0);
+	if (op == 'u')
+		return ((st->st_mode & S_ISUID) != 0);
+	if (op == 'k')
+		return ((st->st_mode & S_ISVTX) != 0);
+	return (type_matches(op, st));
+}
+
+/**
+ * @brief Evaluate a file operator (`-e FILE`, `-d FILE`, `-r FILE`, ...).
+ *
+ * One fstatat() per operand; `-h`/`-L` do not follow the last symlink.
+ * Permissions are asked to the kernel for the effective ids, which is
+ * what would apply when opening or running the file.
+ *
+ * @param op Operator letter (see TEST_UNARY_OPS)
+ * @param path File operand
+ * @return Result of the test, false if the file does not exist
+ */
+bool	test_file(char op, const char *path)
+{
+	struct stat	st;
+	int			flags;
+
+	if (op == 'r')
+		return (faccessat(AT_FDCWD, path, R_OK, AT_EACCESS) == 0);
+	if (op == 'w')
+		return (faccessat(AT_FDCWD, path, W_OK, AT_EACCESS) == 0);
+	if (op == 'x')
+		return (faccessat(AT_FDCWD, path, X_OK, AT_EACCESS) == 0);
+	flags = 0;
+	if (op == 'h' || op == 'L')
+		flags = AT_SYMLINK_NOFOLLOW;
+	if (fstatat(AT_FDCWD, path, &st, flags) == -1)
+		return (false);
+	return (mode_matches(op, &st));
+}
+
+/**
+ * @brief Check if a file was modified after another one.
+ *
+ * @param a Status of the first file, NULL if it does not exist
+ * @param b Status of the second file, NULL if it does not exist
+ * @return true if a exists and is newer than b, or b does not exist
+ */
+static bool	is_newer(const struct stat *a, const struct stat *b)
+{
+	if (!a)
+		return (false);
+	if (!b)
+		return (true);
+	if (a->st_mtim.tv_sec != b->st_mtim.tv_sec)
+		return (a->st_mtim.tv_sec > b->st_mtim.tv_sec);
+	return (a->st_mtim.tv_nsec > b->st_mtim.tv_nsec);
+}
+
+/**
+ * @brief Compare two files with `-nt`, `-ot` or `-ef`.
+ *
+ * @param left Left file operand
+ * @param op Operator
+ * @param right Right file operand
+ * @return Result of the test
+ */
+bool	test_file_cmp(const char *left, const char *op, const char *right)
+{
+	struct stat	st[2];
+	struct stat	*a;
+	struct stat	*b;
+
+	a = NULL;
+	b = NULL;
+	if (fstatat(AT_FDCWD, left, &st[0], 0) == 0)
+		a = &st[0];
+	if (fstatat(AT_FDCWD, right, &st[1], 0) == 0)
+		b = &st[1];
+	if (ft_strcmp(op, "-ef") == 0)
+		return (a && b && a->st_dev == b->st_dev && a->st_ino == b->st_ino);
+	if (ft_strcmp(op, "-ot") == 0)
+		return (is_newer(b, a));
+	return (is_newer(a, b));
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_ops.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:34:49 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:34:49 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if an operand is a unary test operator (`-f`, `-z`, ...).
+ *
+ * @param s Operand
+ * @return true for one of TEST_UNARY_OPS
+ */
+bool	is_unary_op(const char *s)
+{
+	return (s[0] == '-' && s[1] && !s[2] && ft_strchr(TEST_UNARY_OPS, s[1]));
+}
+
+/**
+ * @brief Check if an operand is a binary test operator.
+ *
+ * `-a` and `-o` are not: they join expressions.
+ *
+ * @param s Operand
+ * @return true for a string, integer or file comparison
+ */
+bool	is_binary_op(const char *s)
+{
+	size_t				i;
+	static const char	*ops[] = {"=", "==", "!=", "<", ">", "-eq", "-ne",
+		"-lt", "-le", "-gt", "-ge", "-nt", "-ot", "-ef", NULL};
+
+	i = 0;
+	while (ops[i] && ft_strcmp(s, ops[i]) != 0)
+		i++;
+	return (ops[i] != NULL);
+}
+
+/**
+ * @brief Evaluate a unary operator.
+ *
+ * @param t Test being evaluated
+ * @param op Operator (is_unary_op())
+ * @param arg Its operand
+ * @return Result of the test
+ */
+bool	test_unary(t_test *t, const char *op, const char *arg)
+{
+	long long	fd;
+
+	if (op[1] == 'z')
+		return (arg[0] == '\0');
+	if (op[1] == 'n')
+		return (arg[0] != '\0');
+	if (op[1] == 't')
+	{
+		if (!ft_safe_atoll(arg, &fd))
+		{
+			test_error(t, arg, ERR_TEST_INT);
+			return (false);
+		}
+		return (fd >= 0 && fd <= INT_MAX && isatty((int)fd));
+	}
+	return (test_file(op[1], arg));
+}
+
+/**
+ * @brief Compare two integers with `-eq`, `-ne`, `-lt`, `-le`, `-gt`, `-ge`.
+ *
+ * @param a Left operand
+ * @param op Operator
+ * @param b Right operand
+ * @return Result of the comparison
+ */
+static bool	compare_integers(long long a, const char *op, long long b)
+{
+	if (ft_strcmp(op, "-eq") == 0)
+		return (a == b);
+	if (ft_strcmp(op, "-ne") == 0)
+		return (a != b);
+	if (ft_strcmp(op, "-lt") == 0)
+		return (a < b);
+	if (ft_strcmp(op, "-le") == 0)
+		return (a <= b);
+	if (ft_strcmp(op, "-gt") == 0)
+		return (a > b);
+	return (a >= b);
+}
+
+/**
+ * @brief Evaluate a binary operator.
+ *
+ * @param t Test being evaluated
+ * @param left Left operand
+ * @param op Operator (is_binary_op())
+ * @param right Right operand
+ * @return Result of the test
+ */
+bool	test_binary(t_test *t, const char *left, const char *op,
+	const char *right)
+{
+	long long	a;
+	long long	b;
+
+	if (ft_strcmp(op, "=") == 0 || ft_strcmp(op, "==") == 0)
+		return (ft_strcmp(left, right) == 0);
+	if (ft_strcmp(op, "!=") == 0)
+		return (ft_strcmp(left, right) != 0);
+	if (ft_strcmp(op, "<") == 0)
+		return (ft_strcmp(left, right) < 0);
+	if (ft_strcmp(op, ">") == 0)
+		return (ft_strcmp(left, right) > 0);
+	if (ft_strcmp(op, "-nt") == 0 || ft_strcmp(op, "-ot") == 0
+		|| ft_strcmp(op, "-ef") == 0)
+		return (test_file_cmp(left, op, right));
+	if (!ft_safe_atoll(left, &a))
+	{
+		test_error(t, left, ERR_TEST_INT);
+		return (false);
+	}
+	if (!ft_safe_atoll(right, &b))
+	{
+		test_error(t, right, ERR_TEST_INT);
+		return (false);
+	}
+	return (compare_integers(a, op, b));
+}
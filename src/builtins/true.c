@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   true.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:50:51 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:50:51 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Builtin commands: true [arguments], : [arguments]
+ *
+ * Polling loops (`while true`, `while :`) test their condition on every
+ * pass; as a builtin it costs no process.
+ *
+ * @param argv Command argv (ignored)
+ * @param data Shell state structure
+ * @return 0
+ */
+int	builtin_true(char **argv, t_shell *data)
+{
+	(void)argv;
+	data->status = EXIT_SUCCESS;
+	return (data->status);
+}
+
+/**
+ * @brief Builtin command: false [arguments]
+ *
+ * @param argv Command argv (ignored)
+ * @param data Shell state structure
+ * @return 1
+ */
+int	builtin_false(char **argv, t_shell *data)
+{
+	(void)argv;
+	data->status = EXIT_FAILURE;
+	return (data->status);
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:40:13 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:40:13 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:10:45 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,8 +15,8 @@
 /**
  * @brief Frees an environment variable node and its list node.
  *
- * Frees the key and value strings, the t_env struct, and the associated
- * t_list node. Does nothing if either pointer is NULL.
+ * Frees the entry string, the t_env struct, and the associated t_list
+ * node. Does nothing if either pointer is NULL.
  *
  * @param env_node   Pointer to the environment variable struct to free.
  * @param list_node  Pointer to the list node containing env_node.
@@ -25,8 +25,7 @@ static void	free_env_node(t_env *env_node, t_list *list_node)
 {
 	if (!env_node || !list_node)
 		return ;
-	free(env_node->key);
-	free(env_node->value);
+	free(env_node->entry);
 	free(env_node);
 	free(list_node);
 }
@@ -34,9 +33,8 @@ static void	free_env_node(t_env *env_node, t_list *list_node)
 /**
  * @brief Removes an environment variable node from the linked list by key.
  *
- * Searches the env_list for a node whose key matches the given string.
- * If found, the node is unlinked from the list and freed using free_env_node().
- * Handles removal of the head node as a special case.
+ * Finds the node's link in the sorted env_list. If the key is there, the
+ * node is unlinked from the list and freed using free_env_node().
  *
  * @param env_list  Pointer to the head of the environment list.
  * @param key       Key string of the environment variable to remove.
@@ -46,30 +44,20 @@ static void	free_env_node(t_env *env_node, t_list *list_node)
  */
 int	remove_env_node(t_list **env_list, const char *arg)
 {
-	t_list	*prev;
+	t_list	**slot;
 	t_list	*curr;
-	t_env	*env;
+	size_t	len;
 
-	prev = NULL;
-	curr = *env_list;
 	if (!env_list || !*env_list || !arg)
 		return (1);
-	while (curr)
-	{
-		env = (t_env *)curr->content;
-		if (env && env->key && ft_strcmp(env->key, arg) == 0)
-		{
-			if (prev)
-				prev->next = curr->next;
-			else
-				*env_list = curr->next;
-			free_env_node(env, curr);
-			return (0);
-		}
-		prev = curr;
-		curr = curr->next;
-	}
-	return (1);
+	len = ft_strlen(arg);
+	slot = env_find_slot(env_list, arg, len);
+	if (!env_slot_var(slot, arg, len))
+		return (1);
+	curr = *slot;
+	*slot = curr->next;
+	free_env_node(curr->content, curr);
+	return (0);
 }
 
 /**
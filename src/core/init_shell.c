@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:40:26 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/16 13:25:07 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 04:39:36 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -27,7 +27,6 @@ static void	update_shlvl(t_list **env_list)
 	t_env	*shlvl;
 	int		level;
 	int		status;
-	char	*new_value;
 
 	shlvl = get_env_node_by_key(*env_list, "SHLVL");
 	if (shlvl)
@@ -36,14 +35,8 @@ static void	update_shlvl(t_list **env_list)
 		if (status == 0 || level < 0)
 			level = 0;
 		level++;
-		new_value = ft_itoa(level);
-		if (!new_value)
-		{
-			ft_putendl_fd("failed to update SHLVL", 2);
-			return ;
-		}
-		free(shlvl->value);
-		shlvl->value = new_value;
+		if (set_env_number(env_list, "SHLVL", level) == -1)
+			print_error("failed to update SHLVL", NULL, NULL, NULL);
 	}
 	else
 	{
@@ -91,6 +84,17 @@ int	init_shell(t_shell *data, char **envp)
 	data->is_tty = is_interactive_mode();
 	data->is_child = false;
 	data->should_exit = false;
+	data->loop_depth = 0;
+	data->break_count = 0;
+	data->continue_count = 0;
 	data->curr_ast = NULL;
+	ft_bzero(data->functions, sizeof(data->functions));
+	data->retired_bodies = NULL;
+	data->func_depth = 0;
+	data->returning = false;
+	data->aborting = false;
+	data->can_exec = false;
+	data->pos_params = NULL;
+	ft_bzero(&data->dir_cache, sizeof(t_dircache));
 	return (0);
 }
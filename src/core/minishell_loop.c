@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:40:29 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:40:30 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 04:39:36 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -58,7 +58,7 @@ bool	prompt_user(char *prompt, t_shell *data)
 	if (data->is_tty)
 		line = readline(prompt);
 	else
-		line = get_next_line(STDIN_FILENO);
+		line = read_script_line(STDIN_FILENO);
 	if (g_signal_received == SIGINT)
 	{
 		g_signal_received = 0;
@@ -78,62 +78,22 @@ bool	prompt_user(char *prompt, t_shell *data)
 	return (true);
 }
 
-/**
- * @brief Tokenize and validate the input command line.
- *
- * Converts the raw input line into a validated token list by performing:
- *  1. Tokenization via `execute_tokenizer`.
- *  2. Basic token validation with `validate_tokens`.
- *  3. Typed token list creation using `create_token_type_list`.
- *  4. Syntax validation through `validate_syntax_token_list`.
- *  5. Expansion of variables and wildcards.
- *  6. Quote trimming for final token cleanup.
- *
- * Memory cleanup is handled by the caller (`process_line`).
- *
- * @param line        Raw input command line.
- * @param data        Shell context containing environment and state.
- * @param tokens      Output pointer to store the string token array.
- * @param token_list  Output pointer to store the typed token list.
- * @return EXIT_SUCCESS on success,
- *         MISUSAGE_ERROR on syntax errors,
- *         or EXIT_FAILURE on memory or internal errors.
- */
-static int	process_tokens(char *line, t_shell *data,
-	char ***tokens, t_token **token_list)
-{
-	*tokens = execute_tokenizer(line, data);
-	if (!validate_tokens(*tokens))
-		return (EXIT_FAILURE);
-	*token_list = create_token_type_list(*tokens);
-	if (!*token_list)
-		return (EXIT_FAILURE);
-	if (validate_syntax_token_list(*token_list) != EXIT_SUCCESS)
-		return (MISUSAGE_ERROR);
-	if (expand_tokens_list(*token_list, data) != EXIT_SUCCESS)
-		return (EXIT_FAILURE);
-	if (trim_quotes_in_token_list(*token_list) != EXIT_SUCCESS)
-		return (EXIT_FAILURE);
-	return (EXIT_SUCCESS);
-}
-
 /**
  * @brief Process a single input line in the shell.
  *
  * This function performs the full lifecycle of processing a command line:
  *  1. Detects and displays Easter egg commands using `is_easter_egg` and
  * `display_easter_egg`.
- *  2. Adds non-empty lines to the command history (when running interactively).
- *  3. Tokenizes and validates the input via `process_tokens`.
- *  4. Builds an Abstract Syntax Tree (AST) from the token list using
- * `build_ast_from_tokens`.
- *  5. Executes the AST via `execute_ast_tree`.
- *  6. Cleans up all allocated memory (tokens, AST, and input line).
+ *  2. Parses the line into an AST via `parse_line`, reading continuation
+ * lines while a compound command (loop) is still open.
+ *  3. Adds the complete command to the history (when running interactively).
+ *  4. Executes the AST via `execute_ast_tree`.
+ *  5. Cleans up all allocated memory (AST and input line).
  *
  * The function returns the resulting exit status:
  *  - EXIT_SUCCESS (0) for successful execution or Easter eggs.
- *  - Syntax or validation errors propagate from `process_tokens`.
- *  - EXIT_FAILURE for allocation or internal errors.
+ *  - Syntax or validation errors propagate from `parse_line`.
+ *  - The previous status for a blank line.
  *  - The actual exit code of builtins or external commands otherwise.
  *
  * @param line The input command line to process.
@@ -143,28 +103,26 @@ static int	process_tokens(char *line, t_shell *data,
  */
 int	process_line(char *line, t_shell *data)
 {
-	char	**tokens;
 	t_ast	*ast;
-	t_token	*token_list;
+	int		status;
 
-	tokens = NULL;
-	ast = NULL;
-	token_list = NULL;
-	if (line)
-		add_history(line);
 	if (check_and_handle_easter_egg(line))
 		return (EXIT_SUCCESS);
-	data->status = process_tokens(line, data, &tokens, &token_list);
-	if (data->status != EXIT_SUCCESS)
-		return (cleanup_line(tokens, token_list, NULL, line), data->status);
-	ast = build_ast_from_tokens(token_list);
+	status = parse_line(&line, data, &ast);
+	if (data->is_tty && line)
+		add_history(line);
+	if (status != EXIT_SUCCESS)
+		return (cleanup_line(NULL, NULL, NULL, line), status);
 	if (!ast)
-		return (cleanup_line(tokens, token_list, NULL, line), EXIT_FAILURE);
+		return (cleanup_line(NULL, NULL, NULL, line), data->status);
 	if (preprocess_heredocs(ast, data) != EXIT_SUCCESS)
-		return (cleanup_line(tokens, token_list, ast, line), data->status);
+		return (cleanup_line(NULL, NULL, ast, line), data->status);
 	data->curr_ast = ast;
 	data->status = execute_ast_tree(ast, data);
 	data->curr_ast = NULL;
-	cleanup_line(tokens, token_list, ast, line);
+	data->aborting = false;
+	g_signal_received = 0;
+	free_dir_cache(data);
+	cleanup_line(NULL, NULL, ast, line);
 	return (data->status);
 }
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_continue.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:15:49 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:35:23 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Report why more input could not be read for an open command.
+ *
+ * @return Exit status for the abandoned command
+ */
+static int	handle_incomplete_input(void)
+{
+	if (g_signal_received == SIGINT)
+	{
+		g_signal_received = 0;
+		return (EXIT_SIGINT);
+	}
+	print_error(ERR_PREFIX, ERR_SYNTAX_EOF, NULL, NULL);
+	return (MISUSAGE_ERROR);
+}
+
+/**
+ * @brief Check if a line holds a word that can close a compound command.
+ *
+ * A command still open after a line can only be finished by a later
+ * `done`, `esac`, `}` or `)`: a line without one is not worth parsing
+ * the whole command again.
+ *
+ * @param tok Tokens of the line
+ * @return true if the line may finish the command
+ */
+static bool	may_close(t_token *tok)
+{
+	while (tok)
+	{
+		if (is_keyword(tok, "done") || is_keyword(tok, "esac")
+			|| is_keyword(tok, "}") || tok->op_type == OP_RPAREN)
+			return (true);
+		tok = tok->next;
+	}
+	return (false);
+}
+
+/**
+ * @brief Append the tokens of a line after the previous ones, separated
+ * by a newline token.
+ *
+ * @param tail A token of the command, advanced to the last one before
+ *             the new line (only the tokens after it are walked)
+ * @param added Tokens of the new line (may be NULL; freed on failure)
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	link_tokens(t_token **tail, t_token *added)
+{
+	t_token	*newline;
+	char	*sep[2];
+
+	while ((*tail)->next)
+		*tail = (*tail)->next;
+	if (ft_strcmp((*tail)->value, "\n") != 0)
+	{
+		sep[0] = "\n";
+		sep[1] = NULL;
+		newline = create_token_type_list(sep);
+		if (!newline)
+			return (free_tokens_list(added), -1);
+		(*tail)->next = newline;
+		*tail = newline;
+	}
+	(*tail)->next = added;
+	return (0);
+}
+
+/**
+ * @brief Read, record and tokenize one continuation line, then read the
+ * bodies of its here-documents.
+ *
+ * In a terminal the continuation prompt is shown; otherwise the next line
+ * of the script is read.
+ *
+ * @param text Text of the command so far (the line is appended)
+ * @param added Receives the tokens of the line (NULL on error)
+ * @param data Shell state structure
+ * @return EXIT_SUCCESS, or the status of the failure
+ */
+static int	read_line_tokens(t_strbuf *text, t_token **added, t_shell *data)
+{
+	char	*next;
+	int		ret;
+
+	*added = NULL;
+	if (data->is_tty)
+		next = readline(CONTINUATION_PROMPT);
+	else
+		next = read_script_line(STDIN_FILENO);
+	if (!next || g_signal_received == SIGINT)
+		return (free(next), handle_incomplete_input());
+	ret = EXIT_FAILURE;
+	if ((text->len == 0 || text->data[text->len - 1] == '\n'
+			|| strbuf_append(text, "\n", 1) == 0)
+		&& strbuf_append(text, next, ft_strlen(next)) == 0)
+		ret = tokenize_line(next, data, added);
+	free(next);
+	if (ret == EXIT_SUCCESS)
+		ret = read_line_heredocs(*added, data);
+	if (ret == EXIT_SUCCESS)
+		return (ret);
+	free_tokens_list(*added);
+	*added = NULL;
+	return (ret);
+}
+
+/**
+ * @brief Read more lines for an unfinished compound command.
+ *
+ * Used while a compound command is still open (e.g. a `while` waiting for
+ * its `done`). Lines are read and tokenized one at a time, up to one that
+ * may close the command.
+ *
+ * @param text Text of the command so far (continuation lines appended)
+ * @param tail A token of the command, toward its end (advanced)
+ * @param data Shell state structure
+ * @return EXIT_SUCCESS, MISUSAGE_ERROR at end of input or on a syntax
+ *         error, EXIT_SIGINT after Ctrl-C, EXIT_FAILURE on malloc error
+ */
+int	continue_line(t_strbuf *text, t_token **tail, t_shell *data)
+{
+	t_token	*added;
+	bool	closing;
+	int		ret;
+
+	closing = false;
+	while (!closing)
+	{
+		ret = read_line_tokens(text, &added, data);
+		if (ret != EXIT_SUCCESS)
+			return (ret);
+		closing = may_close(added);
+		if (link_tokens(tail, added) == -1)
+			return (EXIT_FAILURE);
+	}
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,177 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_line.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:20:47 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tokenize and validate the input command line.
+ *
+ * Converts the raw input line into a validated token list by performing:
+ *  1. Tokenization via `execute_tokenizer`.
+ *  2. Typed token list creation using `create_token_type_list`.
+ *  3. Syntax validation through `validate_syntax_token_list`.
+ *
+ * Expansion and quote removal are no longer done here: they happen on
+ * each execution of a command, so that loops see updated variables.
+ *
+ * @param line        Raw input command line.
+ * @param data        Shell context containing environment and state.
+ * @param token_list  Output pointer to store the typed token list (NULL
+ *                    for a blank line).
+ * @return EXIT_SUCCESS on success,
+ *         MISUSAGE_ERROR on syntax errors,
+ *         or EXIT_FAILURE on memory or internal errors.
+ */
+int	tokenize_line(char *line, t_shell *data, t_token **token_list)
+{
+	char	**tokens;
+
+	*token_list = NULL;
+	tokens = execute_tokenizer(line, data);
+	if (!tokens)
+		return (data->status);
+	if (tokens[0])
+	{
+		*token_list = create_token_type_list(tokens);
+		if (!*token_list)
+			return (free_strings_array(tokens), EXIT_FAILURE);
+	}
+	free_strings_array(tokens);
+	if (*token_list && validate_syntax_token_list(*token_list) != EXIT_SUCCESS)
+		return (MISUSAGE_ERROR);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Convert a parse status to the exit status of the command line.
+ *
+ * @param status Status of build_ast_from_tokens()
+ * @return EXIT_SUCCESS, MISUSAGE_ERROR on syntax error, EXIT_FAILURE on
+ *         allocation failure
+ */
+static int	parse_result(t_parse_status status)
+{
+	if (status == PARSE_SYNTAX_ERROR)
+		return (MISUSAGE_ERROR);
+	if (status == PARSE_MALLOC_ERROR)
+		return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Parse the tokens of a line, reading more lines while a compound
+ * command is open.
+ *
+ * Each continuation line is tokenized once and appended to the token
+ * list; the list is parsed again only after a line that may close the
+ * command (see continue_line()). The text of all the lines replaces the
+ * input line, for the history.
+ *
+ * @param tokens Tokens of the first line (grows with continuation lines)
+ * @param line Pointer to the input line (replaced by the full text)
+ * @param data Shell state structure
+ * @param ast Receives the AST (NULL on error)
+ * @return EXIT_SUCCESS, or the status of the failure
+ */
+static int	parse_tokens(t_token *tokens, char **line, t_shell *data,
+	t_ast **ast)
+{
+	t_token			*tail;
+	t_strbuf		text;
+	t_parse_status	status;
+	int				ret;
+
+	*ast = build_ast_from_tokens(tokens, &status);
+	if (status != PARSE_INCOMPLETE)
+		return (parse_result(status));
+	tail = tokens;
+	strbuf_init(&text);
+	ret = EXIT_SUCCESS;
+	if (strbuf_append(&text, *line, ft_strlen(*line)) == -1)
+		ret = EXIT_FAILURE;
+	while (ret == EXIT_SUCCESS && status == PARSE_INCOMPLETE)
+	{
+		ret = continue_line(&text, &tail, data);
+		if (ret == EXIT_SUCCESS)
+			*ast = build_ast_from_tokens(tokens, &status);
+	}
+	free(*line);
+	*line = strbuf_finish(&text);
+	if (ret != EXIT_SUCCESS)
+		return (ret);
+	return (parse_result(status));
+}
+
+/**
+ * @brief Turn a complete input line into an AST.
+ *
+ * The line is tokenized and the bodies of its here-documents are read
+ * right after it, then it is parsed. An unfinished compound command
+ * reads more lines (see parse_tokens()).
+ *
+ * @param line Pointer to the input line (may grow with continuation lines)
+ * @param data Shell state structure
+ * @param ast Receives the AST (NULL for a blank line or on error)
+ * @return EXIT_SUCCESS, MISUSAGE_ERROR on syntax error, EXIT_FAILURE on
+ *         allocation failure, EXIT_SIGINT after Ctrl-C
+ */
+int	parse_line(char **line, t_shell *data, t_ast **ast)
+{
+	t_token	*tokens;
+	int		ret;
+
+	*ast = NULL;
+	ret = tokenize_line(*line, data, &tokens);
+	if (ret == EXIT_SUCCESS && tokens)
+		ret = read_line_heredocs(tokens, data);
+	if (ret == EXIT_SUCCESS && tokens)
+		ret = parse_tokens(tokens, line, data, ast);
+	free_tokens_list(tokens);
+	if (ret == EXIT_SUCCESS)
+		optimize_ast(*ast, data);
+	return (ret);
+}
+
+/**
+ * @brief Turn a complete command string into an AST, without more input.
+ *
+ * Used for the text of a command substitution: an unfinished compound
+ * command there is a syntax error, not a request for continuation lines.
+ *
+ * @param str Command text
+ * @param data Shell state structure
+ * @param ast Receives the AST (NULL for a blank string or on error)
+ * @return EXIT_SUCCESS, MISUSAGE_ERROR on syntax error, EXIT_FAILURE on
+ *         allocation failure
+ */
+int	parse_string(const char *str, t_shell *data, t_ast **ast)
+{
+	t_token			*token_list;
+	t_parse_status	status;
+	int				ret;
+
+	*ast = NULL;
+	ret = tokenize_line((char *)str, data, &token_list);
+	if (ret != EXIT_SUCCESS || !token_list)
+		return (free_tokens_list(token_list), ret);
+	*ast = build_ast_from_tokens(token_list, &status);
+	free_tokens_list(token_list);
+	if (status == PARSE_INCOMPLETE)
+	{
+		print_error(ERR_PREFIX, ERR_SYNTAX_EOF, NULL, NULL);
+		status = PARSE_SYNTAX_ERROR;
+	}
+	ret = parse_result(status);
+	if (ret == EXIT_SUCCESS)
+		optimize_ast(*ast, data);
+	return (ret);
+}
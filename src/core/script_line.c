@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_line.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:15:49 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:35:23 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Read a line from a regular file, a block at a time.
+ *
+ * The bytes read past the newline are given back by moving the file
+ * offset backwards, so that the commands of the script find the input
+ * where the line ends.
+ *
+ * @param fd File to read
+ * @param line Receives the line, newline included
+ * @return 0 at the end of the line or of the file, -1 on error
+ */
+static int	line_block(int fd, t_strbuf *line)
+{
+	char	buf[READ_BUF_SIZE];
+	ssize_t	n;
+	ssize_t	len;
+	char	*nl;
+
+	while (1)
+	{
+		n = read(fd, buf, sizeof(buf));
+		if (n < 0 && errno == EINTR && g_signal_received != SIGINT)
+			continue ;
+		if (n <= 0)
+			return ((int)n);
+		nl = ft_memchr(buf, '\n', n);
+		len = n;
+		if (nl)
+			len = nl - buf + 1;
+		if (strbuf_append(line, buf, len) == -1)
+			return (-1);
+		if (nl && len < n)
+			lseek(fd, len - n, SEEK_CUR);
+		if (nl)
+			return (0);
+	}
+}
+
+/**
+ * @brief Read a line from a pipe or a socket, byte by byte.
+ *
+ * These inputs cannot be rewound, so nothing past the newline is read.
+ *
+ * @param fd Input to read
+ * @param line Receives the line, newline included
+ * @return 0 at the end of the line or of the input, -1 on error
+ */
+static int	line_bytes(int fd, t_strbuf *line)
+{
+	char	c;
+	ssize_t	n;
+
+	c = '\0';
+	while (c != '\n')
+	{
+		n = read(fd, &c, 1);
+		if (n < 0 && errno == EINTR && g_signal_received != SIGINT)
+			continue ;
+		if (n <= 0)
+			return ((int)n);
+		if (strbuf_append(line, &c, 1) == -1)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Read the next line of a script.
+ *
+ * Unlike get_next_line(), nothing is kept past the line: the input a
+ * command of the script reads (`read`, `cat`, ...) starts at the next
+ * line, as in bash.
+ *
+ * @param fd Script input
+ * @return The line with its newline (none on an unterminated last line),
+ *         or NULL at end of input or on error
+ */
+char	*read_script_line(int fd)
+{
+	struct stat	st;
+	t_strbuf	line;
+	int			ret;
+
+	strbuf_init(&line);
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+		ret = line_block(fd, &line);
+	else
+		ret = line_bytes(fd, &line);
+	if (ret == -1 || line.len == 0)
+	{
+		free(line.data);
+		return (NULL);
+	}
+	return (strbuf_finish(&line));
+}
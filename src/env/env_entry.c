@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_entry.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:09:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:12:45 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Allocate a variable holding "key=value" in a single entry.
+ *
+ * @param key Key (key_len bytes, not necessarily terminated)
+ * @param key_len Length of the key
+ * @param value Value, or NULL for a variable declared without one
+ * @return The new variable (exported), or NULL on allocation failure
+ */
+t_env	*env_new(const char *key, size_t key_len, const char *value)
+{
+	t_env	*env;
+
+	env = malloc(sizeof(t_env));
+	if (!env)
+		return (NULL);
+	env->entry = NULL;
+	if (env_entry_set(env, key, key_len, value) == -1)
+		return (free(env), NULL);
+	env->in_env = true;
+	return (env);
+}
+
+/**
+ * @brief Replace the entry of a variable with "key=value".
+ *
+ * Key and value are copied into one allocation, which is the string
+ * passed to execve() as is. The previous entry is freed last, so `key`
+ * and `value` may point into it. Without a value the entry is "key".
+ *
+ * @param env Variable to update
+ * @param key Key (key_len bytes, not necessarily terminated)
+ * @param key_len Length of the key
+ * @param value New value, or NULL
+ * @return 0 on success, -1 on allocation failure (variable unchanged)
+ */
+int	env_entry_set(t_env *env, const char *key, size_t key_len,
+	const char *value)
+{
+	char	*entry;
+	size_t	value_size;
+
+	value_size = 0;
+	if (value)
+		value_size = ft_strlen(value) + 1;
+	entry = malloc(key_len + value_size + 1);
+	if (!entry)
+		return (-1);
+	ft_memcpy(entry, key, key_len);
+	entry[key_len] = '\0';
+	if (value)
+	{
+		entry[key_len] = '=';
+		ft_memcpy(entry + key_len + 1, value, value_size);
+	}
+	free(env->entry);
+	env->entry = entry;
+	env->key_len = key_len;
+	env->value = NULL;
+	if (value)
+		env->value = entry + key_len + 1;
+	env->num_valid = false;
+	return (0);
+}
+
+/**
+ * @brief Compare the key of a variable with a key, like strcmp() on keys.
+ *
+ * @param env Variable
+ * @param key Key to compare (len bytes, not necessarily terminated)
+ * @param len Length of the key
+ * @return Negative, zero or positive as the variable's key sorts before,
+ *         equal to or after `key`
+ */
+int	env_key_order(const t_env *env, const char *key, size_t len)
+{
+	size_t	n;
+	int		cmp;
+
+	n = env->key_len;
+	if (len < n)
+		n = len;
+	cmp = ft_memcmp(env->entry, key, n);
+	if (cmp != 0)
+		return (cmp);
+	return ((env->key_len > len) - (env->key_len < len));
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:40:37 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:40:38 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:10:45 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -27,8 +27,7 @@ void	del_env(void *content)
 	env = (t_env *)content;
 	if (!env)
 		return ;
-	free(env->key);
-	free(env->value);
+	free(env->entry);
 	free(env);
 }
 
@@ -41,11 +40,11 @@ void	del_env(void *content)
  * @return int 0 on success, -1 if a write error occurs.
  *
  * @details
- * - Iterates through the list and prints each variable as "key=value\n" using
- *   ft_putstr_fd, ft_putchar_fd, and ft_putendl_fd.
- * - Only prints variables where env->in_env == true, and both key and value
- *   exist.
- * - If any write() fails during printing, the function returns -1 immediately.
+ * - Iterates through the list and buffers each entry ("key=value") and a
+ *   newline in the stdout buffer, written out when full and at the end of
+ *   the builtin.
+ * - Only prints variables where env->in_env == true that have a value.
+ * - If a write() fails while the buffer is flushed, returns -1 immediately.
  * - Does not modify the list or the shell state.
  */
 int	print_env_list(t_list *env_list)
@@ -55,11 +54,10 @@ int	print_env_list(t_list *env_list)
 	while (env_list)
 	{
 		env = (t_env *)env_list->content;
-		if (env && env->in_env == true && env->key && env->value)
+		if (env && env->in_env == true && env->value)
 		{
-			if (ft_putstr_fd(env->key, STDOUT_FILENO) == -1
-				|| ft_putchar_fd('=', STDOUT_FILENO) == -1
-				|| ft_putendl_fd(env->value, STDOUT_FILENO) == -1)
+			if (out_str(STDOUT_FILENO, env->entry) == -1
+				|| out_char(STDOUT_FILENO, '\n') == -1)
 				return (-1);
 		}
 		env_list = env_list->next;
@@ -81,7 +79,6 @@ int	print_env_list(t_list *env_list)
  */
 t_env	*create_env_node(const char *str)
 {
-	t_env	*env;
 	char	*equal;
 
 	if (!str)
@@ -89,21 +86,27 @@ t_env	*create_env_node(const char *str)
 	equal = ft_strchr(str, '=');
 	if (!equal || equal == str)
 		return (NULL);
-	env = malloc(sizeof (t_env));
+	return (env_new(str, equal - str, equal + 1));
+}
+
+/**
+ * @brief Append the variable parsed from a "KEY=VALUE" string to the list.
+ *
+ * @param tail Link after the last variable of the list
+ * @param str Input string
+ * @return The new tail link, or `tail` if the string was skipped
+ */
+static t_list	**append_env(t_list **tail, const char *str)
+{
+	t_env	*env;
+
+	env = create_env_node(str);
 	if (!env)
-		return (NULL);
-	env->key = ft_substr(str, 0, equal - str);
-	if (!env->key)
-		return (free(env), NULL);
-	env->value = ft_strdup(equal + 1);
-	if (!env->value)
-	{
-		free(env->key);
-		free(env);
-		return (NULL);
-	}
-	env->in_env = true;
-	return (env);
+		return (tail);
+	*tail = ft_lstnew(env);
+	if (!*tail)
+		return (del_env(env), tail);
+	return (&(*tail)->next);
 }
 
 /**
@@ -113,33 +116,36 @@ t_env	*create_env_node(const char *str)
  * @return Pointer to the head of a newly allocated t_list containing t_env
  *         structs. Returns NULL if envp is NULL or empty.
  *
- * @note Each t_env is created with create_env_node(). Invalid variables
- *       (NULL, missing '=', empty key) are skipped. Memory for the list
- *       must be freed by the caller with ft_lstclear() and del_env().
+ * @note The strings are sorted by key first, so the list starts in the
+ *       order every later insertion keeps. Each t_env is created with
+ *       create_env_node(). Invalid variables (NULL, missing '=', empty key)
+ *       are skipped. Memory for the list must be freed by the caller with
+ *       ft_lstclear() and del_env().
  */
 t_list	*init_env_from_envp(char **envp)
 {
 	t_list	*env_list;
-	t_list	*node;
-	t_env	*env;
-	int		i;
+	t_list	**tail;
+	char	**sorted;
+	size_t	n;
+	size_t	i;
 
-	env_list = NULL;
 	if (!envp)
 		return (NULL);
+	n = 0;
+	while (envp[n] != NULL)
+		n++;
+	sorted = malloc(sizeof(char *) * (n + 1));
+	if (!sorted)
+		return (NULL);
+	ft_memcpy(sorted, envp, sizeof(char *) * n);
+	if (sort_strings(sorted, n, env_string_cmp) == -1)
+		return (free(sorted), NULL);
+	env_list = NULL;
+	tail = &env_list;
 	i = 0;
-	while (envp[i] != NULL)
-	{
-		env = create_env_node(envp[i]);
-		if (env)
-		{
-			node = ft_lstnew(env);
-			if (node)
-				ft_lstadd_back(&env_list, node);
-			else
-				del_env(env);
-		}
-		i++;
-	}
+	while (i < n)
+		tail = append_env(tail, sorted[i++]);
+	free(sorted);
 	return (env_list);
 }
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_order.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:12:45 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:12:45 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Find where a key is, or belongs, in the environment list.
+ *
+ * The list is kept sorted by key, so the walk stops at the first variable
+ * that does not sort before `key`.
+ *
+ * @param env_list Pointer to the environment list
+ * @param key Key to look for (len bytes, not necessarily terminated)
+ * @param len Length of the key
+ * @return The link holding the variable with this key, or the link where
+ *         a variable with this key is inserted
+ */
+t_list	**env_find_slot(t_list **env_list, const char *key, size_t len)
+{
+	while (*env_list && env_key_order((*env_list)->content, key, len) < 0)
+		env_list = &(*env_list)->next;
+	return (env_list);
+}
+
+/**
+ * @brief Get the variable found at a slot, if it has the given key.
+ *
+ * @param slot Link returned by env_find_slot() for this key
+ * @param key Key (len bytes)
+ * @param len Length of the key
+ * @return The variable, or NULL if the key is not set
+ */
+t_env	*env_slot_var(t_list **slot, const char *key, size_t len)
+{
+	if (!*slot || env_key_order((*slot)->content, key, len) != 0)
+		return (NULL);
+	return ((*slot)->content);
+}
+
+/**
+ * @brief Link a new variable at a slot of the environment list.
+ *
+ * @param slot Link returned by env_find_slot() for the variable's key
+ * @param env Variable to insert, freed on failure (may be NULL)
+ * @return The variable, or NULL on allocation failure
+ */
+t_env	*env_insert(t_list **slot, t_env *env)
+{
+	t_list	*node;
+
+	if (!env)
+		return (NULL);
+	node = ft_lstnew(env);
+	if (!node)
+		return (del_env(env), NULL);
+	node->next = *slot;
+	*slot = node;
+	return (env);
+}
+
+/**
+ * @brief Compare two "KEY=VALUE" strings by key only.
+ *
+ * Sorts the imported environment in the same order as env_key_order(),
+ * so it can be linked in one pass.
+ *
+ * @param a First string
+ * @param b Second string
+ * @return Negative, zero or positive as a's key sorts before, equal to or
+ *         after b's
+ */
+int	env_string_cmp(const char *a, const char *b)
+{
+	unsigned char	ca;
+	unsigned char	cb;
+
+	while (*a && *a != '=' && *a == *b)
+	{
+		a++;
+		b++;
+	}
+	ca = *a;
+	cb = *b;
+	if (ca == '=')
+		ca = '\0';
+	if (cb == '=')
+		cb = '\0';
+	return (ca - cb);
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_set.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:10:45 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Store a value into a variable, creating it if needed.
+ *
+ * A new variable is linked at its place in the key order.
+ *
+ * @param env_list Pointer to the environment list.
+ * @param key      Variable name.
+ * @param value    Value (copied into the variable's entry).
+ * @return The updated entry, or NULL on allocation failure.
+ */
+static t_env	*store_value(t_list **env_list, const char *key,
+	const char *value)
+{
+	t_env	*env;
+	t_list	**slot;
+	size_t	len;
+
+	len = ft_strlen(key);
+	slot = env_find_slot(env_list, key, len);
+	env = env_slot_var(slot, key, len);
+	if (!env)
+		return (env_insert(slot, env_new(key, len, value)));
+	if (env_entry_set(env, env->entry, env->key_len, value) == -1)
+		return (NULL);
+	env->in_env = true;
+	return (env);
+}
+
+/**
+ * @brief Set a variable to a literal value.
+ *
+ * Unlike set_env_node(), the value is not an `export` argument: it is
+ * stored as is, without any quote removal. Used by the shell itself, for
+ * instance to assign the variable of a `for` loop.
+ *
+ * @param env_list Pointer to the environment list.
+ * @param key      Variable name (must be a valid identifier).
+ * @param value    New value of the variable.
+ * @return 0 on success, -1 on allocation failure.
+ */
+int	set_env_value(t_list **env_list, const char *key, const char *value)
+{
+	if (!store_value(env_list, key, value))
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Set a variable to an integer, keeping the parsed value cached.
+ *
+ * Used by arithmetic assignments: the next arithmetic read of the
+ * variable reuses `num` instead of parsing its string again.
+ *
+ * @param env_list Pointer to the environment list.
+ * @param key      Variable name (must be a valid identifier).
+ * @param n        New value of the variable.
+ * @return 0 on success, -1 on allocation failure.
+ */
+int	set_env_number(t_list **env_list, const char *key, long long n)
+{
+	t_env	*env;
+	char	*new_value;
+
+	new_value = ft_lltoa(n);
+	if (!new_value)
+		return (-1);
+	env = store_value(env_list, key, new_value);
+	free(new_value);
+	if (!env)
+		return (-1);
+	env->num = n;
+	env->num_valid = true;
+	return (0);
+}
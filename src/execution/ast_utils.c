@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:40:41 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:40:42 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:39:22 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,15 +15,12 @@
 /**
  * @brief Determine whether a command should be executed in a separate process.
  *
- * Non-forking builtins (like cd, export, unset, exit) are executed in the
- * parent
- * process to affect shell state. All other commands, including external
- * commands
- * and forkable builtins, should be executed in a child process.
+ * Builtins are executed in the shell process. External commands are
+ * executed in a child process, unless the current process is a child
+ * allowed to be replaced by the command (`data->can_exec`).
  *
  * @param node AST node containing the command.
- * @param data Pointer to the shell state (currently unused but may be needed
- * later).
+ * @param data Pointer to the shell state.
  * @return true if the command should be executed in a child process; false
  * otherwise.
  */
@@ -31,13 +28,10 @@ bool	should_fork(t_ast *node, t_shell *data)
 {
 	if (!node || node->type != NODE_CMD)
 		return (false);
-	if (data->is_child)
+	if (data->can_exec)
 		return (false);
 	if (is_builtin(node))
-	{
-		if (is_nonforking_builtin(node))
-			return (false);
-	}
+		return (false);
 	return (true);
 }
 
@@ -46,17 +40,22 @@ bool	should_fork(t_ast *node, t_shell *data)
  *
  * @param node AST node containing the command.
  * @return true if the command is a builtin (pwd, export, exit, echo, env,
- * unset, cd);
- *         false otherwise.
+ * unset, cd, break, continue, return, exec, test, [, printf, read, true,
+ * false, :, sleep, kill, and cat without options other than -u); false
+ * otherwise.
  */
 bool	is_builtin(t_ast *node)
 {
 	int					i;
 	static const char	*builtins[] = {
-		"pwd", "export", "exit", "echo", "env", "unset", "cd", NULL};
+		"pwd", "export", "exit", "echo", "env", "unset", "cd",
+		"break", "continue", "return", "exec", "test", "[",
+		"printf", "read", "true", "false", ":", "sleep", "kill", NULL};
 
 	if (!node || !node->value)
 		return (false);
+	if (ft_strcmp(node->value, "cat") == 0)
+		return (node->argv && cat_is_plain(node->argv));
 	i = 0;
 	while (builtins[i] != NULL)
 	{
@@ -66,31 +65,3 @@ bool	is_builtin(t_ast *node)
 	}
 	return (false);
 }
-
-/**
- * @brief Check if a builtin command should run without forking.
- *
- * Some builtins need to run in the parent process to modify shell state
- * directly.
- *
- * @param node AST node containing the command.
- * @return true if the builtin is non-forking (cd, export, unset, exit);
- * false otherwise.
- */
-bool	is_nonforking_builtin(t_ast *node)
-{
-	int					i;
-	static const char	*non_forking[] = {
-		"cd", "export", "unset", "exit", NULL};
-
-	if (!node || !node->value)
-		return (false);
-	i = 0;
-	while (non_forking[i] != NULL)
-	{
-		if (ft_strcmp(node->value, non_forking[i]) == 0)
-			return (true);
-		i++;
-	}
-	return (false);
-}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:40:51 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:15:07 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:28:16 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -31,7 +31,10 @@ static void	handle_child_exit_status(int status, t_shell *data)
 		if (sig == SIGQUIT)
 			write(1, "Quit (core dumped)\n", 20);
 		else if (sig == SIGINT)
+		{
 			write(1, "\n", 1);
+			g_signal_received = SIGINT;
+		}
 	}
 	else
 		data->status = EXIT_FAILURE;
@@ -52,7 +55,7 @@ static void	handle_child_exit_status(int status, t_shell *data)
  */
 static int	execute_command(t_ast *node, t_shell *data)
 {
-	if (!node || node->type != NODE_CMD)
+	if (!node || node->type != NODE_CMD || !node->value)
 		return (EXIT_SUCCESS);
 	if (is_builtin(node))
 		return (execute_builtin(node, data));
@@ -82,32 +85,53 @@ static int	execute_in_child_process(t_ast *node, t_shell *data)
 
 	pid = fork();
 	if (pid == -1)
-		return (perror("fork"), EXIT_FAILURE);
+		return (out_perror("fork"), EXIT_FAILURE);
 	if (pid == 0)
 	{
 		setup_signals_child();
 		data->is_child = true;
 		if (apply_redirections(node->right, data) != EXIT_SUCCESS)
-		{
-			close_all_heredocs(node->right);
 			exit (data->status);
-		}
 		exit(execute_command(node, data));
 	}
 	setup_signals_ignore();
 	waitpid(pid, &status, 0);
 	setup_signals_interactive();
 	handle_child_exit_status(status, data);
-	close_all_heredocs(node->right);
+	return (data->status);
+}
+
+/**
+ * @brief Execute a command in the current process, which it may replace.
+ *
+ * Only reached in a child that runs nothing else after this command (one
+ * side of a pipeline): redirections are applied here and an external
+ * command replaces the process without forking again.
+ *
+ * @param node AST node representing the command.
+ * @param data Pointer to the shell state structure.
+ * @return int The exit status of the command, stored in `data->status`.
+ */
+static int	execute_in_place(t_ast *node, t_shell *data)
+{
+	if (node->type == NODE_CMD)
+	{
+		if (apply_redirections(node->right, data) != EXIT_SUCCESS)
+			return (data->status);
+	}
+	data->status = execute_command(node, data);
 	return (data->status);
 }
 
 /**
  * @brief Recursively execute an AST tree representing commands and pipelines.
  *
- * Handles pipelines, builtins (forking and non-forking), and external commands.
- * Redirections are applied before execution. The function decides when to fork
- * for commands that should run in a separate process.
+ * Handles pipelines, command lists, loops, shell functions, builtins,
+ * external commands and commands made only of redirections. Command words
+ * are expanded right before each run, so a command inside a loop sees the
+ * current variable values. Functions
+ * and builtins run in the shell process; external commands fork unless
+ * the current process may be replaced by them.
  *
  * @param node Root AST node of the tree/subtree to execute.
  * @param data Pointer to the shell state structure.
@@ -116,29 +140,27 @@ static int	execute_in_child_process(t_ast *node, t_shell *data)
  */
 int	execute_ast_tree(t_ast *node, t_shell *data)
 {
-	int	saved_fds[3];
+	t_func	*func;
 
 	if (!node)
 		return (EXIT_SUCCESS);
+	if (node->type == NODE_PIPE && execute_cat_shortcut(node, data))
+		return (data->status);
 	if (node->type == NODE_PIPE)
 		return (execute_pipeline(node, data));
-	if (node->type == NODE_CMD && is_nonforking_builtin(node))
+	if (node->type == NODE_REDIR)
+		return (execute_redirect_only(node, data));
+	if (node->type != NODE_CMD)
+		return (execute_compound(node, data));
+	if (expand_cmd_node(node, data) != EXIT_SUCCESS)
 	{
-		if (!node->right)
-		{
-			data->status = execute_builtin(node, data);
-			return (data->status);
-		}
-		if (save_std_fds(saved_fds) == -1)
-			return (EXIT_FAILURE);
-		if (apply_redirections(node->right, data) == EXIT_SUCCESS)
-			data->status = execute_builtin(node, data);
-		restore_std_fds(saved_fds);
-		close_all_heredocs(node->right);
+		data->status = EXIT_FAILURE;
 		return (data->status);
 	}
+	func = find_function(data, node->value);
+	if (func || is_builtin(node))
+		return (execute_in_shell(node, func, data));
 	if (should_fork(node, data))
 		return (execute_in_child_process(node, data));
-	data->status = execute_command(node, data);
-	return (data->status);
+	return (execute_in_place(node, data));
 }
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:40:55 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:40:56 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:39:22 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,8 +17,11 @@
  *
  * This function checks the command in the given AST node against the list
  * of supported builtin commands (`pwd`, `export`, `exit`, `echo`, `env`,
- * `unset`, `cd`). If a match is found, the corresponding function is executed,
- * and the shell state (`data->status`) is updated accordingly.
+ * `unset`, `cd`, the loop and function controls, `exec`, `cat`, `test`,
+ * `printf`).
+ * If a match is found, the corresponding function is executed, and the
+ * shell state (`data->status`) is updated accordingly. Its buffered
+ * output is written out when it returns; a failed write makes it fail.
  *
  * This function does **not** handle external commands; it only executes
  * builtins.
@@ -34,25 +37,26 @@ int	execute_builtin(t_ast *node, t_shell *data)
 {
 	int						i;
 	static const t_builtin	builtins[] = {
-	{"pwd", builtin_pwd}, {"export", builtin_export},
-	{"exit", builtin_exit}, {"echo", builtin_echo},
-	{"env", builtin_env}, {"unset", builtin_unset},
-	{"cd", builtin_cd},
-	{NULL, NULL}};
+	{"pwd", builtin_pwd}, {"export", builtin_export}, {"exit", builtin_exit},
+	{"echo", builtin_echo}, {"env", builtin_env}, {"unset", builtin_unset},
+	{"cd", builtin_cd}, {"break", builtin_break}, {"exec", builtin_exec},
+	{"continue", builtin_continue}, {"return", builtin_return},
+	{"cat", builtin_cat}, {"test", builtin_test}, {"[", builtin_test},
+	{"printf", builtin_printf}, {"read", builtin_read}, {":", builtin_true},
+	{"true", builtin_true}, {"false", builtin_false},
+	{"sleep", builtin_sleep}, {"kill", builtin_kill}, {NULL, NULL}};
 
 	if (!node || !node->value)
 		return (EXIT_FAILURE);
-	if (data->curr_ast && data->is_child)
-		close_all_heredocs(data->curr_ast);
+	if (data->can_exec)
+		fd_close_all();
 	i = 0;
-	while (builtins[i].cmd != NULL)
-	{
-		if (ft_strcmp(node->value, builtins[i].cmd) == 0)
-		{
-			builtins[i].f(node->argv, data);
-			return (data->status);
-		}
+	while (builtins[i].cmd && ft_strcmp(node->value, builtins[i].cmd) != 0)
 		i++;
-	}
-	return (EXIT_FAILURE);
+	if (!builtins[i].cmd)
+		return (EXIT_FAILURE);
+	builtins[i].f(node->argv, data);
+	if (out_finish(node->value) == -1)
+		data->status = EXIT_FAILURE;
+	return (data->status);
 }
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_case.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:35:24 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:35:24 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Match a word against a pattern that needs an expansion.
+ *
+ * @param raw Raw pattern word
+ * @param word Expanded case word
+ * @param data Shell state structure
+ * @return 1 if it matches, 0 if not, -1 on error
+ */
+static int	match_dynamic(const char *raw, const char *word, t_shell *data)
+{
+	t_pattern	compiled;
+	char		*pattern;
+	bool		found;
+
+	pattern = expand_pattern(raw, data);
+	if (!pattern)
+		return (-1);
+	if (pattern_compile(pattern, ft_strlen(pattern), &compiled) == -1)
+		return (free(pattern), -1);
+	found = pattern_match(&compiled, word);
+	pattern_free(&compiled);
+	free(pattern);
+	return (found);
+}
+
+/**
+ * @brief Check if one of the patterns of a case item matches a word.
+ *
+ * @param item NODE_CASE_ITEM node
+ * @param word Expanded case word
+ * @param data Shell state structure
+ * @return 1 if a pattern matches, 0 if none does, -1 on error
+ */
+static int	item_matches(t_ast *item, const char *word, t_shell *data)
+{
+	size_t	i;
+	int		found;
+
+	i = 0;
+	while (item->words[i])
+	{
+		if (item->patterns[i].elems)
+			found = pattern_match(&item->patterns[i], word);
+		else
+			found = match_dynamic(item->words[i], word, data);
+		if (found != 0)
+			return (found);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Execute a case command.
+ *
+ * The word is expanded once, then the items are tried in order: the list
+ * of the first item with a matching pattern runs. Without a match the
+ * status is 0, as in bash.
+ *
+ * @param node NODE_CASE node (value: raw word, left: first item)
+ * @param data Shell state structure
+ * @return Exit status of the executed list, 0 if none ran
+ */
+int	execute_case(t_ast *node, t_shell *data)
+{
+	t_ast	*item;
+	char	*word;
+	int		found;
+
+	word = expand_word(node->value, data);
+	if (!word)
+		return (EXIT_FAILURE);
+	item = node->left;
+	while (item)
+	{
+		found = item_matches(item, word, data);
+		if (found == -1)
+			return (free(word), EXIT_FAILURE);
+		if (found)
+			return (free(word), execute_ast_tree(item->right, data));
+		item = item->next;
+	}
+	free(word);
+	return (EXIT_SUCCESS);
+}
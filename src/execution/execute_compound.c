@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_compound.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:39:36 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if the remaining commands of a list must be skipped.
+ *
+ * A list stops after `exit`, after `break`/`continue` (until the
+ * enclosing loop handles them), after `return` (until the function call
+ * ends), after a `${name?word}` error (until the input line ends) and
+ * after Ctrl-C killed a command.
+ *
+ * @param data Shell state structure
+ * @return true if execution of the current list must stop
+ */
+bool	should_stop_sequence(t_shell *data)
+{
+	return (data->should_exit || data->break_count > 0
+		|| data->continue_count > 0 || data->returning || data->aborting
+		|| g_signal_received == SIGINT);
+}
+
+/**
+ * @brief Execute a command list: the first command, then the rest.
+ *
+ * @param node NODE_LIST node
+ * @param data Shell state structure
+ * @return Exit status of the last executed command
+ */
+static int	execute_list(t_ast *node, t_shell *data)
+{
+	data->status = execute_ast_tree(node->left, data);
+	if (should_stop_sequence(data))
+		return (data->status);
+	data->status = execute_ast_tree(node->right, data);
+	return (data->status);
+}
+
+/**
+ * @brief Dispatch a compound node to its executor.
+ *
+ * @param node Compound AST node (list, loop, group, function definition,
+ *             arithmetic command or case)
+ * @param data Shell state structure
+ * @return Exit status of the compound command
+ */
+static int	execute_compound_body(t_ast *node, t_shell *data)
+{
+	if (node->type == NODE_LIST)
+		return (execute_list(node, data));
+	if (node->type == NODE_WHILE || node->type == NODE_UNTIL)
+		return (execute_while(node, data));
+	if (node->type == NODE_FOR)
+		return (execute_for(node, data));
+	if (node->type == NODE_GROUP)
+		return (execute_ast_tree(node->left, data));
+	if (node->type == NODE_FUNCTION)
+		return (define_function(node, data));
+	if (node->type == NODE_ARITH)
+		return (execute_arith_command(node, data));
+	if (node->type == NODE_CASE)
+		return (execute_case(node, data));
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Execute an arithmetic command `(( expression ))`.
+ *
+ * The expression is expanded like a double-quoted word, then evaluated
+ * in the shell process.
+ *
+ * @param node NODE_ARITH node (value: the expression)
+ * @param data Shell state structure
+ * @return 0 if the expression is non-zero, 1 if it is zero or invalid
+ */
+int	execute_arith_command(t_ast *node, t_shell *data)
+{
+	char		*expr;
+	long long	result;
+
+	expr = expand_word(node->value, data);
+	if (!expr)
+		return (EXIT_FAILURE);
+	if (arith_evaluate(expr, data, 0, &result) == -1)
+		return (free(expr), EXIT_FAILURE);
+	free(expr);
+	if (result == 0)
+		return (EXIT_FAILURE);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Execute a compound command with its own redirections.
+ *
+ * Redirections written after `done` are applied once for the whole
+ * command. In the shell process the standard streams are saved and
+ * restored around it; in a child they are simply applied.
+ *
+ * @param node Compound AST node
+ * @param data Shell state structure
+ * @return Exit status of the compound command, stored in `data->status`
+ */
+int	execute_compound(t_ast *node, t_shell *data)
+{
+	int	saved_fds[REDIR_FD_MAX];
+
+	if (!node->redirs)
+		return (execute_compound_body(node, data));
+	if (data->is_child)
+	{
+		if (apply_redirections(node->redirs, data) == EXIT_SUCCESS)
+			data->status = execute_compound_body(node, data);
+		return (data->status);
+	}
+	if (save_redir_fds(node->redirs, saved_fds) == -1)
+		return (EXIT_FAILURE);
+	if (apply_redirections(node->redirs, data) == EXIT_SUCCESS)
+		data->status = execute_compound_body(node, data);
+	restore_redir_fds(saved_fds);
+	return (data->status);
+}
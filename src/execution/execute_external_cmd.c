@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:41:00 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:41:01 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:17:02 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -72,11 +72,9 @@ int	execute_external_command(char **argv, t_shell *data)
 	init_status = init_execution(argv, data, &path, &envp);
 	if (init_status != 0)
 		exit (init_status);
-	if (data->curr_ast)
-		close_all_heredocs(data->curr_ast);
 	execve(path, argv, envp);
-	perror("execve");
+	out_perror("execve");
 	free(path);
-	free_strings_array(envp);
+	free(envp);
 	exit(CMD_NOT_EXECUTABLE);
 }
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_in_shell.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:00:39 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 05:17:42 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Free the function bodies replaced during a function call.
+ *
+ * @param data Shell state structure
+ */
+void	release_retired_bodies(t_shell *data)
+{
+	t_list	*next;
+
+	while (data->retired_bodies)
+	{
+		next = data->retired_bodies->next;
+		free_ast(data->retired_bodies->content);
+		free(data->retired_bodies);
+		data->retired_bodies = next;
+	}
+}
+
+/**
+ * @brief Call a shell function with the command arguments.
+ *
+ * The expanded argv of the calling node becomes the positional parameters
+ * without being copied: the node gives it away, so a recursive call that
+ * re-expands the same node cannot free it. The body is walked in the
+ * current process; only its external commands fork.
+ *
+ * @param func Function to call
+ * @param node Calling NODE_CMD node (argv[0] is the function name)
+ * @param data Shell state structure
+ * @return Status of the last command of the body, or the `return` value
+ */
+static int	call_function(t_func *func, t_ast *node, t_shell *data)
+{
+	char	**args;
+	char	**saved_params;
+	bool	saved_can_exec;
+
+	args = node->argv;
+	node->argv = NULL;
+	saved_params = data->pos_params;
+	saved_can_exec = data->can_exec;
+	data->pos_params = args + 1;
+	data->can_exec = false;
+	data->func_depth++;
+	data->status = execute_ast_tree(func->body, data);
+	data->func_depth--;
+	data->returning = false;
+	data->can_exec = saved_can_exec;
+	data->pos_params = saved_params;
+	free_strings_array(args);
+	if (data->func_depth == 0)
+		release_retired_bodies(data);
+	return (data->status);
+}
+
+/**
+ * @brief Run a function or a builtin in the shell process.
+ *
+ * Builtins flush their buffered output before returning, so it reaches
+ * the redirection before the caller restores the standard streams.
+ *
+ * @param node NODE_CMD node
+ * @param func Function to call, or NULL to run the builtin node->value
+ * @param data Shell state structure
+ * @return Exit status, stored in `data->status`
+ */
+static int	run_in_shell(t_ast *node, t_func *func, t_shell *data)
+{
+	if (func)
+		return (call_function(func, node, data));
+	data->status = execute_builtin(node, data);
+	return (data->status);
+}
+
+/**
+ * @brief Run a function or a builtin without forking.
+ *
+ * Redirections are applied around the command and the standard streams
+ * restored afterwards, so that `cd`/`export`/... and function bodies can
+ * modify the shell state. Nothing is restored after a bare `exec`, which
+ * is how a script opens or closes its own descriptors for good, nor in a
+ * child that exits after this command (`data->can_exec`).
+ *
+ * @param node NODE_CMD node
+ * @param func Function to call, or NULL to run the builtin node->value
+ * @param data Shell state structure
+ * @return Exit status, stored in `data->status`
+ */
+int	execute_in_shell(t_ast *node, t_func *func, t_shell *data)
+{
+	int	saved_fds[REDIR_FD_MAX];
+
+	if (!node->right)
+		return (run_in_shell(node, func, data));
+	if (data->can_exec
+		|| (!func && !node->argv[1] && ft_strcmp(node->value, "exec") == 0))
+	{
+		if (apply_redirections(node->right, data) == EXIT_SUCCESS)
+			run_in_shell(node, func, data);
+		return (data->status);
+	}
+	if (save_redir_fds(node->right, saved_fds) == -1)
+		return (EXIT_FAILURE);
+	if (apply_redirections(node->right, data) == EXIT_SUCCESS)
+		run_in_shell(node, func, data);
+	restore_redir_fds(saved_fds);
+	return (data->status);
+}
+
+/**
+ * @brief Execute a function definition: store a copy of its body.
+ *
+ * The line the definition was parsed from is freed after execution, so
+ * the table keeps its own copy of the already parsed body.
+ *
+ * @param node NODE_FUNCTION node (value: name, left: body)
+ * @param data Shell state structure
+ * @return EXIT_SUCCESS, or EXIT_FAILURE on allocation failure
+ */
+int	define_function(t_ast *node, t_shell *data)
+{
+	t_ast	*body;
+
+	data->status = EXIT_FAILURE;
+	body = copy_ast(node->left);
+	if (!body)
+		return (data->status);
+	if (store_function(data, node->value, body) == -1)
+		return (data->status);
+	data->status = EXIT_SUCCESS;
+	return (data->status);
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_loops.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:39:36 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Consume pending loop control and tell if the loop must end.
+ *
+ * `break n` leaves n nested loops: each loop consumes one level.
+ * `continue n` leaves n - 1 loops, then resumes the next iteration of the
+ * n-th one. `exit`, `return`, a `${name?word}` error and Ctrl-C end
+ * every loop.
+ *
+ * @param data Shell state structure
+ * @return true if the current loop must stop iterating
+ */
+static bool	loop_must_exit(t_shell *data)
+{
+	if (data->break_count > 0)
+	{
+		data->break_count--;
+		return (true);
+	}
+	if (data->continue_count > 1)
+	{
+		data->continue_count--;
+		return (true);
+	}
+	data->continue_count = 0;
+	if (g_signal_received == SIGINT)
+	{
+		data->status = EXIT_SIGINT;
+		return (true);
+	}
+	return (data->should_exit || data->returning || data->aborting);
+}
+
+/**
+ * @brief Execute a `while` or `until` loop.
+ *
+ * The condition and body subtrees were parsed once and are executed again
+ * on each iteration; only their words are re-expanded.
+ *
+ * @param node NODE_WHILE or NODE_UNTIL node (left: condition, right: body)
+ * @param data Shell state structure
+ * @return Status of the last body command, 0 if the body never ran
+ */
+int	execute_while(t_ast *node, t_shell *data)
+{
+	int	status;
+	int	cond;
+
+	status = EXIT_SUCCESS;
+	data->loop_depth++;
+	while (1)
+	{
+		cond = execute_ast_tree(node->left, data);
+		if (loop_must_exit(data))
+			break ;
+		if ((cond == EXIT_SUCCESS) != (node->type == NODE_WHILE))
+			break ;
+		status = execute_ast_tree(node->right, data);
+		if (loop_must_exit(data))
+			break ;
+	}
+	data->loop_depth--;
+	if (data->should_exit || data->returning || data->aborting
+		|| g_signal_received == SIGINT)
+		return (data->status);
+	data->status = status;
+	return (status);
+}
+
+/**
+ * @brief Expand the word list of a `for` loop.
+ *
+ * Without an `in` clause the loop iterates over the positional
+ * parameters: empty outside of a function call.
+ *
+ * @param node NODE_FOR node
+ * @param data Shell state structure
+ * @return NULL-terminated array of values, or NULL on allocation failure
+ */
+static char	**expand_for_values(t_ast *node, t_shell *data)
+{
+	if (!node->words && !data->pos_params)
+		return (ft_calloc(1, sizeof(char *)));
+	if (!node->words)
+		return (copy_strings_array(data->pos_params));
+	return (expand_argv(node->words, data));
+}
+
+/**
+ * @brief Run the body of a `for` loop once per value.
+ *
+ * @param node NODE_FOR node (value: variable name, right: body)
+ * @param values Expanded values to assign in turn
+ * @param data Shell state structure
+ * @return Status of the last body command, 0 if the body never ran
+ */
+static int	run_for_body(t_ast *node, char **values, t_shell *data)
+{
+	int	status;
+	int	i;
+
+	status = EXIT_SUCCESS;
+	i = 0;
+	while (values[i])
+	{
+		status = EXIT_FAILURE;
+		if (set_env_value(&data->env_list, node->value, values[i++]) == -1)
+			break ;
+		status = execute_ast_tree(node->right, data);
+		if (loop_must_exit(data))
+			break ;
+	}
+	return (status);
+}
+
+/**
+ * @brief Execute a `for name in words; do body; done` loop.
+ *
+ * The words are expanded once, when the loop starts. The variable is
+ * then assigned each value in turn before running the body.
+ *
+ * @param node NODE_FOR node (value: variable name, right: body)
+ * @param data Shell state structure
+ * @return Status of the last body command, 0 if the body never ran
+ */
+int	execute_for(t_ast *node, t_shell *data)
+{
+	char	**values;
+	int		status;
+
+	values = expand_for_values(node, data);
+	if (!values)
+	{
+		data->status = EXIT_FAILURE;
+		return (data->status);
+	}
+	data->loop_depth++;
+	status = run_for_body(node, values, data);
+	data->loop_depth--;
+	free_strings_array(values);
+	if (data->should_exit || data->returning || data->aborting
+		|| g_signal_received == SIGINT)
+		return (data->status);
+	data->status = status;
+	return (status);
+}
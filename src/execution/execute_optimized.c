@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_optimized.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:28:16 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:30:29 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Open the file of a `cat FILE | cmd` pipe if cat can be skipped.
+ *
+ * Only a readable regular file is used: cat would copy it unchanged. For
+ * anything else (missing file, directory, fifo) cat runs and reports, and
+ * a shell function named cat keeps the pipeline as written.
+ *
+ * @param node Pipe node marked by optimize_ast()
+ * @param data Shell state structure
+ * @return The open file (close-on-exec), or -1 to run the pipeline
+ */
+static int	open_cat_file(t_ast *node, t_shell *data)
+{
+	struct stat	st;
+	int			fd;
+
+	if (!node->filename || find_function(data, "cat"))
+		return (-1);
+	fd = open(node->filename, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (-1);
+	if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode))
+	{
+		close(fd);
+		return (-1);
+	}
+	return (fd);
+}
+
+/**
+ * @brief Run `cat FILE | cmd` as `cmd < FILE` when possible.
+ *
+ * The right side is forked as in any pipeline, with FILE as its standard
+ * input instead of the read end of a pipe fed by cat.
+ *
+ * @param node Pipe node
+ * @param data Shell state structure
+ * @return true if the pipeline was run (status in `data->status`), false
+ *         if it must run as written
+ */
+bool	execute_cat_shortcut(t_ast *node, t_shell *data)
+{
+	int		fds[2];
+	pid_t	pid;
+
+	fds[0] = open_cat_file(node, data);
+	if (fds[0] == -1)
+		return (false);
+	fds[1] = -1;
+	pid = fork_right_child(node, data, fds);
+	close(fds[0]);
+	if (pid == -1)
+		data->status = EXIT_FAILURE;
+	else
+		wait_pipeline(-1, pid, data);
+	return (true);
+}
+
+/**
+ * @brief Apply the redirections of a command in a child, like any other
+ * command: the files are created or checked, then the child exits.
+ *
+ * @param redirs First redirection node
+ * @param data Shell state structure
+ * @return Exit status of the child, stored in `data->status`
+ */
+static int	redirect_in_child(t_ast *redirs, t_shell *data)
+{
+	pid_t	pid;
+
+	pid = fork();
+	if (pid == -1)
+	{
+		out_perror("fork");
+		data->status = EXIT_FAILURE;
+		return (data->status);
+	}
+	if (pid == 0)
+	{
+		setup_signals_child();
+		data->is_child = true;
+		exit(apply_redirections(redirs, data));
+	}
+	return (wait_pipeline(-1, pid, data));
+}
+
+/**
+ * @brief Execute a command made only of redirections (`> file`).
+ *
+ * Files are created or checked as for any command. When optimize_ast()
+ * marked the command, this happens in the shell process: the redirected
+ * fds are saved and restored around them. Otherwise it forks. In a child
+ * they are simply applied.
+ *
+ * @param redirs First redirection node
+ * @param data Shell state structure
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if a redirection failed
+ */
+int	execute_redirect_only(t_ast *redirs, t_shell *data)
+{
+	int	saved_fds[REDIR_FD_MAX];
+
+	if (!redirs->in_shell && !data->is_child)
+		return (redirect_in_child(redirs, data));
+	if (!data->is_child && save_redir_fds(redirs, saved_fds) == -1)
+		return (EXIT_FAILURE);
+	data->status = apply_redirections(redirs, data);
+	if (!data->is_child)
+		restore_redir_fds(saved_fds);
+	return (data->status);
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:41:05 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 17:41:06 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:28:16 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -31,28 +31,23 @@
  * 2. Close the unused read end of the pipe (`pipefd[0]`).
  * 3. Redirect `STDOUT_FILENO` to the pipe’s write end via `dup2()`.
  * 4. Close the write end after duplication to avoid file descriptor leaks.
- * 5. Recursively execute the left subtree of the AST.
+ * 5. Recursively execute the left subtree of the AST. A simple command
+ *    may replace this process (`data->can_exec`); a compound one forks
+ *    for each of its external commands.
  * 6. Exit the process using the current shell status.
  */
 static void	execute_left_child(t_ast *node, t_shell *data, int pipefd[2])
 {
 	setup_signals_child();
 	data->is_child = true;
-	close(pipefd[0]);
+	close_fds(&pipefd[0]);
 	if (dup2(pipefd[1], STDOUT_FILENO) == -1)
 	{
-		perror("dup2");
-		close(pipefd[1]);
+		out_perror("dup2");
 		exit(EXIT_FAILURE);
 	}
-	close(pipefd[1]);
-	if (node->left && node->left->right)
-	{
-		if (apply_redirections(node->left->right, data) != EXIT_SUCCESS)
-			exit(data->status);
-	}
-	if (data->curr_ast)
-		close_all_heredocs(data->curr_ast);
+	close_fds(&pipefd[1]);
+	data->can_exec = (node->left && node->left->type == NODE_CMD);
 	execute_ast_tree(node->left, data);
 	exit(data->status);
 }
@@ -81,7 +76,7 @@ static	pid_t	fork_left_child(t_ast *node, t_shell *data, int pipefd[2])
 	pid = fork();
 	if (pid == -1)
 	{
-		perror("fork left");
+		out_perror("fork left");
 		return (-1);
 	}
 	if (pid == 0)
@@ -109,21 +104,14 @@ static void	execute_right_child(t_ast *node, t_shell *data, int pipefd[2])
 {
 	setup_signals_child();
 	data->is_child = true;
-	close(pipefd[1]);
+	close_fds(&pipefd[1]);
 	if (dup2(pipefd[0], STDIN_FILENO) == -1)
 	{
-		perror("dup2");
-		close(pipefd[0]);
+		out_perror("dup2");
 		exit(EXIT_FAILURE);
 	}
-	close(pipefd[0]);
-	if (node->right && node->right->right)
-	{
-		if (apply_redirections(node->right->right, data) != EXIT_SUCCESS)
-			exit(data->status);
-	}
-	if (data->curr_ast)
-		close_all_heredocs(data->curr_ast);
+	close_fds(&pipefd[0]);
+	data->can_exec = (node->right && node->right->type == NODE_CMD);
 	execute_ast_tree(node->right, data);
 	exit(data->status);
 }
@@ -143,6 +131,9 @@ static void	execute_right_child(t_ast *node, t_shell *data, int pipefd[2])
  *
  * @return The PID of the forked child process on success, or -1 on failure.
  *
+ * @note Also used with a file instead of a pipe (pipefd[1] is then -1),
+ *       see execute_cat_shortcut().
+ *
  * @details
  * Steps performed:
  * 1. Call `fork()` to create a new process.
@@ -151,14 +142,14 @@ static void	execute_right_child(t_ast *node, t_shell *data, int pipefd[2])
  * 3. In the parent:
  *      - Return the PID of the right child for later `waitpid()` calls.
  */
-static pid_t	fork_right_child(t_ast *node, t_shell *data, int pipefd[2])
+pid_t	fork_right_child(t_ast *node, t_shell *data, int pipefd[2])
 {
 	pid_t	pid;
 
 	pid = fork();
 	if (pid == -1)
 	{
-		perror("fork right");
+		out_perror("fork right");
 		return (-1);
 	}
 	if (pid == 0)
@@ -170,8 +161,9 @@ static pid_t	fork_right_child(t_ast *node, t_shell *data, int pipefd[2])
  * @brief Execute a pipeline node in the AST.
  *
  * Handles a pipeline between two commands (e.g., `cmd1 | cmd2`):
- * creates a pipe, forks two children, connects their input/output
- * through the pipe, and waits for both processes to finish.
+ * creates a pipe (resized if PIPE_SIZE_VAR is set), forks two children,
+ * connects their input/output through the pipe, and waits for both
+ * processes to finish.
  *
  * @param node AST node representing the pipeline.
  * @param data Shell state structure.
@@ -188,11 +180,12 @@ int	execute_pipeline(t_ast *node, t_shell *data)
 	pid_t	left_pid;
 	pid_t	right_pid;
 
-	if (pipe(pipefd) == -1)
+	if (fd_pipe(pipefd) == -1)
 	{
-		perror("pipe");
+		out_perror("pipe");
 		return (EXIT_FAILURE);
 	}
+	apply_pipe_size(pipefd[1], data);
 	left_pid = fork_left_child(node, data, pipefd);
 	if (left_pid == -1)
 	{
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_registry.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:16:37 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Get the registry of descriptors owned by the shell.
+ *
+ * @return The registry (static storage, starts empty)
+ */
+static t_fd_registry	*fd_registry(void)
+{
+	static t_fd_registry	registry;
+
+	return (&registry);
+}
+
+/**
+ * @brief Record a descriptor owned by the shell.
+ *
+ * The descriptor must be close-on-exec: the registry only serves the
+ * processes that keep running shell code, exec() closes it by itself.
+ * A descriptor below SHELL_FD_MIN is moved up first, so that a script's
+ * `exec 3>file` or `4<&0` never lands on one of the shell's fds.
+ *
+ * @param fd Descriptor (ignored if negative)
+ * @return The descriptor to use from now on (fd itself, or its new
+ *         number), so that the call can wrap the one creating it
+ */
+int	fd_track(int fd)
+{
+	t_fd_registry	*registry;
+	int				high;
+
+	if (fd >= 0 && fd < SHELL_FD_MIN)
+	{
+		high = fcntl(fd, F_DUPFD_CLOEXEC, SHELL_FD_MIN);
+		if (high >= 0)
+		{
+			close(fd);
+			fd = high;
+		}
+	}
+	registry = fd_registry();
+	if (fd >= 0 && registry->count < FD_REGISTRY_SIZE)
+		registry->fds[registry->count++] = fd;
+	return (fd);
+}
+
+/**
+ * @brief Forget a descriptor that is about to be closed.
+ *
+ * The last entry takes the place of the removed one: the order of the
+ * registry does not matter.
+ *
+ * @param fd Descriptor (nothing happens if it is not tracked)
+ */
+void	fd_untrack(int fd)
+{
+	t_fd_registry	*registry;
+	size_t			i;
+
+	registry = fd_registry();
+	i = 0;
+	while (i < registry->count && registry->fds[i] != fd)
+		i++;
+	if (i == registry->count)
+		return ;
+	registry->fds[i] = registry->fds[--registry->count];
+}
+
+/**
+ * @brief Close every descriptor owned by the shell.
+ *
+ * Used by a child that runs a builtin as its last command: it only keeps
+ * its standard descriptors. References to the closed descriptors (heredoc
+ * nodes of the AST) are left dangling, the process exits right after.
+ */
+void	fd_close_all(void)
+{
+	t_fd_registry	*registry;
+
+	registry = fd_registry();
+	while (registry->count > 0)
+		close(registry->fds[--registry->count]);
+}
+
+/**
+ * @brief Create a close-on-exec pipe owned by the shell.
+ *
+ * @param fds Receives the read end in fds[0] and the write end in fds[1]
+ * @return 0 on success, -1 on failure (errno set)
+ */
+int	fd_pipe(int fds[2])
+{
+	if (pipe2(fds, O_CLOEXEC) == -1)
+		return (-1);
+	fds[0] = fd_track(fds[0]);
+	fds[1] = fd_track(fds[1]);
+	return (0);
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:41:09 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:10:27 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,6 +16,7 @@ void	close_fds(int *fd)
 {
 	if (fd && *fd >= 0)
 	{
+		fd_untrack(*fd);
 		close(*fd);
 		*fd = -1;
 	}
@@ -30,6 +31,7 @@ void	close_all_heredocs(t_ast *node)
 	close_all_heredocs(node->left);
 	close_all_heredocs(node->right);
 	close_all_heredocs(node->next);
+	close_all_heredocs(node->redirs);
 }
 
 void	close_pipe_fds(int pipefd[2])
@@ -39,90 +41,75 @@ void	close_pipe_fds(int pipefd[2])
 }
 
 /**
- * @brief Save the standard file descriptors (stdin, stdout, stderr)
+ * @brief Save the descriptors that a list of redirections replaces.
  *
- * Duplicates the three standard FDs so they can be restored later.
- * Initializes all elements to -1 to safely track partial failures.
+ * Only the targets the redirections actually touch are saved, each once
+ * however many redirections name it: `> out` costs one dup, not three.
+ * The copies are close-on-exec, tracked in the fd registry and placed at
+ * SHELL_FD_MIN or above, out of the way of the single digit descriptors
+ * scripts use. A target that is not open is marked FD_WAS_CLOSED, so that
+ * restoring closes it again.
  *
- * @param saved_fds Array of 3 ints to store the duplicated FDs.
- * @return EXIT_SUCCESS on success, EXIT_FAILURE if any dup() fails.
+ * @param redirs First redirection node (NODE_REDIR, linked by `next`)
+ * @param saved_fds Indexed by target fd, receives the copies (-1 if the
+ *                  target is not redirected)
+ * @return 0 on success, -1 on failure (nothing left saved)
  */
-int	save_std_fds(int saved_fds[3])
+int	save_redir_fds(t_ast *redirs, int saved_fds[REDIR_FD_MAX])
 {
-	memset(saved_fds, -1, sizeof(int) * 3);
-	saved_fds[0] = dup(STDIN_FILENO);
-	if (saved_fds[0] == -1)
-		return (perror("dup"), EXIT_FAILURE);
-	saved_fds[1] = dup(STDOUT_FILENO);
-	if (saved_fds[1] == -1)
-	{
-		perror("dup");
-		close(saved_fds[0]);
-		saved_fds[0] = -1;
-		return (EXIT_FAILURE);
-	}
-	saved_fds[2] = dup(STDERR_FILENO);
-	if (saved_fds[2] == -1)
+	int	target;
+
+	memset(saved_fds, -1, sizeof(int) * REDIR_FD_MAX);
+	while (redirs && redirs->type == NODE_REDIR)
 	{
-		perror("dup");
-		close(saved_fds[0]);
-		close(saved_fds[1]);
-		saved_fds[0] = -1;
-		saved_fds[1] = -1;
-		return (EXIT_FAILURE);
+		target = redir_target_fd(redirs);
+		if (target < REDIR_FD_MAX && saved_fds[target] == -1)
+		{
+			saved_fds[target] = fd_track(fcntl(target, F_DUPFD_CLOEXEC,
+						SHELL_FD_MIN));
+			if (saved_fds[target] == -1 && errno == EBADF)
+				saved_fds[target] = FD_WAS_CLOSED;
+			else if (saved_fds[target] == -1)
+			{
+				out_perror("dup");
+				restore_redir_fds(saved_fds);
+				return (-1);
+			}
+		}
+		redirs = redirs->next;
 	}
-	return (EXIT_SUCCESS);
+	return (0);
 }
 
 /**
- * @brief Restore the standard file descriptors (stdin, stdout, stderr) from
- * saved copies.
- *
- * This function restores the three standard file descriptors using previously
- * saved
- * duplicates in the `saved_fds` array. It safely handles cases where some FDs
- * were
- * never saved (i.e., remain negative), preventing spurious errors.
- *
- * After restoring each FD, the corresponding entry in `saved_fds` is set to -1
- * to prevent accidental reuse.
+ * @brief Put back the descriptors saved by save_redir_fds().
  *
- * @param saved_fds An array of three integers containing saved duplicates of
- *                  STDIN_FILENO, STDOUT_FILENO, and STDERR_FILENO, in that
- * order.
- *                  Values < 0 are ignored.
+ * Each saved copy is moved back onto its target and closed; a target that
+ * was not open before the redirections is closed. Entries are reset to
+ * -1 to prevent accidental reuse.
  *
- * @details
- * - Attempts to restore only valid (>= 0) saved FDs.
- * - If `dup2()` fails for any FD, prints an informative error via `perror()`,
- *   but continues restoring the remaining FDs.
- * - Closes each saved FD after restoration to avoid leaks.
+ * @param saved_fds Copies indexed by target fd, as filled by
+ *                  save_redir_fds()
  *
- * @note This function is useful for builtins or commands with temporary
- *       redirections where the original standard streams must be restored
- *       after execution.
+ * @details If `dup2()` fails for a target, prints an error but continues
+ *          restoring the remaining ones.
  */
-void	restore_std_fds(int saved_fds[3])
+void	restore_redir_fds(int saved_fds[REDIR_FD_MAX])
 {
-	if (saved_fds[0] >= 0)
-	{
-		if (dup2(saved_fds[0], STDIN_FILENO) == -1)
-			perror("restore stdin");
-		close(saved_fds[0]);
-		saved_fds[0] = -1;
-	}
-	if (saved_fds[1] >= 0)
-	{
-		if (dup2(saved_fds[1], STDOUT_FILENO) == -1)
-			perror("restore stdout");
-		close(saved_fds[1]);
-		saved_fds[1] = -1;
-	}
-	if (saved_fds[2] >= 0)
+	int	target;
+
+	target = 0;
+	while (target < REDIR_FD_MAX)
 	{
-		if (dup2(saved_fds[2], STDERR_FILENO) == -1)
-			perror("restore stderr");
-		close(saved_fds[2]);
-		saved_fds[2] = -1;
+		if (saved_fds[target] >= 0)
+		{
+			if (dup2(saved_fds[target], target) == -1)
+				out_perror("dup2");
+			close_fds(&saved_fds[target]);
+		}
+		else if (saved_fds[target] == FD_WAS_CLOSED)
+			close(target);
+		saved_fds[target] = -1;
+		target++;
 	}
 }
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   function_table.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:59:13 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 01:59:13 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Hash a function name into a bucket index (djb2).
+ *
+ * @param name Function name
+ * @return Bucket index in [0, FUNC_TABLE_SIZE)
+ */
+static size_t	hash_name(const char *name)
+{
+	size_t	hash;
+
+	hash = 5381;
+	while (*name)
+		hash = hash * 33 + (unsigned char)*name++;
+	return (hash & (FUNC_TABLE_SIZE - 1));
+}
+
+/**
+ * @brief Give an existing function a new body.
+ *
+ * The old body may still be running (a function redefining itself), so
+ * while a function call is in progress it is only retired, and freed by
+ * release_retired_bodies() once the outermost call returns.
+ *
+ * @param data Shell state structure
+ * @param func Function to update
+ * @param body New body (ownership is taken, freed on error)
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	replace_body(t_shell *data, t_func *func, t_ast *body)
+{
+	t_list	*retired;
+
+	if (data->func_depth == 0)
+		free_ast(func->body);
+	else
+	{
+		retired = ft_lstnew(func->body);
+		if (!retired)
+			return (free_ast(body), -1);
+		ft_lstadd_front(&data->retired_bodies, retired);
+	}
+	func->body = body;
+	return (0);
+}
+
+/**
+ * @brief Look up a shell function by name.
+ *
+ * Called for every simple command before builtins and PATH search, so it
+ * only costs a hash and a short chain walk.
+ *
+ * @param data Shell state structure
+ * @param name Command name
+ * @return The function, or NULL if no function has that name
+ */
+t_func	*find_function(t_shell *data, const char *name)
+{
+	t_func	*func;
+
+	if (!name)
+		return (NULL);
+	func = data->functions[hash_name(name)];
+	while (func && ft_strcmp(func->name, name) != 0)
+		func = func->next;
+	return (func);
+}
+
+/**
+ * @brief Add or replace a function in the table.
+ *
+ * @param data Shell state structure
+ * @param name Function name (copied)
+ * @param body Function body (ownership is taken, freed on error)
+ * @return 0 on success, -1 on allocation failure
+ */
+int	store_function(t_shell *data, const char *name, t_ast *body)
+{
+	t_func	*func;
+	size_t	bucket;
+
+	func = find_function(data, name);
+	if (func)
+		return (replace_body(data, func, body));
+	func = ft_calloc(1, sizeof(t_func));
+	if (func)
+		func->name = ft_strdup(name);
+	if (!func || !func->name)
+		return (free(func), free_ast(body), -1);
+	bucket = hash_name(name);
+	func->body = body;
+	func->next = data->functions[bucket];
+	data->functions[bucket] = func;
+	return (0);
+}
+
+/**
+ * @brief Free every function of the table.
+ *
+ * @param data Shell state structure
+ */
+void	free_function_table(t_shell *data)
+{
+	t_func	*func;
+	t_func	*next;
+	size_t	i;
+
+	i = 0;
+	while (i < FUNC_TABLE_SIZE)
+	{
+		func = data->functions[i];
+		while (func)
+		{
+			next = func->next;
+			free(func->name);
+			free_ast(func->body);
+			free(func);
+			func = next;
+		}
+		data->functions[i] = NULL;
+		i++;
+	}
+	release_retired_bodies(data);
+}
@@ -6,29 +6,12 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 17:41:15 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 19:29:25 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 04:35:23 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
-/**
- * @brief Handles SIGINT interruption during heredoc input.
- *
- * @param line Current line being read (may be NULL)
- * @param pipefd Pipe file descriptors to close
- * @return Always returns -1 to indicate interruption
- */
-static int	handle_heredoc_interrupt(char *line, int pipefd[2])
-{
-	if (line)
-		free(line);
-	close(pipefd[0]);
-	close(pipefd[1]);
-	setup_signals_interactive();
-	return (-1);
-}
-
 /**
  * @brief Handles error case when heredoc creation fails.
  *
@@ -48,82 +31,88 @@ static void	handle_heredoc_error(t_ast *node, t_shell *data)
 }
 
 /**
- * @brief Reads heredoc lines until limiter or interruption.
- *
- * @param limiter Delimiter string
- * @param pipefd Pipe file descriptors
- * @return 0 on success, -1 on interruption
- */
-static int	read_heredoc_lines(const char *limiter, int pipefd[2])
-{
-	char	*line;
-
-	while (1)
-	{
-		line = readline("> ");
-		if (!line)
-		{
-			if (g_signal_received == SIGINT)
-				return (handle_heredoc_interrupt(NULL, pipefd));
-			print_error(ERR_PREFIX, ERR_HEREDOC_EOF, NULL, NULL);
-			break ;
-		}
-		if (g_signal_received == SIGINT)
-			return (handle_heredoc_interrupt(line, pipefd));
-		if (ft_strcmp(line, limiter) == 0)
-		{
-			free(line);
-			break ;
-		}
-		ft_putendl_fd(line, pipefd[1]);
-		free(line);
-	}
-	return (0);
-}
-
-/**
- * @brief Creates a pipe and fills it with the contents of a heredoc.
+ * @brief Creates a heredoc storage and fills it with the heredoc contents.
  *
  * This function reads lines from the terminal until the specified
  * limiter is reached. Each line is written to the write end of a
- * newly created pipe. The write end is closed after all lines
- * are written, leaving the read end open for later use in input
- * redirection.
+ * newly created storage (see `open_heredoc_store()`). The write end is
+ * closed after all lines are written, leaving the read end open for
+ * later use in input redirection.
  *
- * @param limiter The string that ends the heredoc input.
- * @return The file descriptor of the read end of the pipe on success,
- *         or -1 if pipe creation fails.
+ * @param raw_limiter The string that ends the heredoc input, quotes
+ *                    included (they are removed here).
+ * @param data Shell state structure
+ * @return The file descriptor of the read end on success,
+ *         or -1 if the storage creation fails.
  *
  * @details
- * - Uses `readline()` to read input from the user.
- * - Writes each line followed by a newline to the pipe.
+ * - Uses `readline()` to read input from the user, `read_script_line()`
+ *   in a script.
+ * - Writes each line followed by a newline to the storage.
  * - Frees each line after writing.
- * - Closes the write end of the pipe to signal EOF to readers.
+ * - Closes the write end to signal EOF to readers.
  */
-static int	create_heredoc_fd(const char *limiter)
+static int	create_heredoc_fd(const char *raw_limiter, t_shell *data)
 {
-	int	pipefd[2];
-	int	status;
+	int		pipefd[2];
+	int		status;
+	char	*limiter;
 
-	if (pipe(pipefd) == -1)
-	{
-		perror("pipe");
+	limiter = trim_quotes(raw_limiter);
+	if (!limiter)
 		return (-1);
+	if (open_heredoc_store(pipefd) == -1)
+	{
+		out_perror("heredoc");
+		return (free(limiter), -1);
 	}
 	setup_signals_heredoc();
-	status = read_heredoc_lines(limiter, pipefd);
-	close(pipefd[1]);
+	status = read_heredoc_lines(limiter, pipefd, data);
+	free(limiter);
+	close_fds(&pipefd[1]);
 	setup_signals_interactive();
 	if (status == -1)
 		return (-1);
 	return (pipefd[0]);
 }
 
+/**
+ * @brief Read the here-document bodies of one input line.
+ *
+ * Bodies follow the line that holds their `<<`, in order, so they must be
+ * read before the next line of a multi-line command: each store is kept
+ * by its `<<` token and passed on to the redirection nodes built from it.
+ *
+ * @param tokens Tokens of the line just read
+ * @param data Shell state structure
+ * @return EXIT_SUCCESS, EXIT_SIGINT after Ctrl-C, or EXIT_FAILURE
+ */
+int	read_line_heredocs(t_token *tokens, t_shell *data)
+{
+	while (tokens)
+	{
+		if (tokens->op_type == OP_HEREDOC && tokens->next
+			&& tokens->next->type == TOKEN_WORD)
+		{
+			tokens->heredoc_fd = create_heredoc_fd(tokens->next->value, data);
+			if (tokens->heredoc_fd == -1 && g_signal_received == SIGINT)
+			{
+				g_signal_received = 0;
+				return (EXIT_SIGINT);
+			}
+			if (tokens->heredoc_fd == -1)
+				return (EXIT_FAILURE);
+		}
+		tokens = tokens->next;
+	}
+	return (EXIT_SUCCESS);
+}
+
 /**
  * @brief Preprocesses all heredoc redirections in an AST.
  *
  * Recursively traverses the abstract syntax tree (AST) and, for
- * each heredoc redirection node, creates a pipe containing the
+ * each heredoc redirection node, creates a storage containing the
  * heredoc input. The read file descriptor is stored in the node’s
  * `heredoc_fd` member for later use during execution.
  *
@@ -135,8 +124,9 @@ static int	create_heredoc_fd(const char *limiter)
  * @details
  * - Traverses the left subtree first, then the current node, then
  *   the right subtree (in-order traversal).
- * - For each `NODE_REDIR` node with `op_type == OP_HEREDOC`,
- *   calls `create_heredoc_fd()` to generate the pipe.
+ * - For each `NODE_REDIR` node with `op_type == OP_HEREDOC` whose body
+ *   was not read with its line already (see read_line_heredocs()),
+ *   calls `create_heredoc_fd()` to fill the storage.
  * - On failure, sets `data->status` to `EXIT_FAILURE` and
  *   propagates the error.
  */
@@ -149,9 +139,10 @@ int	preprocess_heredocs(t_ast *node, t_shell *data)
 	if (node->left)
 		if (preprocess_heredocs(node->left, data) != EXIT_SUCCESS)
 			return (EXIT_FAILURE);
-	if (node->type == NODE_REDIR && node->op_type == OP_HEREDOC)
+	if (node->type == NODE_REDIR && node->op_type == OP_HEREDOC
+		&& node->heredoc_fd == -1)
 	{
-		fd = create_heredoc_fd(node->filename);
+		fd = create_heredoc_fd(node->filename, data);
 		if (fd == -1)
 			return (handle_heredoc_error(node, data), EXIT_FAILURE);
 		node->heredoc_fd = fd;
@@ -162,5 +153,8 @@ int	preprocess_heredocs(t_ast *node, t_shell *data)
 	if (node->next)
 		if (preprocess_heredocs(node->next, data) != EXIT_SUCCESS)
 			return (EXIT_FAILURE);
+	if (node->redirs)
+		if (preprocess_heredocs(node->redirs, data) != EXIT_SUCCESS)
+			return (EXIT_FAILURE);
 	return (EXIT_SUCCESS);
 }
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_read.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:14:51 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:35:23 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Handles SIGINT interruption during heredoc input.
+ *
+ * @param line Current line being read (may be NULL)
+ * @param pipefd Pipe file descriptors to close
+ * @return Always returns -1 to indicate interruption
+ */
+static int	handle_heredoc_interrupt(char *line, int pipefd[2])
+{
+	if (line)
+		free(line);
+	close_pipe_fds(pipefd);
+	setup_signals_interactive();
+	return (-1);
+}
+
+/**
+ * @brief Read one line of a here-document body.
+ *
+ * A terminal is read with readline() and the "> " prompt; a script is
+ * read with read_script_line(), like its command lines, so that no input
+ * is buffered by one reader and lost to the other.
+ *
+ * @param data Shell state structure
+ * @return The line without its newline, or NULL at end of input
+ */
+static char	*next_heredoc_line(t_shell *data)
+{
+	char	*line;
+	size_t	len;
+
+	if (data->is_tty)
+		return (readline("> "));
+	line = read_script_line(STDIN_FILENO);
+	if (!line)
+		return (NULL);
+	len = ft_strlen(line);
+	if (len > 0 && line[len - 1] == '\n')
+		line[len - 1] = '\0';
+	return (line);
+}
+
+/**
+ * @brief Reads heredoc lines until limiter or interruption.
+ *
+ * @param limiter Delimiter string
+ * @param pipefd Pipe file descriptors
+ * @param data Shell state structure
+ * @return 0 on success, -1 on interruption
+ */
+int	read_heredoc_lines(const char *limiter, int pipefd[2], t_shell *data)
+{
+	char	*line;
+
+	while (1)
+	{
+		line = next_heredoc_line(data);
+		if (!line)
+		{
+			if (g_signal_received == SIGINT)
+				return (handle_heredoc_interrupt(NULL, pipefd));
+			print_error(ERR_PREFIX, ERR_HEREDOC_EOF, NULL, NULL);
+			break ;
+		}
+		if (g_signal_received == SIGINT)
+			return (handle_heredoc_interrupt(line, pipefd));
+		if (ft_strcmp(line, limiter) == 0)
+		{
+			free(line);
+			break ;
+		}
+		ft_putendl_fd(line, pipefd[1]);
+		free(line);
+	}
+	return (0);
+}
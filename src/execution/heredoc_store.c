@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_store.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Try to create the n-th heredoc temporary file.
+ *
+ * The file is opened twice (write end, read end) and unlinked right away,
+ * so it disappears with its last descriptor.
+ *
+ * @param fds Receives the read end in fds[0] and the write end in fds[1]
+ * @param n Serial number used to build a unique file name
+ * @return 0 on success, -1 on failure (errno set, EEXIST if name taken)
+ */
+static int	try_open_store(int fds[2], int n)
+{
+	char	*num;
+	char	*path;
+
+	num = ft_itoa(n);
+	if (!num)
+		return (-1);
+	path = ft_strjoin(HEREDOC_PATH, num);
+	free(num);
+	if (!path)
+		return (-1);
+	fds[1] = open(path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+	if (fds[1] < 0)
+		return (free(path), -1);
+	fds[0] = open(path, O_RDONLY | O_CLOEXEC);
+	unlink(path);
+	free(path);
+	if (fds[0] < 0)
+	{
+		close_fds(&fds[1]);
+		return (-1);
+	}
+	fds[0] = fd_track(fds[0]);
+	fds[1] = fd_track(fds[1]);
+	return (0);
+}
+
+/**
+ * @brief Create the storage that receives the content of a heredoc.
+ *
+ * A temporary file is preferred over a pipe: it has no size limit while
+ * the heredoc is being written, and it can be rewound so that a heredoc
+ * inside a loop is replayed on every iteration. A pipe is used when no
+ * temporary file can be created. Both ends are close-on-exec and tracked
+ * in the fd registry.
+ *
+ * @param fds Receives the read end in fds[0] and the write end in fds[1]
+ * @return 0 on success, -1 on failure
+ */
+int	open_heredoc_store(int fds[2])
+{
+	int	n;
+
+	n = 0;
+	while (n < HEREDOC_MAX_TRIES)
+	{
+		if (try_open_store(fds, n) == 0)
+			return (0);
+		if (errno != EEXIST)
+			break ;
+		n++;
+	}
+	return (fd_pipe(fds));
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_size.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:14:58 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:14:58 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Get the largest pipe capacity an unprivileged process may set.
+ *
+ * Read once from /proc, the limit does not change for the shell's life.
+ *
+ * @return The limit in bytes, or 0 if it could not be read
+ */
+static size_t	pipe_max_size(void)
+{
+	static bool		loaded;
+	static size_t	max_size;
+	char			buf[32];
+	ssize_t			len;
+	int				fd;
+
+	if (loaded)
+		return (max_size);
+	loaded = true;
+	fd = open(PIPE_MAX_SIZE_PATH, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (0);
+	len = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (len <= 0)
+		return (0);
+	buf[len] = '\0';
+	if (!ft_atosize(buf, &max_size))
+		max_size = 0;
+	return (max_size);
+}
+
+/**
+ * @brief Resize a pipeline pipe to the capacity set in PIPE_SIZE_VAR.
+ *
+ * With the default 64 KiB, a writer producing a large stream blocks and
+ * wakes up every 64 KiB; a larger pipe lets both sides of a pipeline move
+ * more data per context switch. The requested size is capped to the
+ * system limit (the kernel rounds it up to a power of two pages).
+ *
+ * @param fd Either end of the pipe
+ * @param data Shell data structure
+ *
+ * @note Best effort: an unset or invalid variable, or a failing fcntl(),
+ *       leaves the pipe at its default size.
+ */
+void	apply_pipe_size(int fd, t_shell *data)
+{
+	t_env	*env;
+	size_t	size;
+	size_t	max_size;
+
+	env = get_env_node_by_key(data->env_list, PIPE_SIZE_VAR);
+	if (!env || !env->value || !ft_atosize(env->value, &size) || size == 0)
+		return ;
+	max_size = pipe_max_size();
+	if (max_size && size > max_size)
+		size = max_size;
+	if (size > INT_MAX)
+		size = INT_MAX;
+	fcntl(fd, F_SETPIPE_SZ, (int)size);
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:01:16 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:08:53 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:28:16 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -49,7 +49,7 @@ int	handle_pipeline_status(int status, t_shell *data)
  * `execute_pipeline()` to terminate. The final exit status of the
  * pipeline is determined by the rightmost command.
  *
- * @param left_pid  PID of the left child process.
+ * @param left_pid  PID of the left child process, -1 if there is none.
  * @param right_pid PID of the right child process.
  * @param pipefd    The pipe file descriptors; both ends are closed here.
  * @param data      Pointer to the shell state structure.
@@ -73,7 +73,8 @@ int	wait_pipeline(pid_t left_pid, pid_t right_pid, t_shell *data)
 	int	sig;
 
 	setup_signals_ignore();
-	waitpid(left_pid, &status_left, 0);
+	if (left_pid > 0)
+		waitpid(left_pid, &status_left, 0);
 	waitpid(right_pid, &status_right, 0);
 	setup_signals_interactive();
 	if (WIFSIGNALED(status_right))
@@ -82,9 +83,10 @@ int	wait_pipeline(pid_t left_pid, pid_t right_pid, t_shell *data)
 		if (sig == SIGQUIT)
 			write(1, "Quit (core dumped)\n", 20);
 		else if (sig == SIGINT)
+		{
 			write(1, "\n", 1);
+			g_signal_received = SIGINT;
+		}
 	}
-	if (data->curr_ast)
-		close_all_heredocs(data->curr_ast);
 	return (handle_pipeline_status(status_right, data));
 }
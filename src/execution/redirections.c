@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:01:48 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:01:49 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,16 +15,22 @@
 /**
  * @brief Determine the target file descriptor for a redirection.
  *
- * This function inspects the given AST node's operator type to decide whether
- * the redirection targets the standard input or output stream.
+ * An operator written with an fd digit (`2>`, `3<&`) targets that fd.
+ * Otherwise this function inspects the given AST node's operator type to
+ * decide whether the redirection targets the standard input or output
+ * stream.
  *
  * @param node Pointer to the AST node representing the redirection.
- * @return STDIN_FILENO if the redirection is an input or heredoc,
+ * @return The fd digit of the operator if any, else STDIN_FILENO if the
+ *         redirection is an input, heredoc or input duplication,
  *         otherwise STDOUT_FILENO.
  */
-static int	get_target_fd(t_ast *node)
+int	redir_target_fd(t_ast *node)
 {
-	if (node->op_type == OP_INPUT || node->op_type == OP_HEREDOC)
+	if (ft_isdigit(node->value[0]))
+		return (node->value[0] - '0');
+	if (node->op_type == OP_INPUT || node->op_type == OP_HEREDOC
+		|| node->op_type == OP_DUP_IN)
 		return (STDIN_FILENO);
 	return (STDOUT_FILENO);
 }
@@ -47,7 +53,7 @@ static int	perform_dup(int fd, int target_fd, t_shell *data)
 {
 	if (dup2(fd, target_fd) == -1)
 	{
-		perror("dup2");
+		out_perror("dup2");
 		close(fd);
 		data->status = EXIT_FAILURE;
 		if (data->is_child)
@@ -58,34 +64,47 @@ static int	perform_dup(int fd, int target_fd, t_shell *data)
 }
 
 /**
- * @brief Redirect a command's standard stream based on its AST node.
+ * @brief Apply a duplication redirection (`N>&M`, `N<&M`, `N>&-`).
  *
- * This function determines whether the redirection should affect STDIN or
- * STDOUT, and then performs the appropriate duplication. It delegates the
- * low-level duplication logic to `perform_dup()`.
+ * The target becomes a copy of the source fd, or is closed for `-`.
+ * Errors are handled like a file that cannot be opened.
  *
- * @param node Pointer to the AST node representing the redirection.
- * @param data Pointer to the shell data structure for error handling.
- * @param fd The file descriptor to redirect from/to.
+ * @param node Redirection node (OP_DUP_IN or OP_DUP_OUT)
+ * @param target Target file descriptor
+ * @param data Pointer to the main shell data structure.
  * @return EXIT_SUCCESS on success, EXIT_FAILURE on failure.
  */
-static int	dup_redirection(t_ast *node, t_shell *data, int fd)
+static int	apply_dup_redirection(t_ast *node, int target, t_shell *data)
 {
-	int	target_fd;
-	int	result;
+	int	src;
+	int	ret;
 
-	target_fd = get_target_fd(node);
-	result = perform_dup(fd, target_fd, data);
-	return (result);
+	ret = dup_redir_source(node, data, &src);
+	if (ret == 0 && src == -1)
+		close(target);
+	else if (ret == 0 && src != target && dup2(src, target) == -1)
+	{
+		out_perror("dup2");
+		ret = -1;
+	}
+	if (ret == 0)
+		return (EXIT_SUCCESS);
+	data->status = EXIT_FAILURE;
+	if (data->is_child)
+		exit(data->status);
+	return (data->status);
 }
 
 /**
  * @brief Apply a single redirection from an AST node.
  *
  * This function handles the setup of one redirection operation. It opens the
- * target file (or uses the heredoc file descriptor) depending on the operator
- * type, and then duplicates the resulting file descriptor to either standard
- * input or output using `dup_redirection()`.
+ * target file (or reuses the heredoc content) via `open_redir_file()`, and
+ * then duplicates the resulting file descriptor to either standard input or
+ * output using `perform_dup()`.
+ *
+ * If the target was closed, the file may already be open on it: it is then
+ * kept as is, only losing its close-on-exec flag.
  *
  * It gracefully handles file open errors, updating the shell status and exiting
  * immediately if the process is a child.
@@ -97,28 +116,23 @@ static int	dup_redirection(t_ast *node, t_shell *data, int fd)
 static int	apply_single_redirection(t_ast *node, t_shell *data)
 {
 	int	fd;
+	int	target;
 	int	result;
 
-	fd = -1;
-	if (node->op_type == OP_INPUT)
-		fd = open(node->filename, O_RDONLY);
-	else if (node->op_type == OP_OUTPUT)
-		fd = open(node->filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
-	else if (node->op_type == OP_APPEND)
-		fd = open(node->filename, O_WRONLY | O_CREAT | O_APPEND, 0644);
-	else if (node->op_type == OP_HEREDOC)
-		fd = node->heredoc_fd;
+	target = redir_target_fd(node);
+	if (node->op_type == OP_DUP_IN || node->op_type == OP_DUP_OUT)
+		return (apply_dup_redirection(node, target, data));
+	fd = open_redir_file(node, data);
 	if (fd < 0)
 	{
-		perror(node->filename);
 		data->status = EXIT_FAILURE;
 		if (data->is_child)
 			exit(data->status);
 		return (data->status);
 	}
-	result = dup_redirection(node, data, fd);
-	if (node->op_type == OP_HEREDOC && result == EXIT_SUCCESS)
-		node->heredoc_fd = -1;
+	if (fd == target)
+		return (fcntl(fd, F_SETFD, 0), EXIT_SUCCESS);
+	result = perform_dup(fd, target, data);
 	close_fds(&fd);
 	return (result);
 }
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redirections_open.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Get a readable descriptor on the content of a heredoc.
+ *
+ * Heredocs are stored in an unlinked temporary file: the content is
+ * rewound and a duplicate is returned, so the same heredoc can feed the
+ * command again on the next loop iteration. If the content lives in a
+ * pipe (fallback), it can only be read once and the node gives it away.
+ *
+ * @param node Heredoc redirection node
+ * @return File descriptor to redirect from, or -1 on error
+ */
+static int	open_heredoc(t_ast *node)
+{
+	int	fd;
+
+	fd = node->heredoc_fd;
+	if (fd < 0)
+		return (-1);
+	if (lseek(fd, 0, SEEK_SET) == 0)
+		return (fcntl(fd, F_DUPFD_CLOEXEC, 0));
+	node->heredoc_fd = -1;
+	return (fd);
+}
+
+/**
+ * @brief Open the file targeted by a redirection.
+ *
+ * The filename is expanded (variables, quotes) at this point, each time
+ * the redirection is applied. Errors are reported with perror().
+ *
+ * @param node Redirection node
+ * @param data Shell state structure
+ * @return Open file descriptor, or -1 on error
+ */
+int	open_redir_file(t_ast *node, t_shell *data)
+{
+	char	*path;
+	int		fd;
+
+	if (node->op_type == OP_HEREDOC)
+	{
+		fd = open_heredoc(node);
+		if (fd < 0)
+			out_perror(node->filename);
+		return (fd);
+	}
+	path = expand_word(node->filename, data);
+	if (!path)
+		return (-1);
+	fd = -1;
+	if (node->op_type == OP_INPUT)
+		fd = open(path, O_RDONLY | O_CLOEXEC);
+	else if (node->op_type == OP_OUTPUT)
+		fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	else if (node->op_type == OP_APPEND)
+		fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if (fd < 0)
+		out_perror(path);
+	free(path);
+	return (fd);
+}
+
+/**
+ * @brief Read the source of a duplication redirection.
+ *
+ * The word is expanded, then must be `-` (close the target) or a single
+ * digit naming an open fd. Larger numbers are the shell's own fds
+ * (SHELL_FD_MIN and above) and are refused like closed ones.
+ *
+ * @param node Redirection node (OP_DUP_IN or OP_DUP_OUT)
+ * @param data Shell state structure
+ * @param src Receives the source fd, or -1 for `-`
+ * @return 0 on success, -1 on error (message printed)
+ */
+int	dup_redir_source(t_ast *node, t_shell *data, int *src)
+{
+	char	*word;
+	size_t	len;
+
+	word = expand_word(node->filename, data);
+	if (!word)
+		return (-1);
+	*src = -1;
+	if (ft_strcmp(word, "-") == 0)
+		return (free(word), 0);
+	len = 0;
+	while (ft_isdigit(word[len]))
+		len++;
+	if (len == 0 || word[len] != '\0')
+		print_error(ERR_PREFIX, word, ERR_AMBIGUOUS_REDIR, NULL);
+	else if (len > 1 || fcntl(word[0] - '0', F_GETFD) == -1)
+		print_error(ERR_PREFIX, word, ERR_BAD_FD, NULL);
+	else
+		*src = word[0] - '0';
+	free(word);
+	if (*src == -1)
+		return (-1);
+	return (0);
+}
@@ -0,0 +1,176 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_eval.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:08:19 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:08:19 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Precedence climbing over the binary operators.
+ *
+ * Parses operators of precedence >= min_prec. Left-associative
+ * operators parse their right operand one level higher; `**` is
+ * right-associative. The right side of a short-circuited `&&`/`||` is
+ * parsed without side effects (`noeval`).
+ *
+ * @param a Arithmetic evaluator state
+ * @param min_prec Lowest precedence accepted at this level
+ * @return Value of the expression
+ */
+static long long	parse_binary(t_arith *a, int min_prec)
+{
+	long long		lhs;
+	long long		rhs;
+	t_arith_binop	binop;
+	int				skip;
+
+	lhs = arith_unary(a);
+	while (!a->error)
+	{
+		arith_skip_spaces(a);
+		if (!arith_binary_op(a, &binop) || binop.prec < min_prec)
+			break ;
+		a->pos += binop.len;
+		skip = (binop.op == ARITH_AND && !lhs)
+			|| (binop.op == ARITH_OR && lhs);
+		a->noeval += skip;
+		rhs = parse_binary(a, binop.prec + (binop.op != ARITH_POW));
+		a->noeval -= skip;
+		lhs = arith_apply(a, binop.op, lhs, rhs);
+	}
+	return (lhs);
+}
+
+/**
+ * @brief Parse a conditional expression: `cond ? expr : expr`.
+ *
+ * Only the selected branch has side effects.
+ *
+ * @param a Arithmetic evaluator state
+ * @return Value of the expression
+ */
+static long long	parse_conditional(t_arith *a)
+{
+	long long	cond;
+	long long	if_true;
+	long long	if_false;
+
+	cond = parse_binary(a, 1);
+	arith_skip_spaces(a);
+	if (a->error || a->expr[a->pos] != '?')
+		return (cond);
+	a->pos++;
+	a->noeval += (cond == 0);
+	if_true = arith_comma(a);
+	a->noeval -= (cond == 0);
+	arith_skip_spaces(a);
+	if (a->expr[a->pos] != ':')
+		return (arith_fail(a, ERR_ARITH_SYNTAX), 0);
+	a->pos++;
+	a->noeval += (cond != 0);
+	if_false = parse_conditional(a);
+	a->noeval -= (cond != 0);
+	if (cond)
+		return (if_true);
+	return (if_false);
+}
+
+/**
+ * @brief Parse an assignment (`x = e`, `x += e`, ...) or a conditional.
+ *
+ * Assignments are right-associative: `x = y = 1` sets both.
+ *
+ * @param a Arithmetic evaluator state
+ * @return Value of the expression (the assigned value for an assignment)
+ */
+long long	arith_assignment(t_arith *a)
+{
+	size_t		start;
+	size_t		len;
+	size_t		op_len;
+	t_arith_op	op;
+	long long	value;
+
+	arith_skip_spaces(a);
+	start = a->pos;
+	len = arith_name_length(a->expr + start);
+	a->pos += len;
+	arith_skip_spaces(a);
+	op_len = 0;
+	if (len > 0)
+		op_len = arith_assign_op(a->expr + a->pos, &op);
+	if (op_len == 0)
+	{
+		a->pos = start;
+		return (parse_conditional(a));
+	}
+	a->pos += op_len;
+	value = arith_assignment(a);
+	if (op != ARITH_NONE)
+		value = arith_apply(a, op, arith_get_var(a, a->expr + start, len),
+				value);
+	return (arith_set_var(a, a->expr + start, len, value));
+}
+
+/**
+ * @brief Parse a comma-separated list of expressions (`i++, j++`).
+ *
+ * @param a Arithmetic evaluator state
+ * @return Value of the last expression
+ */
+long long	arith_comma(t_arith *a)
+{
+	long long	value;
+
+	value = arith_assignment(a);
+	arith_skip_spaces(a);
+	while (!a->error && a->expr[a->pos] == ',')
+	{
+		a->pos++;
+		value = arith_assignment(a);
+		arith_skip_spaces(a);
+	}
+	return (value);
+}
+
+/**
+ * @brief Evaluate an arithmetic expression with 64-bit integers.
+ *
+ * The expression has already been through parameter expansion and quote
+ * removal. An empty expression is 0.
+ *
+ * @param expr Expression text
+ * @param data Shell state (variables are read and assigned)
+ * @param depth Nesting level, for variables holding expressions
+ * @param result Receives the value
+ * @return 0 on success, -1 after an error (already reported)
+ */
+int	arith_evaluate(const char *expr, t_shell *data, int depth,
+	long long *result)
+{
+	t_arith	a;
+
+	a.expr = expr;
+	a.pos = 0;
+	a.data = data;
+	a.noeval = 0;
+	a.depth = depth;
+	a.error = false;
+	*result = 0;
+	arith_skip_spaces(&a);
+	if (!expr[a.pos])
+		return (0);
+	*result = arith_comma(&a);
+	if (!a.error && expr[a.pos])
+		arith_fail(&a, ERR_ARITH_SYNTAX);
+	if (a.error)
+		return (-1);
+	return (0);
+}
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_expand.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:09:13 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:16:55 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Report an arithmetic error, once per evaluation.
+ *
+ * @param a Arithmetic evaluator state
+ * @param msg Error message (ERR_ARITH_*)
+ */
+void	arith_fail(t_arith *a, const char *msg)
+{
+	if (a->error)
+		return ;
+	a->error = true;
+	print_error(ERR_PREFIX, (char *)a->expr, (char *)msg, NULL);
+}
+
+/**
+ * @brief Length of the arithmetic expansion `$(( ... ))` at s[0].
+ *
+ * @param s String at the candidate '$' (outside single quotes)
+ * @return Length up to the closing "))", 0 if there is no expansion here
+ */
+size_t	arith_span(const char *s)
+{
+	size_t	len;
+
+	if (s[0] != '$' || s[1] != '(' || s[2] != '(')
+		return (0);
+	len = 1 + paren_group_length(s + 1);
+	if (len < 5 || s[len - 1] != ')' || s[len - 2] != ')')
+		return (0);
+	return (len);
+}
+
+/**
+ * @brief Evaluate one `$(( ... ))` and append its value to the buffer.
+ *
+ * The expression is expanded first (variables, nested substitutions,
+ * quote removal), then evaluated.
+ *
+ * @param buf Expansion output
+ * @param s String at the '$'
+ * @param span Length of the expansion (see arith_span())
+ * @param data Shell state structure
+ * @return 0 on success, -1 on error (already reported)
+ */
+int	append_arith(t_strbuf *buf, const char *s, size_t span, t_shell *data)
+{
+	char		*expr;
+	char		*digits;
+	long long	value;
+	int			status;
+
+	expr = ft_substr(s, 3, span - 5);
+	if (!expr)
+		return (-1);
+	digits = expand_word(expr, data);
+	free(expr);
+	if (!digits)
+		return (-1);
+	status = arith_evaluate(digits, data, 0, &value);
+	free(digits);
+	if (status != 0)
+		return (-1);
+	digits = ft_lltoa(value);
+	if (!digits)
+		return (-1);
+	status = strbuf_append(buf, digits, ft_strlen(digits));
+	free(digits);
+	return (status);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_lexer.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:07:00 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:07:00 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Skip the blanks (spaces, tabs, newlines) at the cursor.
+ *
+ * @param a Arithmetic evaluator state
+ */
+void	arith_skip_spaces(t_arith *a)
+{
+	while (a->expr[a->pos] && is_whitespace(a->expr[a->pos]))
+		a->pos++;
+}
+
+/**
+ * @brief Length of the variable name starting at s[0].
+ *
+ * @param s Expression text at the cursor
+ * @return Name length, 0 if s does not start with a letter or '_'
+ */
+size_t	arith_name_length(const char *s)
+{
+	size_t	len;
+
+	if (!ft_isalpha(s[0]) && s[0] != '_')
+		return (0);
+	len = 1;
+	while (ft_isalnum(s[len]) || s[len] == '_')
+		len++;
+	return (len);
+}
+
+/**
+ * @brief Recognize the binary operator at the cursor, without consuming it.
+ *
+ * Longer spellings come first in the table. An operator directly
+ * followed by '=' is a compound assignment (`+=`, `<<=`, ...), not a
+ * binary operator.
+ *
+ * @param a Arithmetic evaluator state, positioned after blanks
+ * @param binop Receives the operator description
+ * @return true if a binary operator was found
+ */
+bool	arith_binary_op(t_arith *a, t_arith_binop *binop)
+{
+	static const t_arith_binop	ops[] = {
+	{"||", 2, ARITH_OR, 1}, {"&&", 2, ARITH_AND, 2}, {"==", 2, ARITH_EQ, 6},
+	{"!=", 2, ARITH_NE, 6}, {"<=", 2, ARITH_LE, 7}, {">=", 2, ARITH_GE, 7},
+	{"<<", 2, ARITH_SHL, 8}, {">>", 2, ARITH_SHR, 8}, {"**", 2, ARITH_POW, 11},
+	{"|", 1, ARITH_BOR, 3}, {"^", 1, ARITH_XOR, 4}, {"&", 1, ARITH_BAND, 5},
+	{"<", 1, ARITH_LT, 7}, {">", 1, ARITH_GT, 7}, {"+", 1, ARITH_ADD, 9},
+	{"-", 1, ARITH_SUB, 9}, {"*", 1, ARITH_MUL, 10}, {"/", 1, ARITH_DIV, 10},
+	{"%", 1, ARITH_MOD, 10}, {NULL, 0, ARITH_NONE, 0}};
+	const char					*s;
+	int							i;
+
+	s = a->expr + a->pos;
+	i = 0;
+	while (ops[i].str && ft_strncmp(s, ops[i].str, ops[i].len) != 0)
+		i++;
+	if (!ops[i].str)
+		return (false);
+	if (s[ops[i].len] == '=' && (ops[i].op >= ARITH_SHL
+			|| (ops[i].op >= ARITH_BOR && ops[i].op <= ARITH_BAND)))
+		return (false);
+	*binop = ops[i];
+	return (true);
+}
+
+/**
+ * @brief Recognize an assignment operator: `=` or a compound one.
+ *
+ * @param s Expression text after the variable name and blanks
+ * @param op Receives the operator combined with the value (ARITH_NONE for
+ *           a plain `=`)
+ * @return Length of the assignment operator, 0 if there is none
+ */
+size_t	arith_assign_op(const char *s, t_arith_op *op)
+{
+	static const t_arith_binop	ops[] = {
+	{"<<=", 3, ARITH_SHL, 0}, {">>=", 3, ARITH_SHR, 0},
+	{"+=", 2, ARITH_ADD, 0}, {"-=", 2, ARITH_SUB, 0}, {"*=", 2, ARITH_MUL, 0},
+	{"/=", 2, ARITH_DIV, 0}, {"%=", 2, ARITH_MOD, 0}, {"&=", 2, ARITH_BAND, 0},
+	{"^=", 2, ARITH_XOR, 0}, {"|=", 2, ARITH_BOR, 0}, {"**=", 3, ARITH_POW, 0},
+	{NULL, 0, ARITH_NONE, 0}};
+	int							i;
+
+	*op = ARITH_NONE;
+	if (s[0] == '=' && s[1] != '=')
+		return (1);
+	i = 0;
+	while (ops[i].str && ft_strncmp(s, ops[i].str, ops[i].len) != 0)
+		i++;
+	*op = ops[i].op;
+	return (ops[i].len);
+}
+
+/**
+ * @brief Read an integer constant: decimal, octal (0...) or hex (0x...).
+ *
+ * Overflowing constants wrap around, like bash.
+ *
+ * @param a Arithmetic evaluator state, positioned on a digit
+ * @return The value read (0 after an error)
+ */
+long long	arith_read_number(t_arith *a)
+{
+	unsigned long long	value;
+	int					base;
+	int					digit;
+
+	base = 10;
+	if (a->expr[a->pos] == '0')
+		base = 8;
+	if (base == 8 && ft_tolower(a->expr[a->pos + 1]) == 'x')
+	{
+		base = 16;
+		a->pos += 2;
+	}
+	value = 0;
+	while (ft_isalnum(a->expr[a->pos]))
+	{
+		digit = ft_tolower(a->expr[a->pos]) - '0';
+		if (!ft_isdigit(a->expr[a->pos]))
+			digit = ft_tolower(a->expr[a->pos]) - 'a' + 10;
+		if (digit >= base)
+			return (arith_fail(a, ERR_ARITH_BASE), 0);
+		value = value * base + digit;
+		a->pos++;
+	}
+	return ((long long)value);
+}
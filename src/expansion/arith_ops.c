@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_ops.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:07:26 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:07:26 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Logical, bitwise and comparison operators.
+ *
+ * Logical and comparison operators give 1 or 0. The short-circuit of
+ * `&&` and `||` is handled by the parser, which skips the evaluation
+ * of the right operand.
+ *
+ * @param op ARITH_OR to ARITH_GE
+ * @param lhs Left operand
+ * @param rhs Right operand
+ * @return Result of the operation
+ */
+static long long	arith_logic(t_arith_op op, long long lhs, long long rhs)
+{
+	if (op == ARITH_OR)
+		return (lhs || rhs);
+	if (op == ARITH_AND)
+		return (lhs && rhs);
+	if (op == ARITH_BOR)
+		return (lhs | rhs);
+	if (op == ARITH_XOR)
+		return (lhs ^ rhs);
+	if (op == ARITH_BAND)
+		return (lhs & rhs);
+	if (op == ARITH_EQ)
+		return (lhs == rhs);
+	if (op == ARITH_NE)
+		return (lhs != rhs);
+	if (op == ARITH_LT)
+		return (lhs < rhs);
+	if (op == ARITH_LE)
+		return (lhs <= rhs);
+	if (op == ARITH_GT)
+		return (lhs > rhs);
+	return (lhs >= rhs);
+}
+
+/**
+ * @brief Division and remainder, with the overflowing cases defined.
+ *
+ * Dividing by zero is an error, unless the operand is not evaluated
+ * (right side of a short-circuited `&&`/`||`). LLONG_MIN / -1 wraps.
+ *
+ * @param a Arithmetic evaluator state
+ * @param op ARITH_DIV or ARITH_MOD
+ * @param lhs Dividend
+ * @param rhs Divisor
+ * @return Quotient or remainder (0 after an error)
+ */
+static long long	arith_divide(t_arith *a, t_arith_op op, long long lhs,
+	long long rhs)
+{
+	if (rhs == 0)
+	{
+		if (!a->noeval)
+			arith_fail(a, ERR_ARITH_DIV);
+		return (0);
+	}
+	if (rhs == -1 && op == ARITH_DIV)
+		return ((long long)(0ULL - (unsigned long long)lhs));
+	if (rhs == -1)
+		return (0);
+	if (op == ARITH_DIV)
+		return (lhs / rhs);
+	return (lhs % rhs);
+}
+
+/**
+ * @brief Shifts; the count is taken modulo 64 like on x86.
+ *
+ * @param op ARITH_SHL or ARITH_SHR
+ * @param lhs Value to shift
+ * @param rhs Shift count
+ * @return Shifted value
+ */
+static long long	arith_shift(t_arith_op op, long long lhs, long long rhs)
+{
+	rhs &= 63;
+	if (op == ARITH_SHL)
+		return ((long long)((unsigned long long)lhs << rhs));
+	return (lhs >> rhs);
+}
+
+/**
+ * @brief Exponentiation by squaring, wrapping on overflow.
+ *
+ * @param a Arithmetic evaluator state
+ * @param base Base
+ * @param exp Exponent (must not be negative)
+ * @return base ** exp (0 after an error)
+ */
+static long long	arith_power(t_arith *a, long long base, long long exp)
+{
+	unsigned long long	result;
+	unsigned long long	factor;
+
+	if (exp < 0)
+	{
+		if (!a->noeval)
+			arith_fail(a, ERR_ARITH_SYNTAX);
+		return (0);
+	}
+	result = 1;
+	factor = (unsigned long long)base;
+	while (exp > 0)
+	{
+		if (exp & 1)
+			result *= factor;
+		factor *= factor;
+		exp >>= 1;
+	}
+	return ((long long)result);
+}
+
+/**
+ * @brief Apply a binary operator to two 64-bit operands.
+ *
+ * Additive and multiplicative operators wrap around on overflow, like
+ * bash, instead of relying on undefined signed overflow.
+ *
+ * @param a Arithmetic evaluator state
+ * @param op Operator (ARITH_NONE returns rhs, for a plain `=`)
+ * @param lhs Left operand
+ * @param rhs Right operand
+ * @return Result of the operation
+ */
+long long	arith_apply(t_arith *a, t_arith_op op, long long lhs, long long rhs)
+{
+	if (op >= ARITH_OR && op <= ARITH_GE)
+		return (arith_logic(op, lhs, rhs));
+	if (op == ARITH_SHL || op == ARITH_SHR)
+		return (arith_shift(op, lhs, rhs));
+	if (op == ARITH_DIV || op == ARITH_MOD)
+		return (arith_divide(a, op, lhs, rhs));
+	if (op == ARITH_POW)
+		return (arith_power(a, lhs, rhs));
+	if (op == ARITH_ADD)
+		return ((long long)((unsigned long long)lhs + rhs));
+	if (op == ARITH_SUB)
+		return ((long long)((unsigned long long)lhs - rhs));
+	if (op == ARITH_MUL)
+		return ((long long)((unsigned long long)lhs * rhs));
+	return (rhs);
+}
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_unary.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:08:19 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:08:19 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Parse a variable operand, with an optional postfix `++`/`--`.
+ *
+ * @param a Arithmetic evaluator state, positioned on the name
+ * @param len Length of the name
+ * @return Value of the variable (before a postfix increment)
+ */
+static long long	parse_variable(t_arith *a, size_t len)
+{
+	const char	*name;
+	long long	value;
+	char		c;
+
+	name = a->expr + a->pos;
+	a->pos += len;
+	value = arith_get_var(a, name, len);
+	arith_skip_spaces(a);
+	c = a->expr[a->pos];
+	if ((c == '+' || c == '-') && a->expr[a->pos + 1] == c)
+	{
+		a->pos += 2;
+		arith_set_var(a, name, len, arith_apply(a, ARITH_ADD, value,
+				(c == '+') - (c == '-')));
+	}
+	return (value);
+}
+
+/**
+ * @brief Parse an operand: a number, a variable or a parenthesized
+ * expression.
+ *
+ * @param a Arithmetic evaluator state
+ * @return Value of the operand (0 after an error)
+ */
+static long long	parse_primary(t_arith *a)
+{
+	long long	value;
+	size_t		len;
+
+	arith_skip_spaces(a);
+	if (a->expr[a->pos] == '(')
+	{
+		a->pos++;
+		value = arith_comma(a);
+		arith_skip_spaces(a);
+		if (a->expr[a->pos] != ')')
+			return (arith_fail(a, ERR_ARITH_SYNTAX), 0);
+		a->pos++;
+		return (value);
+	}
+	if (ft_isdigit(a->expr[a->pos]))
+		return (arith_read_number(a));
+	len = arith_name_length(a->expr + a->pos);
+	if (len > 0)
+		return (parse_variable(a, len));
+	return (arith_fail(a, ERR_ARITH_SYNTAX), 0);
+}
+
+/**
+ * @brief Parse a prefix increment or decrement: `++name` / `--name`.
+ *
+ * @param a Arithmetic evaluator state, positioned on the operator
+ * @param c '+' or '-'
+ * @param value Receives the new value of the variable
+ * @return true if the operator applied to a variable, false otherwise
+ */
+static bool	parse_prefix(t_arith *a, char c, long long *value)
+{
+	const char	*name;
+	size_t		i;
+	size_t		len;
+
+	i = a->pos + 2;
+	while (is_whitespace(a->expr[i]))
+		i++;
+	len = arith_name_length(a->expr + i);
+	if (len == 0)
+		return (false);
+	name = a->expr + i;
+	a->pos = i + len;
+	*value = arith_apply(a, ARITH_ADD, arith_get_var(a, name, len),
+			(c == '+') - (c == '-'));
+	*value = arith_set_var(a, name, len, *value);
+	return (true);
+}
+
+/**
+ * @brief Apply a unary sign or negation operator.
+ *
+ * @param c One of '+', '-', '!', '~'
+ * @param value Operand
+ * @return Result of the operator
+ */
+static long long	apply_unary(char c, long long value)
+{
+	if (c == '-')
+		return ((long long)(0ULL - (unsigned long long)value));
+	if (c == '!')
+		return (!value);
+	if (c == '~')
+		return (~value);
+	return (value);
+}
+
+/**
+ * @brief Parse a unary expression: `+x`, `-x`, `!x`, `~x`, `++x`, `--x`.
+ *
+ * `++`/`--` only increment when followed by a variable; otherwise they
+ * are two signs, so `--5` is 5.
+ *
+ * @param a Arithmetic evaluator state
+ * @return Value of the expression
+ */
+long long	arith_unary(t_arith *a)
+{
+	char		c;
+	long long	value;
+
+	arith_skip_spaces(a);
+	c = a->expr[a->pos];
+	if ((c == '+' || c == '-') && a->expr[a->pos + 1] == c
+		&& parse_prefix(a, c, &value))
+		return (value);
+	if (c != '+' && c != '-' && c != '!' && c != '~')
+		return (parse_primary(a));
+	a->pos++;
+	return (apply_unary(c, arith_unary(a)));
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_vars.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:08:19 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 05:03:45 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Find a variable from a name that is not NUL-terminated.
+ *
+ * The name points into the expression text, so reading a variable does
+ * not need to copy it first.
+ *
+ * @param env_list Environment list
+ * @param name Start of the variable name
+ * @param len Length of the name
+ * @return The variable, or NULL if it is not set
+ */
+static t_env	*find_var(t_list *env_list, const char *name, size_t len)
+{
+	return (env_slot_var(env_find_slot(&env_list, name, len), name, len));
+}
+
+/**
+ * @brief Check if a value is empty or only made of blanks.
+ *
+ * @param s Variable value
+ * @return true if the value counts as 0 in arithmetic
+ */
+static bool	is_blank(const char *s)
+{
+	while (*s && is_whitespace(*s))
+		s++;
+	return (*s == '\0');
+}
+
+/**
+ * @brief Check if a number has a leading zero, i.e. is an octal constant.
+ *
+ * ft_safe_atoll() reads such values as decimal, so they must go through
+ * the expression evaluator instead (`010` is 8, `08` is an error).
+ *
+ * @param s Variable value
+ * @return true if the first digit is a 0 followed by more characters
+ */
+static bool	has_leading_zero(const char *s)
+{
+	while (*s && is_whitespace(*s))
+		s++;
+	if (*s == '-' || *s == '+')
+		s++;
+	return (s[0] == '0' && ft_isalnum(s[1]));
+}
+
+/**
+ * @brief Get the integer value of a variable used in an expression.
+ *
+ * The value parsed by ft_safe_atoll() is cached in the t_env node, so a
+ * counter read on every loop iteration is only parsed after it changed.
+ * Unset or empty variables are 0. Any other value, octal and hex
+ * constants included, is evaluated as an expression itself, like bash
+ * does (`x=y+1`).
+ *
+ * @param a Arithmetic evaluator state
+ * @param name Variable name, inside the expression text
+ * @param len Length of the name
+ * @return The value of the variable, 0 when its expression failed
+ */
+long long	arith_get_var(t_arith *a, const char *name, size_t len)
+{
+	t_env		*env;
+	long long	value;
+
+	value = 0;
+	env = find_var(a->data->env_list, name, len);
+	if (!env || !env->value)
+		return (0);
+	if (env->num_valid)
+		return (env->num);
+	if (!has_leading_zero(env->value)
+		&& ft_safe_atoll(env->value, &value) == 1)
+	{
+		env->num = value;
+		env->num_valid = true;
+		return (value);
+	}
+	if (is_blank(env->value))
+		return (0);
+	if (a->depth >= ARITH_MAX_DEPTH)
+		return (arith_fail(a, ERR_ARITH_DEPTH), 0);
+	if (arith_evaluate(env->value, a->data, a->depth + 1, &value) == 0)
+		return (value);
+	a->error = true;
+	return (0);
+}
+
+/**
+ * @brief Assign an integer to a variable from an expression.
+ *
+ * Skipped when the assignment is not evaluated (`0 && (x = 1)`).
+ *
+ * @param a Arithmetic evaluator state
+ * @param name Variable name, inside the expression text
+ * @param len Length of the name
+ * @param value New value
+ * @return The assigned value
+ */
+long long	arith_set_var(t_arith *a, const char *name, size_t len,
+	long long value)
+{
+	char	*key;
+
+	if (a->noeval || a->error)
+		return (value);
+	key = ft_substr(name, 0, len);
+	if (!key || set_env_number(&a->data->env_list, key, value) == -1)
+		a->error = true;
+	free(key);
+	return (value);
+}
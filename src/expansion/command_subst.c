@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_subst.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:16:03 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:55:17 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if a word holds a `${name=word}` or `${name:=word}`.
+ *
+ * @param w Word of the substituted command
+ * @return true if expanding the word may assign a variable
+ */
+static bool	assigns_param(const char *w)
+{
+	const char	*s;
+
+	s = ft_strnstr(w, "${", ft_strlen(w));
+	while (s)
+	{
+		s += 2;
+		while (ft_isalnum(*s) || *s == '_')
+			s++;
+		if (*s == '=' || (*s == ':' && s[1] == '='))
+			return (true);
+		s = ft_strnstr(s, "${", ft_strlen(s));
+	}
+	return (false);
+}
+
+/**
+ * @brief Check if a substituted command can run in the shell process.
+ *
+ * Only a builtin that prints through the output buffer and cannot change
+ * the shell state qualifies, alone and without redirections. Words
+ * containing arithmetic or a `${name=word}` are left to a child, since
+ * an assignment there must not outlive the substitution.
+ *
+ * @param ast Parsed substituted command
+ * @param data Shell state structure
+ * @return true if the command can be captured without forking
+ */
+static bool	runs_in_shell(t_ast *ast, t_shell *data)
+{
+	static const char	*pure[] = {"echo", "pwd", "printf", NULL};
+	size_t				i;
+
+	if (ast->type != NODE_CMD || ast->right || !ast->words
+		|| !ast->words[0] || find_function(data, ast->words[0]))
+		return (false);
+	i = 0;
+	while (ast->words[i])
+	{
+		if (ft_strnstr(ast->words[i], "$((", ft_strlen(ast->words[i]))
+			|| assigns_param(ast->words[i]))
+			return (false);
+		i++;
+	}
+	i = 0;
+	while (pure[i] && ft_strcmp(ast->words[0], pure[i]) != 0)
+		i++;
+	return (pure[i] != NULL);
+}
+
+/**
+ * @brief Run a builtin with stdout pointing to the expansion output.
+ *
+ * The stdout buffer appends to the expansion output instead of writing
+ * to fd 1 while the builtin runs: no fork, no pipe and no intermediate
+ * copy. A `${name?word}` error fails the builtin only, as it would in a
+ * child, and leaves the rest of the line to run.
+ *
+ * @param buf Expansion output
+ * @param ast NODE_CMD of the builtin
+ * @param data Shell state structure
+ * @return 0 on success, -1 on error
+ */
+static int	capture_builtin(t_strbuf *buf, t_ast *ast, t_shell *data)
+{
+	t_strbuf	*saved;
+	bool		saved_can_exec;
+
+	if (expand_cmd_node(ast, data) != EXIT_SUCCESS && !data->aborting)
+		return (-1);
+	if (data->aborting)
+	{
+		data->aborting = false;
+		data->status = EXIT_FAILURE;
+		return (0);
+	}
+	saved = out_capture(buf);
+	saved_can_exec = data->can_exec;
+	data->can_exec = false;
+	data->status = execute_builtin(ast, data);
+	data->can_exec = saved_can_exec;
+	out_capture(saved);
+	return (0);
+}
+
+/**
+ * @brief Parse the command of `$( ... )` and read its heredocs.
+ *
+ * @param s Word at the '$'
+ * @param span Length of the substitution, closing ')' included
+ * @param data Shell state structure
+ * @param ast Receives the AST (NULL for an empty command)
+ * @return 0 on success, -1 on error (status set)
+ */
+static int	parse_substitution(const char *s, size_t span, t_shell *data,
+	t_ast **ast)
+{
+	char	*cmd;
+	int		ret;
+
+	*ast = NULL;
+	if (s[span - 1] != ')')
+	{
+		print_error(ERR_PREFIX, ERR_SYNTAX_EOF, NULL, NULL);
+		data->status = MISUSAGE_ERROR;
+		return (-1);
+	}
+	cmd = ft_substr(s, 2, span - 3);
+	if (!cmd)
+		return (-1);
+	ret = parse_string(cmd, data, ast);
+	free(cmd);
+	if (ret == EXIT_SUCCESS && *ast)
+		ret = preprocess_heredocs(*ast, data);
+	if (ret == EXIT_SUCCESS)
+		return (0);
+	data->status = ret;
+	free_ast(*ast);
+	*ast = NULL;
+	return (-1);
+}
+
+/**
+ * @brief Expand `$( ... )`: append the output of the command.
+ *
+ * Builtins such as `echo`, `pwd` and `printf` run in the shell process;
+ * anything else runs in a child whose output is read from a pipe. Either
+ * way the output lands directly in the expansion buffer, and the trailing
+ * newlines are trimmed there by shortening it.
+ *
+ * @param buf Expansion output
+ * @param s Word at the '$'
+ * @param span Length of the substitution, closing ')' included
+ * @param data Shell state structure
+ * @return 0 on success, -1 on error
+ */
+int	command_substitution(t_strbuf *buf, const char *s, size_t span,
+	t_shell *data)
+{
+	t_ast	*ast;
+	size_t	start;
+	int		ret;
+
+	if (parse_substitution(s, span, data, &ast) == -1)
+		return (-1);
+	if (!ast)
+		return (0);
+	start = buf->len;
+	if (runs_in_shell(ast, data))
+		ret = capture_builtin(buf, ast, data);
+	else
+		ret = capture_child(buf, ast, data);
+	free_ast(ast);
+	while (buf->len > start && buf->data[buf->len - 1] == '\n')
+		buf->len--;
+	return (ret);
+}
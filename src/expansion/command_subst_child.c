@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_subst_child.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:16:03 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:17:02 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Read everything from fd straight into the buffer.
+ *
+ * Each read() gets at least SUBST_READ_SIZE bytes of free space, so a
+ * large output is drained in few system calls and never copied again.
+ *
+ * @param buf Expansion output
+ * @param fd Read end of the pipe
+ * @return 0 at end of file, -1 on error
+ */
+static int	read_output(t_strbuf *buf, int fd)
+{
+	ssize_t	n;
+
+	while (1)
+	{
+		if (strbuf_reserve(buf, SUBST_READ_SIZE) == -1)
+			return (-1);
+		n = read(fd, buf->data + buf->len, buf->cap - buf->len - 1);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n == 0)
+			return (0);
+		if (n == -1)
+			return (out_perror("read"), -1);
+		buf->len += n;
+	}
+}
+
+/**
+ * @brief Child side of a command substitution: run the command with its
+ * stdout on the pipe.
+ *
+ * A lone simple command may replace the child (no second fork).
+ *
+ * @param ast Parsed substituted command
+ * @param data Shell state structure
+ * @param pipefd The pipe; pipefd[1] becomes stdout
+ */
+static void	run_substitution_child(t_ast *ast, t_shell *data, int pipefd[2])
+{
+	setup_signals_child();
+	data->is_child = true;
+	close_fds(&pipefd[0]);
+	if (dup2(pipefd[1], STDOUT_FILENO) == -1)
+	{
+		out_perror("dup2");
+		exit(EXIT_FAILURE);
+	}
+	close_fds(&pipefd[1]);
+	data->can_exec = (ast->type == NODE_CMD);
+	execute_ast_tree(ast, data);
+	exit(data->status);
+}
+
+/**
+ * @brief Run a substituted command in a child and capture its output.
+ *
+ * @param buf Expansion output
+ * @param ast Parsed substituted command
+ * @param data Shell state structure (status updated from the child)
+ * @return 0 on success, -1 on error
+ */
+int	capture_child(t_strbuf *buf, t_ast *ast, t_shell *data)
+{
+	int		pipefd[2];
+	pid_t	pid;
+	int		status;
+	int		ret;
+
+	if (fd_pipe(pipefd) == -1)
+		return (out_perror("pipe"), -1);
+	fflush(stdout);
+	pid = fork();
+	if (pid == -1)
+	{
+		out_perror("fork");
+		close_pipe_fds(pipefd);
+		return (-1);
+	}
+	if (pid == 0)
+		run_substitution_child(ast, data, pipefd);
+	close_fds(&pipefd[1]);
+	setup_signals_ignore();
+	ret = read_output(buf, pipefd[0]);
+	close_fds(&pipefd[0]);
+	waitpid(pid, &status, 0);
+	setup_signals_interactive();
+	handle_pipeline_status(status, data);
+	return (ret);
+}
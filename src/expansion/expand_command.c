@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expand_command.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:25:43 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Expand one raw word into zero or more arguments.
+ *
+ * @param argv Argument vector receiving the results
+ * @param word Raw word
+ * @param data Shell context containing environment variables
+ * @return 0 on success, -1 on error
+ */
+static int	expand_one_word(t_strvec *argv, const char *word, t_shell *data)
+{
+	if (is_params_word(word))
+		return (append_params(argv, data));
+	if (is_glob_word(word))
+		return (expand_glob(argv, word, data));
+	return (strvec_push(argv, expand_word(word, data)));
+}
+
+/**
+ * @brief Expand every word of a raw word list.
+ *
+ * A `"$@"` word gives one argument per positional parameter, possibly
+ * none; a word with unquoted wildcards gives the matching paths; any
+ * other word gives exactly one argument.
+ *
+ * @param words NULL-terminated array of raw words
+ * @param data Shell context containing environment variables
+ * @return Newly allocated NULL-terminated array, or NULL on error
+ */
+char	**expand_argv(char **words, t_shell *data)
+{
+	t_strvec	argv;
+	size_t		i;
+
+	strvec_init(&argv);
+	i = 0;
+	while (words[i])
+	{
+		if (expand_one_word(&argv, words[i], data) == -1)
+			return (strvec_clear(&argv), NULL);
+		i++;
+	}
+	return (strvec_finish(&argv));
+}
+
+/**
+ * @brief Rebuild argv and the command name of a command node.
+ *
+ * The raw `words` stay untouched; the previous expansion (from an earlier
+ * loop iteration) is replaced. A command made of an empty `"$@"` has no
+ * name: only its redirections are performed.
+ *
+ * @param node NODE_CMD node to prepare for execution
+ * @param data Shell context containing environment variables
+ * @return EXIT_SUCCESS, or EXIT_FAILURE on malloc failure
+ */
+int	expand_cmd_node(t_ast *node, t_shell *data)
+{
+	char	**argv;
+	char	*value;
+
+	if (!node->words)
+		return (EXIT_SUCCESS);
+	argv = expand_argv(node->words, data);
+	if (!argv)
+		return (EXIT_FAILURE);
+	value = NULL;
+	if (argv[0])
+		value = ft_strdup(argv[0]);
+	if (argv[0] && !value)
+		return (free_strings_array(argv), EXIT_FAILURE);
+	if (node->argv)
+		free_strings_array(node->argv);
+	free(node->value);
+	node->argv = argv;
+	node->value = value;
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expand_word.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:15:22 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:56:42 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Copy a run of ordinary characters to the expansion output.
+ *
+ * The run stops at the next quote that changes the quote state and, out
+ * of single quotes, at the next '$'. For a glob pattern, quoted wildcard
+ * characters are escaped so that they only match themselves.
+ *
+ * @param buf Expansion output
+ * @param word Cursor in the word, advanced past the run
+ * @param quote_state Current quote state
+ * @param pattern true when building a glob pattern
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	append_run(t_strbuf *buf, const char **word, t_quote quote_state,
+	bool pattern)
+{
+	const char	*s;
+	size_t		start;
+	size_t		i;
+
+	s = *word;
+	i = 1 + plain_run_length(s + 1, quote_state, false);
+	*word += i;
+	start = buf->len;
+	if (strbuf_append(buf, s, i) == -1)
+		return (-1);
+	if (pattern && quote_state != STATE_NOT_IN_QUOTE)
+		return (strbuf_escape(buf, start, GLOB_SPECIAL));
+	return (0);
+}
+
+/**
+ * @brief Expand the `$` construct at the cursor: arithmetic, command
+ * substitution, `${...}` or parameter.
+ *
+ * In a glob pattern, a quoted expansion is escaped so that it only
+ * matches itself; an unquoted one keeps its wildcards, as in bash.
+ *
+ * @param buf Expansion output
+ * @param word Cursor at the '$', advanced past the construct
+ * @param data Shell state structure
+ * @param escape true to escape the wildcards of the result
+ * @return 0 on success, -1 on error
+ */
+static int	append_dollar(t_strbuf *buf, const char **word, t_shell *data,
+	bool escape)
+{
+	size_t	start;
+	size_t	len;
+	int		ret;
+
+	start = buf->len;
+	len = arith_span(*word);
+	if (len > 0)
+		ret = append_arith(buf, *word, len, data);
+	else if ((*word)[1] == '(')
+	{
+		len = 1 + paren_group_length(*word + 1);
+		ret = command_substitution(buf, *word, len, data);
+	}
+	else if ((*word)[1] == '{')
+	{
+		len = 1 + brace_group_length(*word + 1);
+		ret = append_param(buf, *word, len, data);
+	}
+	else
+		ret = append_variable(buf, *word, &len, data);
+	*word += len;
+	if (ret == 0 && escape)
+		ret = strbuf_escape(buf, start, GLOB_SPECIAL);
+	return (ret);
+}
+
+/**
+ * @brief Expand a raw word in one pass, into a plain word or a pattern.
+ *
+ * @param word Raw word as written on the command line
+ * @param data Shell state structure
+ * @param pattern true to escape quoted wildcards
+ * @return Newly allocated result, or NULL on error
+ */
+static char	*expand_into(const char *word, t_shell *data, bool pattern)
+{
+	t_strbuf	buf;
+	t_quote		quote_state;
+	t_quote		new_state;
+	int			ret;
+
+	strbuf_init(&buf);
+	quote_state = STATE_NOT_IN_QUOTE;
+	ret = 0;
+	while (*word && ret == 0)
+	{
+		new_state = update_quote_state(quote_state, *word);
+		if (new_state != quote_state)
+		{
+			quote_state = new_state;
+			word++;
+		}
+		else if (*word == '$' && quote_state != STATE_IN_SINGLE_QUOTE)
+			ret = append_dollar(&buf, &word, data,
+					pattern && quote_state != STATE_NOT_IN_QUOTE);
+		else
+			ret = append_run(&buf, &word, quote_state, pattern);
+	}
+	if (ret == -1)
+		return (free(buf.data), NULL);
+	return (strbuf_finish(&buf));
+}
+
+/**
+ * @brief Expand a single raw word: parameters, arithmetic, command
+ * substitution and quote removal, in one pass.
+ *
+ * Expanded text is appended to the output as is: quotes or '$' coming
+ * from a variable or a command output are not interpreted again. A word
+ * without '$' or quotes, the usual case, is only duplicated.
+ *
+ * @param word Raw word as written on the command line
+ * @param data Shell context containing environment variables
+ * @return Newly allocated expanded word, or NULL on error
+ */
+char	*expand_word(const char *word, t_shell *data)
+{
+	if (is_plain_word(word))
+		return (ft_strdup(word));
+	return (expand_into(word, data, false));
+}
+
+/**
+ * @brief Expand a raw word into a glob pattern.
+ *
+ * Same as expand_word(), except that quoted wildcards, including those
+ * of a quoted expansion, are backslash-escaped, and so are backslashes
+ * there. A word without '$' or quotes is already its own pattern.
+ *
+ * @param word Raw word containing unquoted wildcards
+ * @param data Shell state structure
+ * @return Newly allocated pattern, or NULL on error
+ */
+char	*expand_pattern(const char *word, t_shell *data)
+{
+	if (is_plain_word(word))
+		return (ft_strdup(word));
+	return (expand_into(word, data, true));
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:01:59 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:02:00 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:56:42 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,7 +22,7 @@
  */
 static bool	is_valid_var_start(char c)
 {
-	return (ft_isalpha(c) || c == '_');
+	return ((g_char_class[(unsigned char)c] & CC_VAR_START) != 0);
 }
 
 /**
@@ -37,33 +37,31 @@ static size_t	calculate_var_name_length(const char *str, size_t start_pos)
 	size_t	i;
 
 	i = start_pos;
-	while (str[i])
-	{
-		if (!ft_isalpha(str[i]) && !ft_isdigit(str[i]) && str[i] != '_')
-			break ;
+	while (g_char_class[(unsigned char)str[i]] & CC_VAR_CHAR)
 		i++;
-	}
 	return (i - start_pos);
 }
 
 /**
  * @brief Extract variable name from a string starting at a given position.
  *
- * Extracts the variable name after a '$' character. A valid variable name
+ * Extracts the variable name after a '$' character, or after the '{' or
+ * '#' of a parameter expansion (`${name}`, `${#name}`). A valid variable name
  * must start with a letter (a-z, A-Z) or underscore (_), and can continue
  * with letters, digits, or underscores.
  *
  * Special cases:
  * - $?  → returns "?" (exit status)
+ * - $#, $@ → return "#", "@" (positional parameter count and list)
  * - $$  → returns "$" (PID, if we want to do bonuses)
  * We need to add this conditions if we want to handle $$ later :
  * 		if (str[start_pos + 1] == '$')
  * 			return (ft_strdup("$"));
- * - $123 → returns NULL (starts with digit, invalid)
+ * - $123 → returns "1" (positional parameters have a single digit)
  * - $   → returns NULL (dollar alone, no variable)
  *
  * @param str The string containing the variable
- * @param start_pos Position of the '$' character
+ * @param start_pos Position of the '$' (or '{', '#') before the name
  * @return Allocated string with variable name (without $), or NULL if invalid
  *
  * Examples:
@@ -71,27 +69,18 @@ static size_t	calculate_var_name_length(const char *str, size_t start_pos)
  *   extract_var_name("$USER world", 0)  → "USER"
  *   extract_var_name("$_VAR", 0)        → "_VAR"
  *   extract_var_name("$?", 0)           → "?"
- *   extract_var_name("$123", 0)         → NULL
+ *   extract_var_name("$123", 0)         → "1"
  */
 char	*extract_var_name(const char *str, size_t start_pos)
 {
-	size_t	var_len;
-	char	*trimmed_name;
-
-	if (!str || str[start_pos] != '$')
-		return (NULL);
-	if (str[start_pos + 1] == '?')
-		return (ft_strdup("?"));
-	if (ft_isdigit(str[start_pos + 1]))
+	if (!str || !str[start_pos] || !ft_strchr(PARAM_INTRO, str[start_pos]))
 		return (NULL);
+	if (str[start_pos + 1] && ft_strchr(SPECIAL_PARAMS, str[start_pos + 1]))
+		return (ft_strndup(str + start_pos + 1, 1));
 	if (!str[start_pos + 1] || !is_valid_var_start(str[start_pos + 1]))
 		return (NULL);
-	var_len = calculate_var_name_length(str, start_pos + 1);
-	trimmed_name = malloc(var_len + 1);
-	if (!trimmed_name)
-		return (NULL);
-	ft_strlcpy(trimmed_name, str + start_pos + 1, var_len + 1);
-	return (trimmed_name);
+	return (ft_strndup(str + start_pos + 1,
+			calculate_var_name_length(str, start_pos + 1)));
 }
 
 /**
@@ -104,6 +93,7 @@ char	*extract_var_name(const char *str, size_t start_pos)
  *
  * Special cases:
  * - Variable name "?" returns the shell's last exit status as a string
+ * - Names "0" to "9", "#" and "@" are positional parameters
  * - Undefined variables return an empty string (bash-compatible behavior)
  * - Variables with empty values return an empty string
  *
@@ -131,8 +121,52 @@ char	*get_var_value(const char *var_name, t_shell *data)
 		return (ft_strdup(""));
 	if (ft_strcmp(var_name, "?") == 0)
 		return (ft_itoa(data->status));
+	if (!var_name[1] && ft_strchr(SPECIAL_PARAMS, var_name[0]))
+		return (get_param_value(var_name, data));
 	env_node = get_env_node_by_key(data->env_list, var_name);
 	if (env_node && env_node->value)
 		return (ft_strdup(env_node->value));
 	return (ft_strdup(""));
 }
+
+/**
+ * @brief Append the value of the variable or parameter `$name` at s[0].
+ *
+ * Exported variables are copied straight from the environment list,
+ * without an intermediate copy of their value.
+ *
+ * @param buf Expansion output
+ * @param s Word at the '$'
+ * @param len Receives the length of `$name`
+ * @param data Shell state structure
+ * @return 0 on success, -1 on allocation failure
+ */
+int	append_variable(t_strbuf *buf, const char *s, size_t *len,
+	t_shell *data)
+{
+	char	*name;
+	char	*value;
+	t_env	*env;
+	int		ret;
+
+	name = extract_var_name(s, 0);
+	*len = 1;
+	if (!name)
+		return (strbuf_append(buf, "$", 1));
+	*len += ft_strlen(name);
+	if (!ft_strchr(SPECIAL_PARAMS, name[0]))
+	{
+		env = get_env_node_by_key(data->env_list, name);
+		free(name);
+		if (!env || !env->value)
+			return (0);
+		return (strbuf_append(buf, env->value, ft_strlen(env->value)));
+	}
+	value = get_var_value(name, data);
+	free(name);
+	if (!value)
+		return (-1);
+	ret = strbuf_append(buf, value, ft_strlen(value));
+	free(value);
+	return (ret);
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expansion_params.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:01:54 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:25:43 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Count the positional parameters of the current function call.
+ *
+ * @param data Shell state structure
+ * @return Number of parameters ($#), 0 outside of a function call
+ */
+size_t	count_params(t_shell *data)
+{
+	size_t	count;
+
+	count = 0;
+	while (data->pos_params && data->pos_params[count])
+		count++;
+	return (count);
+}
+
+/**
+ * @brief Join the positional parameters with single spaces ($@ in a word).
+ *
+ * @param data Shell state structure
+ * @return Newly allocated string, or NULL on malloc failure
+ */
+static char	*join_params(t_shell *data)
+{
+	char	*result;
+	size_t	len;
+	size_t	word_len;
+	size_t	i;
+
+	len = 0;
+	i = 0;
+	while (data->pos_params && data->pos_params[i])
+		len += ft_strlen(data->pos_params[i++]) + 1;
+	result = ft_calloc(len + 1, sizeof(char));
+	if (!result)
+		return (NULL);
+	len = 0;
+	i = 0;
+	while (data->pos_params && data->pos_params[i])
+	{
+		if (i > 0)
+			result[len++] = ' ';
+		word_len = ft_strlen(data->pos_params[i]);
+		ft_memcpy(result + len, data->pos_params[i++], word_len);
+		len += word_len;
+	}
+	return (result);
+}
+
+/**
+ * @brief Get the value of a special parameter: $0 to $9, $# or $@.
+ *
+ * @param name One-character parameter name
+ * @param data Shell state structure
+ * @return Newly allocated value ("" for an unset parameter), or NULL on
+ *         malloc failure
+ */
+char	*get_param_value(const char *name, t_shell *data)
+{
+	size_t	index;
+
+	if (name[0] == '#')
+		return (ft_itoa(count_params(data)));
+	if (name[0] == '@')
+		return (join_params(data));
+	if (name[0] == '0')
+		return (ft_strdup(SHELL_NAME));
+	index = name[0] - '0';
+	if (index > count_params(data))
+		return (ft_strdup(""));
+	return (ft_strdup(data->pos_params[index - 1]));
+}
+
+/**
+ * @brief Check if a word is exactly `$@` or `"$@"`.
+ *
+ * Such a word expands to one argument per positional parameter instead
+ * of a single joined string, so `for arg in "$@"` sees each argument.
+ *
+ * @param word Raw word
+ * @return true if the word expands to the parameter list
+ */
+bool	is_params_word(const char *word)
+{
+	return (ft_strcmp(word, "$@") == 0 || ft_strcmp(word, "\"$@\"") == 0);
+}
+
+/**
+ * @brief Append a copy of every positional parameter to an argv.
+ *
+ * @param argv Argument vector receiving the copies
+ * @param data Shell state structure
+ * @return 0 on success, -1 on malloc failure
+ */
+int	append_params(t_strvec *argv, t_shell *data)
+{
+	size_t	i;
+
+	i = 0;
+	while (data->pos_params && data->pos_params[i])
+	{
+		if (strvec_push(argv, ft_strdup(data->pos_params[i++])) == -1)
+			return (-1);
+	}
+	return (0);
+}
@@ -6,131 +6,26 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:02:17 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:02:18 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:56:42 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
 /**
- * @brief Check if a variable at a given position should be expanded.
+ * @brief Check if a raw word expands to itself.
  *
- * Variables are expanded everywhere except inside single quotes.
- * This function tracks the quote state from the beginning of the string
- * up to the target position to determine the context. It reuses the quote
- * state tracking logic from the tokenizer module for consistency.
+ * Most words hold neither a '$' nor a quote: expanding them would only
+ * copy them, so callers duplicate them directly instead of running the
+ * expansion scan.
  *
- * @param str The string to analyze
- * @param pos Position to check (should be a '$' character)
- * @return true if expansion should occur at this position, false otherwise
- *
- * Examples:
- *   should_expand_at_position("$USER", 0)     // returns true
- *   should_expand_at_position("'$USER'", 1)   // returns false (single quotes)
- *   should_expand_at_position("\"$USER\"", 1) // returns true (double quotes)
- */
-bool	should_expand_at_position(const char *str, size_t pos)
-{
-	size_t		i;
-	t_quote		current_quote_state;
-
-	if (!str || str[pos] != '$')
-		return (false);
-	i = 0;
-	current_quote_state = STATE_NOT_IN_QUOTE;
-	while (i <= pos)
-	{
-		current_quote_state = update_quote_state(current_quote_state, str[i]);
-		i++;
-	}
-	if (current_quote_state == STATE_NOT_IN_QUOTE
-		|| current_quote_state == STATE_IN_DOUBLE_QUOTE)
-		return (true);
-	else
-		return (false);
-}
-
-/**
- * @brief Calculate the size needed for a single variable expansion.
- *
- * Helper function that extracts a variable name, looks up its value,
- * calculates the size needed for replacement, and advances the position
- * pointer past the entire variable token ($ + name). If variable lookup
- * fails due to malloc error, returns 0 (empty variable).
- *
- * @param str The input string being analyzed
- * @param i Pointer to current position - will be advanced past the variable
- * @param data Shell data containing environment variables
- * @return Size in bytes needed for the variable's expanded value, or 0 if
- *         variable lookup fails or variable is empty
- *
- * @note The position pointer i is modified to skip past the entire variable
- * @note Memory allocated internally is freed before return
- * @note Returns 0 for undefined variables or malloc failures (bash behavior)
+ * @param word Raw word as written on the command line
+ * @return true if the word contains no '$', single or double quote
  */
-size_t	get_variable_size(const char *str, size_t *i, t_shell *data)
+bool	is_plain_word(const char *word)
 {
-	char	*var_name;
-	char	*value;
-	size_t	var_size;
-	size_t	name_len;
-
-	var_name = extract_var_name(str, *i);
-	if (!var_name)
-	{
-		(*i)++;
-		return (1);
-	}
-	value = get_var_value(var_name, data);
-	if (!value)
-	{
-		name_len = ft_strlen(var_name);
-		free(var_name);
-		*i += name_len + 1;
-		return (0);
-	}
-	var_size = ft_strlen(value);
-	name_len = ft_strlen(var_name);
-	*i += name_len + 1;
-	free(var_name);
-	free(value);
-	return (var_size);
-}
-
-/**
- * @brief Calculate total size needed for string after variable expansion.
- *
- * First pass of a two-pass expansion algorithm. Scans the input string
- * to determine the exact number of bytes needed for the final expanded
- * string, allowing for optimal single memory allocation.
- *
- * @param str Input string containing variables to expand
- * @param data Shell data structure containing environment variables
- * @return Total bytes needed for expanded string
- *
- * @note This enables single malloc instead of multiple reallocations
- * @note Variables in single quotes are not counted for expansion
- */
-size_t	calculate_expanded_size(const char *str, t_shell *data)
-{
-	size_t	total_size;
-	size_t	i;
-	size_t	var_size;
-
-	total_size = 0;
-	i = 0;
-	while (str[i])
-	{
-		if (str[i] == '$' && should_expand_at_position(str, i))
-		{
-			var_size = get_variable_size(str, &i, data);
-			total_size += var_size;
-		}
-		else
-		{
-			total_size++;
-			i++;
-		}
-	}
-	return (total_size);
+	while (!(g_char_class[(unsigned char)*word] & (CC_NUL | CC_QUOTE
+				| CC_DOLLAR)))
+		word++;
+	return (*word == '\0');
 }
@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:23:55 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:56:42 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if a raw word holds an unquoted wildcard.
+ *
+ * Only such words go through pathname expansion; the others are
+ * expanded by expand_word() alone. Wildcards inside `${...}` belong to
+ * its pattern operators (`${f%.*}`) and are skipped.
+ *
+ * @param word Raw word as written on the command line
+ * @return true if the word contains an unquoted '*', '?' or '['
+ */
+bool	is_glob_word(const char *word)
+{
+	t_quote	quote_state;
+
+	quote_state = STATE_NOT_IN_QUOTE;
+	while (*word)
+	{
+		quote_state = update_quote_state(quote_state, *word);
+		if (quote_state == STATE_NOT_IN_QUOTE
+			&& (g_char_class[(unsigned char)*word] & CC_GLOB))
+			return (true);
+		if (quote_state != STATE_IN_SINGLE_QUOTE && word[0] == '$'
+			&& word[1] == '{')
+			word += 1 + brace_group_length(word + 1);
+		else
+			word++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Remove the pattern escapes of a word left unexpanded, in place.
+ *
+ * @param pattern Pattern built by expand_pattern()
+ * @return The same string, unescaped
+ */
+static char	*unescape_pattern(char *pattern)
+{
+	size_t	i;
+	size_t	j;
+
+	i = 0;
+	j = 0;
+	while (pattern[i])
+	{
+		if (pattern[i] == '\\' && pattern[i + 1])
+			i++;
+		pattern[j++] = pattern[i++];
+	}
+	pattern[j] = '\0';
+	return (pattern);
+}
+
+/**
+ * @brief Split a pattern on '/' and compile each path component.
+ *
+ * An absolute pattern starts with an empty literal component.
+ *
+ * @param g Glob state receiving the components
+ * @param pattern Pattern built by expand_pattern()
+ * @return 1 if a component has wildcards, 0 if none has, -1 on
+ *         allocation failure
+ */
+static int	compile_components(t_glob *g, const char *pattern)
+{
+	const char	*slash;
+	size_t		len;
+	bool		magic;
+
+	g->ncomps = 1;
+	len = 0;
+	while (pattern[len])
+		g->ncomps += (pattern[len++] == '/');
+	g->comps = ft_calloc(g->ncomps, sizeof(t_pattern));
+	if (!g->comps)
+		return (-1);
+	magic = false;
+	len = 0;
+	while (len < g->ncomps)
+	{
+		slash = ft_strchr(pattern, '/');
+		if (!slash)
+			slash = pattern + ft_strlen(pattern);
+		if (pattern_compile(pattern, slash - pattern, &g->comps[len]) == -1)
+			return (-1);
+		magic |= g->comps[len++].magic;
+		pattern = slash + 1;
+	}
+	return (magic);
+}
+
+/**
+ * @brief Free the compiled components and the walk path of a glob.
+ *
+ * @param g Glob state (matches are left alone)
+ */
+static void	free_glob(t_glob *g)
+{
+	size_t	i;
+
+	i = 0;
+	while (g->comps && i < g->ncomps)
+		pattern_free(&g->comps[i++]);
+	free(g->comps);
+	free(g->path.data);
+}
+
+/**
+ * @brief Expand a raw word with wildcards into the matching paths.
+ *
+ * Matches are sorted in byte order, independently of the locale. When
+ * nothing matches, the word is kept (with quotes removed), as in bash
+ * without nullglob.
+ *
+ * @param argv Argument vector receiving the results
+ * @param word Raw word for which is_glob_word() is true
+ * @param data Shell state structure
+ * @return 0 on success, -1 on error
+ */
+int	expand_glob(t_strvec *argv, const char *word, t_shell *data)
+{
+	t_glob	g;
+	char	*pattern;
+	int		ret;
+
+	pattern = expand_pattern(word, data);
+	if (!pattern)
+		return (-1);
+	ft_bzero(&g, sizeof(t_glob));
+	g.data = data;
+	ret = compile_components(&g, pattern);
+	if (ret == 1 && strbuf_reserve(&g.path, 0) == 0)
+	{
+		g.path.data[0] = '\0';
+		ret = glob_walk(&g, 0);
+	}
+	free_glob(&g);
+	if (ret == 0 && g.matches.len > 0)
+		ret = sort_strings(g.matches.items, g.matches.len, ft_strcmp);
+	if (ret == 0 && g.matches.len > 0)
+		return (free(pattern), strvec_move_all(argv, &g.matches));
+	strvec_clear(&g.matches);
+	if (ret != 0)
+		return (free(pattern), -1);
+	return (strvec_push(argv, unescape_pattern(pattern)));
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:22:06 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:32:41 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if a cached listing still describes the directory.
+ *
+ * Besides the device, inode and mtime, the mtime must be older than the
+ * second the listing was read in: a change made within the same clock
+ * tick may not move the mtime, so such a listing is read again.
+ *
+ * @param dir Cached listing
+ * @param st Current status of the directory
+ * @return true if the listing can be used
+ */
+static bool	is_fresh(t_dirlist *dir, struct stat *st)
+{
+	return (dir->dev == st->st_dev && dir->ino == st->st_ino
+		&& dir->mtime.tv_sec == st->st_mtim.tv_sec
+		&& dir->mtime.tv_nsec == st->st_mtim.tv_nsec
+		&& dir->mtime.tv_sec < dir->listed_at);
+}
+
+/**
+ * @brief Find the cached listing of a path and check it is up to date.
+ *
+ * @param data Shell state structure
+ * @param path Directory path ("" for the current directory)
+ * @param st Filled with the current status of the directory
+ * @param dir Set to the fresh listing, or NULL if there is none
+ * @return 0 if the path is a directory, -1 otherwise
+ */
+static int	find_listing(t_shell *data, const char *path, struct stat *st,
+	t_dirlist **dir)
+{
+	size_t	hash;
+
+	*dir = NULL;
+	if (stat(path, st) == -1 || !S_ISDIR(st->st_mode))
+		return (-1);
+	if (data->dir_cache.size == 0)
+		return (0);
+	hash = dircache_hash(path);
+	*dir = data->dir_cache.buckets[hash & (data->dir_cache.size - 1)];
+	while (*dir && ((*dir)->hash != hash || ft_strcmp((*dir)->path, path)))
+		*dir = (*dir)->next;
+	if (*dir && !is_fresh(*dir, st))
+		*dir = NULL;
+	return (0);
+}
+
+/**
+ * @brief Get the sorted listing of a directory, reading it if needed.
+ *
+ * Listings are kept for the current input line, so a line such as
+ * `cp *.log *.gz dest/` reads the directory once. A listing is read
+ * again when the directory changed (see is_fresh()).
+ *
+ * @param data Shell state structure
+ * @param path Directory path ("" for the current directory)
+ * @return Listing, or NULL if the directory cannot be read
+ */
+t_dirlist	*dircache_get(t_shell *data, const char *path)
+{
+	struct stat	st;
+	t_dirlist	*dir;
+
+	if (!*path)
+		path = ".";
+	if (find_listing(data, path, &st, &dir) == -1)
+		return (NULL);
+	if (dir)
+		return (dir);
+	dir = dirlist_new(path, &st);
+	if (!dir)
+		return (NULL);
+	if (read_dir_entries(dir) == -1 || dircache_insert(data, dir) == -1)
+		return (del_dir_listing(dir), NULL);
+	return (dir);
+}
+
+/**
+ * @brief Check if the whole subtree of a directory is cached.
+ *
+ * @param data Shell state structure
+ * @param path Directory path ("" for the current directory)
+ * @return true if the recursive walker listed it and it did not change
+ */
+bool	dircache_has_tree(t_shell *data, const char *path)
+{
+	struct stat	st;
+	t_dirlist	*dir;
+
+	if (!*path)
+		path = ".";
+	if (find_listing(data, path, &st, &dir) == -1)
+		return (true);
+	return (dir && dir->tree);
+}
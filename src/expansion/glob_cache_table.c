@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_cache_table.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:28:36 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:28:36 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Hash a directory path (djb2).
+ *
+ * @param path Directory path
+ * @return Hash value, reduced to a bucket by the table size
+ */
+size_t	dircache_hash(const char *path)
+{
+	size_t	hash;
+
+	hash = 5381;
+	while (*path)
+		hash = hash * 33 + (unsigned char)*path++;
+	return (hash);
+}
+
+/**
+ * @brief Move a chain of listings into a new bucket array.
+ *
+ * @param dir First listing of the chain
+ * @param buckets New bucket array
+ * @param size Size of the new array (power of two)
+ */
+static void	rehash_chain(t_dirlist *dir, t_dirlist **buckets, size_t size)
+{
+	t_dirlist	*next;
+
+	while (dir)
+	{
+		next = dir->next;
+		dir->next = buckets[dir->hash & (size - 1)];
+		buckets[dir->hash & (size - 1)] = dir;
+		dir = next;
+	}
+}
+
+/**
+ * @brief Double the bucket array and rehash the listings.
+ *
+ * @param cache Directory cache
+ * @return 0 on success, -1 on allocation failure (cache unchanged)
+ */
+static int	dircache_grow(t_dircache *cache)
+{
+	t_dirlist	**buckets;
+	size_t		size;
+	size_t		i;
+
+	size = cache->size * 2;
+	if (size < DIR_CACHE_MIN_SIZE)
+		size = DIR_CACHE_MIN_SIZE;
+	buckets = ft_calloc(size, sizeof(t_dirlist *));
+	if (!buckets)
+		return (-1);
+	i = 0;
+	while (i < cache->size)
+		rehash_chain(cache->buckets[i++], buckets, size);
+	free(cache->buckets);
+	cache->buckets = buckets;
+	cache->size = size;
+	return (0);
+}
+
+/**
+ * @brief Add a listing to the cache, replacing the one of the same path.
+ *
+ * The table grows to keep about one listing per bucket.
+ *
+ * @param data Shell state structure
+ * @param dir Listing to add (owned by the cache on success)
+ * @return 0 on success, -1 on allocation failure
+ */
+int	dircache_insert(t_shell *data, t_dirlist *dir)
+{
+	t_dircache	*cache;
+	t_dirlist	**link;
+	t_dirlist	*old;
+
+	cache = &data->dir_cache;
+	if (cache->count >= cache->size && dircache_grow(cache) == -1)
+		return (-1);
+	dir->hash = dircache_hash(dir->path);
+	link = &cache->buckets[dir->hash & (cache->size - 1)];
+	while (*link && ((*link)->hash != dir->hash
+			|| ft_strcmp((*link)->path, dir->path)))
+		link = &(*link)->next;
+	old = *link;
+	if (old)
+	{
+		*link = old->next;
+		del_dir_listing(old);
+		cache->count--;
+	}
+	dir->next = cache->buckets[dir->hash & (cache->size - 1)];
+	cache->buckets[dir->hash & (cache->size - 1)] = dir;
+	cache->count++;
+	return (0);
+}
+
+/**
+ * @brief Free a cached listing.
+ *
+ * @param dir Listing to free (may be NULL)
+ */
+void	del_dir_listing(t_dirlist *dir)
+{
+	if (!dir)
+		return ;
+	strvec_clear(&dir->entries);
+	free(dir->path);
+	free(dir);
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_dents.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:30:34 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:30:34 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if a raw directory entry is a subdirectory to descend in.
+ *
+ * Hidden directories and symbolic links are not walked into, matching
+ * what `**` skips in the serial walk.
+ *
+ * @param fd Descriptor of the directory holding the entry
+ * @param ent Entry returned by getdents64()
+ * @return true if the walker should list the entry
+ */
+static bool	is_subdir(int fd, struct dirent64 *ent)
+{
+	struct stat	st;
+
+	if (ent->d_name[0] == '.')
+		return (false);
+	if (ent->d_type != DT_UNKNOWN)
+		return (ent->d_type == DT_DIR);
+	return (fstatat(fd, ent->d_name, &st, AT_SYMLINK_NOFOLLOW) == 0
+		&& S_ISDIR(st.st_mode));
+}
+
+/**
+ * @brief Build the path of a subdirectory, ending with '/'.
+ *
+ * @param prefix Path of the parent ("" or ending with '/')
+ * @param name Subdirectory name
+ * @return Newly allocated path, or NULL on allocation failure
+ */
+static char	*join_dir_path(const char *prefix, const char *name)
+{
+	char	*path;
+	size_t	prefix_len;
+	size_t	name_len;
+
+	prefix_len = ft_strlen(prefix);
+	name_len = ft_strlen(name);
+	path = malloc(prefix_len + name_len + 2);
+	if (!path)
+		return (NULL);
+	ft_memcpy(path, prefix, prefix_len);
+	ft_memcpy(path + prefix_len, name, name_len);
+	path[prefix_len + name_len] = '/';
+	path[prefix_len + name_len + 1] = '\0';
+	return (path);
+}
+
+/**
+ * @brief Queue a subdirectory on the worker's own deque.
+ *
+ * The subdirectory is opened right away with openat() on the parent's
+ * descriptor, so no path is resolved again; past GLOB_MAX_OPEN_FDS
+ * pending descriptors it is queued closed and opened by path later.
+ *
+ * @param w Current worker
+ * @param parent Task of the directory being listed
+ * @param name Subdirectory name
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	spawn_child(t_walker *w, t_walk_task *parent, const char *name)
+{
+	t_walk_pool	*pool;
+	t_walk_task	task;
+
+	pool = w->pool;
+	task.path = join_dir_path(parent->path, name);
+	if (!task.path)
+		return (-1);
+	task.fd = -1;
+	if (atomic_fetch_add(&pool->open_fds, 1) < GLOB_MAX_OPEN_FDS)
+		task.fd = openat(parent->fd, name,
+				O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+	if (task.fd == -1)
+		atomic_fetch_sub(&pool->open_fds, 1);
+	atomic_fetch_add(&pool->pending, 1);
+	if (deque_push(&pool->deques[w->id], &task) == 0)
+		return (0);
+	atomic_fetch_sub(&pool->pending, 1);
+	walk_task_release(pool, &task);
+	return (-1);
+}
+
+/**
+ * @brief Add a raw directory entry to a listing, queueing subdirectories.
+ *
+ * @param w Current worker
+ * @param task Task of the directory being listed
+ * @param dir Listing being filled
+ * @param ent Entry returned by getdents64()
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	add_dent(t_walker *w, t_walk_task *task, t_dirlist *dir,
+	struct dirent64 *ent)
+{
+	if (ft_strcmp(ent->d_name, ".") == 0 || ft_strcmp(ent->d_name, "..") == 0)
+		return (0);
+	if (strvec_push(&dir->entries,
+			dir_entry_new(ent->d_type, ent->d_name)) == -1)
+		return (-1);
+	if (!is_subdir(task->fd, ent))
+		return (0);
+	return (spawn_child(w, task, ent->d_name));
+}
+
+/**
+ * @brief List an open directory with getdents64().
+ *
+ * One large buffer per worker takes many entries per system call, much
+ * fewer than readdir() on its default buffer for big directories.
+ *
+ * @param w Current worker
+ * @param task Task of the directory, with an open descriptor
+ * @param dir Listing to fill (left unsorted)
+ * @return 0 on success, -1 on read or allocation failure
+ */
+int	glob_scan_dir(t_walker *w, t_walk_task *task, t_dirlist *dir)
+{
+	struct dirent64	*ent;
+	ssize_t			size;
+	ssize_t			off;
+
+	size = getdents64(task->fd, w->dents, GLOB_DENTS_SIZE);
+	while (size > 0)
+	{
+		off = 0;
+		while (off < size)
+		{
+			ent = (struct dirent64 *)(w->dents + off);
+			off += ent->d_reclen;
+			if (add_dent(w, task, dir, ent) == -1)
+				return (-1);
+		}
+		size = getdents64(task->fd, w->dents, GLOB_DENTS_SIZE);
+	}
+	return ((int)size);
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_deque.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:29:36 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:29:36 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Initialize an empty work-stealing deque.
+ *
+ * @param dq Deque to initialize
+ * @return 0 on success, -1 if the lock cannot be created
+ */
+int	deque_init(t_walk_deque *dq)
+{
+	dq->tasks = NULL;
+	dq->head = 0;
+	dq->len = 0;
+	dq->cap = 0;
+	if (pthread_mutex_init(&dq->lock, NULL) != 0)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Push a task at the tail of a deque (owner side).
+ *
+ * The ring buffer doubles when full, unrolled so the head is at 0.
+ *
+ * @param dq Deque
+ * @param task Task to copy in
+ * @return 0 on success, -1 on allocation failure
+ */
+int	deque_push(t_walk_deque *dq, t_walk_task *task)
+{
+	t_walk_task	*tasks;
+	size_t		cap;
+	size_t		i;
+
+	pthread_mutex_lock(&dq->lock);
+	if (dq->len == dq->cap)
+	{
+		cap = dq->cap * 2 + 16;
+		tasks = malloc(sizeof(t_walk_task) * cap);
+		if (!tasks)
+			return (pthread_mutex_unlock(&dq->lock), -1);
+		i = 0;
+		while (i < dq->len)
+		{
+			tasks[i] = dq->tasks[(dq->head + i) % dq->cap];
+			i++;
+		}
+		free(dq->tasks);
+		dq->tasks = tasks;
+		dq->cap = cap;
+		dq->head = 0;
+	}
+	dq->tasks[(dq->head + dq->len++) % dq->cap] = *task;
+	return (pthread_mutex_unlock(&dq->lock), 0);
+}
+
+/**
+ * @brief Pop the newest task of a deque (owner side, depth first).
+ *
+ * @param dq Deque
+ * @param task Filled with the task
+ * @return true if a task was taken
+ */
+bool	deque_pop(t_walk_deque *dq, t_walk_task *task)
+{
+	bool	found;
+
+	pthread_mutex_lock(&dq->lock);
+	found = (dq->len > 0);
+	if (found)
+		*task = dq->tasks[(dq->head + --dq->len) % dq->cap];
+	pthread_mutex_unlock(&dq->lock);
+	return (found);
+}
+
+/**
+ * @brief Steal the oldest task of another worker's deque.
+ *
+ * The oldest directories are the closest to the root, so a thief takes
+ * the largest remaining subtrees.
+ *
+ * @param dq Deque of the victim
+ * @param task Filled with the task
+ * @return true if a task was taken
+ */
+bool	deque_steal(t_walk_deque *dq, t_walk_task *task)
+{
+	bool	found;
+
+	pthread_mutex_lock(&dq->lock);
+	found = (dq->len > 0);
+	if (found)
+	{
+		*task = dq->tasks[dq->head];
+		dq->head = (dq->head + 1) % dq->cap;
+		dq->len--;
+	}
+	pthread_mutex_unlock(&dq->lock);
+	return (found);
+}
+
+/**
+ * @brief Release a deque, closing and freeing the tasks left in it.
+ *
+ * @param dq Deque to destroy
+ */
+void	deque_destroy(t_walk_deque *dq)
+{
+	t_walk_task	task;
+
+	while (deque_pop(dq, &task))
+	{
+		if (task.fd != -1)
+			close(task.fd);
+		free(task.path);
+	}
+	free(dq->tasks);
+	pthread_mutex_destroy(&dq->lock);
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_globstar.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:29:18 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:56:00 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if a listing entry is a directory, and how it is reached.
+ *
+ * As in bash, `**` does not descend through symbolic links, so a link
+ * cycle cannot make the walk loop.
+ *
+ * @param g Glob state, its path ending with the entry name
+ * @param entry Listing entry (type byte, then name)
+ * @return 1 for a directory, 2 for a symlink to a directory, 0 otherwise
+ */
+static int	dir_kind(t_glob *g, const char *entry)
+{
+	struct stat	st;
+
+	if (entry[0] == DT_DIR)
+		return (1);
+	if (entry[0] != DT_UNKNOWN && entry[0] != DT_LNK)
+		return (0);
+	if (lstat(g->path.data, &st) == -1)
+		return (0);
+	if (S_ISDIR(st.st_mode))
+		return (1);
+	if (S_ISLNK(st.st_mode) && stat(g->path.data, &st) == 0
+		&& S_ISDIR(st.st_mode))
+		return (2);
+	return (0);
+}
+
+/**
+ * @brief Handle one entry below a `**` component.
+ *
+ * A final `**` matches the entry itself. For a directory, the path is
+ * left ending with "name/" so the caller can walk one level deeper. A
+ * symlink to a directory is not descended into, but with `links` the
+ * rest of the pattern is walked inside it, as one level.
+ *
+ * @param g Glob state
+ * @param idx Index of the `**` component
+ * @param entry Listing entry (type byte, then name)
+ * @param links Whether symlinks to directories count as one level
+ * @return 1 to descend into the entry, 0 if not, -1 on allocation
+ *         failure
+ */
+static int	globstar_entry(t_glob *g, size_t idx, const char *entry,
+	bool links)
+{
+	int	kind;
+
+	if (glob_path_set(g, g->path.len, entry + 1, ft_strlen(entry + 1)) == -1)
+		return (-1);
+	if (idx + 1 == g->ncomps
+		&& strvec_push(&g->matches, ft_strdup(g->path.data)) == -1)
+		return (-1);
+	kind = dir_kind(g, entry);
+	if (kind == 0)
+		return (0);
+	if (glob_path_set(g, g->path.len, "/", 1) == -1)
+		return (-1);
+	if (kind == 2 && links && idx + 1 < g->ncomps)
+		return (glob_walk(g, idx + 1));
+	return (kind == 1);
+}
+
+/**
+ * @brief Match `**` against the current directory and everything below.
+ *
+ * The rest of the pattern is walked from the directory itself (zero
+ * levels), then from each subdirectory. Hidden directories are skipped.
+ *
+ * @param g Glob state, its path at the directory
+ * @param idx Index of the `**` component
+ * @param links Whether symlinks to directories count as one level
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	globstar_dir(t_glob *g, size_t idx, bool links)
+{
+	t_dirlist	*dir;
+	size_t		mark;
+	size_t		i;
+	int			ret;
+
+	if (idx + 1 < g->ncomps && glob_walk(g, idx + 1) == -1)
+		return (-1);
+	dir = dircache_get(g->data, g->path.data);
+	if (!dir)
+		return (0);
+	mark = g->path.len;
+	i = 0;
+	ret = 0;
+	while (ret != -1 && i < dir->entries.len)
+	{
+		ret = 0;
+		if (dir->entries.items[i][1] != '.')
+			ret = globstar_entry(g, idx, dir->entries.items[i], links);
+		if (ret == 1)
+			ret = globstar_dir(g, idx, links);
+		glob_path_set(g, mark, NULL, 0);
+		i++;
+	}
+	return (ret);
+}
+
+/**
+ * @brief Walk a `**` component.
+ *
+ * Consecutive `**` components act as one, and a final `**` also matches
+ * the directory it starts from, with a trailing '/'. Unless its subtree
+ * is already cached, the directory tree is first listed in parallel by
+ * glob_prefetch(); the match itself then runs on the cached listings in
+ * the same order as a plain serial walk.
+ *
+ * As in bash, symlinks to directories count as one level only when a
+ * directory is named before the `**` (a prefix like `d`, `.` or an
+ * absolute path): a leading `**` of a relative pattern never matches
+ * inside a link.
+ *
+ * @param g Glob state
+ * @param idx Index of the `**` component
+ * @return 0 on success, -1 on allocation failure
+ */
+int	walk_globstar(t_glob *g, size_t idx)
+{
+	while (idx + 1 < g->ncomps && g->comps[idx + 1].globstar)
+		idx++;
+	if (idx + 1 == g->ncomps && g->path.len > 0
+		&& strvec_push(&g->matches, ft_strdup(g->path.data)) == -1)
+		return (-1);
+	if (!dircache_has_tree(g->data, g->path.data))
+		glob_prefetch(g->data, g->path.data);
+	return (globstar_dir(g, idx, g->path.len > 0));
+}
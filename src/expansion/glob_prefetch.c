@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_prefetch.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:30:34 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:30:34 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Release the pool: deques, getdents64() buffers and listings not
+ * handed over to the cache.
+ *
+ * @param pool Walker pool
+ * @param walkers Worker states
+ * @param count Number of initialized workers
+ */
+static void	pool_destroy(t_walk_pool *pool, t_walker *walkers, size_t count)
+{
+	t_dirlist	*dir;
+	size_t		i;
+
+	i = 0;
+	while (i < count)
+	{
+		deque_destroy(&pool->deques[i]);
+		free(walkers[i].dents);
+		while (pool->results[i])
+		{
+			dir = pool->results[i];
+			pool->results[i] = dir->next;
+			del_dir_listing(dir);
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Set up the pool and its workers.
+ *
+ * Listing directories mostly waits on the file system, so twice as many
+ * workers as online CPUs are used, within GLOB_MAX_THREADS.
+ *
+ * @param pool Walker pool to initialize
+ * @param walkers Worker states to initialize
+ * @return 0 on success, -1 on failure (nothing left to release)
+ */
+static int	pool_init(t_walk_pool *pool, t_walker *walkers)
+{
+	long	count;
+	size_t	i;
+
+	count = sysconf(_SC_NPROCESSORS_ONLN) * 2;
+	if (count < 2)
+		count = 2;
+	if (count > GLOB_MAX_THREADS)
+		count = GLOB_MAX_THREADS;
+	pool->nworkers = count;
+	atomic_init(&pool->pending, 0);
+	atomic_init(&pool->open_fds, 0);
+	i = 0;
+	while (i < pool->nworkers)
+	{
+		pool->results[i] = NULL;
+		walkers[i].pool = pool;
+		walkers[i].id = i;
+		walkers[i].dents = malloc(GLOB_DENTS_SIZE);
+		if (!walkers[i].dents || deque_init(&pool->deques[i]) == -1)
+			return (free(walkers[i].dents), pool_destroy(pool, walkers, i), -1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Hand the listings of all workers over to the directory cache.
+ *
+ * @param data Shell state structure
+ * @param pool Walker pool, its result lists left empty
+ */
+static void	collect_results(t_shell *data, t_walk_pool *pool)
+{
+	t_dirlist	*dir;
+	size_t		i;
+
+	i = 0;
+	while (i < pool->nworkers)
+	{
+		while (pool->results[i])
+		{
+			dir = pool->results[i];
+			pool->results[i] = dir->next;
+			dir->next = NULL;
+			if (dircache_insert(data, dir) == -1)
+				del_dir_listing(dir);
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief List a directory tree in parallel into the directory cache.
+ *
+ * A fixed pool of workers, the calling thread being one, each owns a
+ * deque of directories: a worker lists its newest directory and queues
+ * the subdirectories, and an idle worker steals the oldest directory of
+ * another one. The match itself is then done by the serial walk on the
+ * cached, sorted listings, so the result does not depend on scheduling.
+ * Any failure here only leaves directories out of the cache.
+ *
+ * @param data Shell state structure
+ * @param path Root of the tree ("" or ending with '/')
+ */
+void	glob_prefetch(t_shell *data, const char *path)
+{
+	t_walk_pool	pool;
+	t_walker	walkers[GLOB_MAX_THREADS];
+	pthread_t	threads[GLOB_MAX_THREADS];
+	t_walk_task	root;
+	size_t		started;
+
+	if (pool_init(&pool, walkers) == -1)
+		return ;
+	root.path = ft_strdup(path);
+	root.fd = -1;
+	atomic_store(&pool.pending, 1);
+	if (!root.path || deque_push(&pool.deques[0], &root) == -1)
+	{
+		free(root.path);
+		pool_destroy(&pool, walkers, pool.nworkers);
+		return ;
+	}
+	started = start_workers(&pool, walkers, threads);
+	glob_worker(&walkers[0]);
+	while (started > 1)
+		pthread_join(threads[--started], NULL);
+	collect_results(data, &pool);
+	pool_destroy(&pool, walkers, pool.nworkers);
+}
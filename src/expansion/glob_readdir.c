@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_readdir.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:22:06 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:32:41 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Compare two listing entries by name, in byte order.
+ *
+ * @param a Entry (type byte, then name)
+ * @param b Entry (type byte, then name)
+ * @return Negative, zero or positive like ft_strcmp()
+ */
+static int	compare_entries(const char *a, const char *b)
+{
+	return (ft_strcmp(a + 1, b + 1));
+}
+
+/**
+ * @brief Build a listing entry: the d_type byte followed by the name.
+ *
+ * Keeping the type lets the walker descend into directories without a
+ * stat() call on file systems that report it.
+ *
+ * @param type d_type reported for the entry
+ * @param name Entry name
+ * @return Newly allocated entry, or NULL on allocation failure
+ */
+char	*dir_entry_new(unsigned char type, const char *name)
+{
+	char	*entry;
+	size_t	len;
+
+	len = ft_strlen(name);
+	entry = malloc(len + 2);
+	if (!entry)
+		return (NULL);
+	entry[0] = type;
+	ft_memcpy(entry + 1, name, len + 1);
+	return (entry);
+}
+
+/**
+ * @brief Create an empty listing for a directory about to be read.
+ *
+ * @param path Directory path (copied)
+ * @param st Status of the directory, taken before reading it
+ * @return New listing, or NULL on allocation failure
+ */
+t_dirlist	*dirlist_new(const char *path, struct stat *st)
+{
+	t_dirlist	*dir;
+
+	dir = ft_calloc(1, sizeof(t_dirlist));
+	if (!dir)
+		return (NULL);
+	dir->path = ft_strdup(path);
+	if (!dir->path)
+		return (free(dir), NULL);
+	dir->dev = st->st_dev;
+	dir->ino = st->st_ino;
+	dir->mtime = st->st_mtim;
+	dir->listed_at = time(NULL);
+	return (dir);
+}
+
+/**
+ * @brief Sort the entries of a listing by name.
+ *
+ * @param dir Listing
+ * @return 0 on success, -1 on allocation failure
+ */
+int	sort_dir_entries(t_dirlist *dir)
+{
+	return (sort_strings(dir->entries.items, dir->entries.len,
+			compare_entries));
+}
+
+/**
+ * @brief Read a directory into a listing sorted by name.
+ *
+ * "." and ".." are left out, as with bash's globskipdots.
+ *
+ * @param dir Listing with its path set and no entries
+ * @return 0 on success, -1 if the directory cannot be read or on
+ *         allocation failure
+ */
+int	read_dir_entries(t_dirlist *dir)
+{
+	DIR				*stream;
+	struct dirent	*ent;
+
+	stream = opendir(dir->path);
+	if (!stream)
+		return (-1);
+	ent = readdir(stream);
+	while (ent)
+	{
+		if (ft_strcmp(ent->d_name, ".") != 0
+			&& ft_strcmp(ent->d_name, "..") != 0
+			&& strvec_push(&dir->entries,
+				dir_entry_new(ent->d_type, ent->d_name)) == -1)
+			return (closedir(stream), -1);
+		ent = readdir(stream);
+	}
+	closedir(stream);
+	return (sort_dir_entries(dir));
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_walk.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:23:18 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:32:41 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Truncate the walk path and append a string to it.
+ *
+ * The path is kept NUL-terminated so it can be passed to system calls;
+ * expand_glob() allocates it before the walk starts.
+ *
+ * @param g Glob state
+ * @param len Length to truncate the path to
+ * @param s String to append (may be NULL when n is 0)
+ * @param n Number of bytes of s to append
+ * @return 0 on success, -1 on allocation failure
+ */
+int	glob_path_set(t_glob *g, size_t len, const char *s, size_t n)
+{
+	g->path.len = len;
+	if (strbuf_append(&g->path, s, n) == -1)
+		return (-1);
+	if (g->path.data)
+		g->path.data[g->path.len] = '\0';
+	return (0);
+}
+
+/**
+ * @brief Add a matching directory entry to the walk.
+ *
+ * On the last component the path is a result. Otherwise the walk only
+ * continues into directories; the d_type byte stored in the listing
+ * avoids a stat() unless the file system did not report the type or
+ * the entry is a symlink.
+ *
+ * @param g Glob state
+ * @param idx Index of the component the entry matched
+ * @param entry Listing entry (type byte, then name)
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	visit_entry(t_glob *g, size_t idx, const char *entry)
+{
+	struct stat	st;
+
+	if (glob_path_set(g, g->path.len, entry + 1, ft_strlen(entry + 1)) == -1)
+		return (-1);
+	if (idx + 1 == g->ncomps)
+		return (strvec_push(&g->matches, ft_strdup(g->path.data)));
+	if (entry[0] != DT_DIR && (entry[0] != DT_UNKNOWN && entry[0] != DT_LNK))
+		return (0);
+	if (entry[0] != DT_DIR
+		&& (stat(g->path.data, &st) == -1 || !S_ISDIR(st.st_mode)))
+		return (0);
+	if (glob_path_set(g, g->path.len, "/", 1) == -1)
+		return (-1);
+	return (glob_walk(g, idx + 1));
+}
+
+/**
+ * @brief Walk a component without wildcards.
+ *
+ * The name is used as is instead of listing the directory; only a final
+ * component is checked for existence.
+ *
+ * @param g Glob state
+ * @param idx Index of the component
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	walk_literal(t_glob *g, size_t idx)
+{
+	struct stat	st;
+	size_t		mark;
+	int			ret;
+
+	mark = g->path.len;
+	ret = glob_path_set(g, mark, g->comps[idx].literal,
+			ft_strlen(g->comps[idx].literal));
+	if (ret == 0 && idx + 1 < g->ncomps)
+	{
+		ret = glob_path_set(g, g->path.len, "/", 1);
+		if (ret == 0)
+			ret = glob_walk(g, idx + 1);
+	}
+	else if (ret == 0 && lstat(g->path.data, &st) == 0)
+		ret = strvec_push(&g->matches, ft_strdup(g->path.data));
+	glob_path_set(g, mark, NULL, 0);
+	return (ret);
+}
+
+/**
+ * @brief Walk a component with wildcards against the directory listing.
+ *
+ * Names starting with '.' only match a pattern that starts with a
+ * literal '.'.
+ *
+ * @param g Glob state
+ * @param idx Index of the component
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	walk_matches(t_glob *g, size_t idx)
+{
+	t_dirlist	*dir;
+	const char	*entry;
+	size_t		mark;
+	size_t		i;
+	bool		dots;
+
+	mark = g->path.len;
+	dir = dircache_get(g->data, g->path.data);
+	if (!dir)
+		return (0);
+	dots = g->comps[idx].count > 0 && g->comps[idx].elems[0].kind == PAT_CHAR
+		&& g->comps[idx].elems[0].c == '.';
+	i = 0;
+	while (i < dir->entries.len)
+	{
+		entry = dir->entries.items[i++];
+		if ((entry[1] != '.' || dots)
+			&& pattern_match(&g->comps[idx], entry + 1)
+			&& visit_entry(g, idx, entry) == -1)
+			return (glob_path_set(g, mark, NULL, 0), -1);
+		glob_path_set(g, mark, NULL, 0);
+	}
+	return (0);
+}
+
+/**
+ * @brief Expand the path components from idx onward.
+ *
+ * g->path holds the directory matched so far ("" for the current
+ * directory, ending in '/' otherwise); results are added to g->matches.
+ *
+ * @param g Glob state
+ * @param idx Index of the next component
+ * @return 0 on success, -1 on allocation failure
+ */
+int	glob_walk(t_glob *g, size_t idx)
+{
+	if (g->comps[idx].globstar)
+		return (walk_globstar(g, idx));
+	if (!g->comps[idx].magic)
+		return (walk_literal(g, idx));
+	return (walk_matches(g, idx));
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_worker.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:30:34 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:30:34 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Close and free a finished or abandoned task.
+ *
+ * @param pool Walker pool (open descriptor count)
+ * @param task Task to release
+ */
+void	walk_task_release(t_walk_pool *pool, t_walk_task *task)
+{
+	if (task->fd != -1)
+	{
+		close(task->fd);
+		atomic_fetch_sub(&pool->open_fds, 1);
+	}
+	free(task->path);
+	task->path = NULL;
+	task->fd = -1;
+}
+
+/**
+ * @brief Take the next directory: from the worker's own deque first,
+ * else stolen from the other workers in turn.
+ *
+ * @param w Current worker
+ * @param task Filled with the task
+ * @return true if a task was taken
+ */
+static bool	take_task(t_walker *w, t_walk_task *task)
+{
+	t_walk_pool	*pool;
+	size_t		i;
+
+	pool = w->pool;
+	if (deque_pop(&pool->deques[w->id], task))
+		return (true);
+	i = 1;
+	while (i < pool->nworkers)
+	{
+		if (deque_steal(&pool->deques[(w->id + i) % pool->nworkers], task))
+			return (true);
+		i++;
+	}
+	return (false);
+}
+
+/**
+ * @brief List one directory and keep the sorted listing.
+ *
+ * A directory that cannot be opened or read is left out: the serial
+ * walk will try it again and skip it the same way.
+ *
+ * @param w Current worker
+ * @param task Directory to list (released here)
+ */
+static void	process_task(t_walker *w, t_walk_task *task)
+{
+	struct stat	st;
+	t_dirlist	*dir;
+	const char	*path;
+
+	path = task->path;
+	if (!*path)
+		path = ".";
+	if (task->fd == -1)
+	{
+		task->fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+		if (task->fd != -1)
+			atomic_fetch_add(&w->pool->open_fds, 1);
+	}
+	dir = NULL;
+	if (task->fd != -1 && fstat(task->fd, &st) == 0)
+		dir = dirlist_new(path, &st);
+	if (dir && glob_scan_dir(w, task, dir) == 0 && sort_dir_entries(dir) == 0)
+	{
+		dir->tree = true;
+		dir->next = w->pool->results[w->id];
+		w->pool->results[w->id] = dir;
+		dir = NULL;
+	}
+	del_dir_listing(dir);
+	walk_task_release(w->pool, task);
+}
+
+/**
+ * @brief Worker loop: list directories until none is queued or in work.
+ *
+ * `pending` counts a directory from the moment it is queued until its
+ * listing is done, and a listing queues its subdirectories before it is
+ * done, so the count only drops to zero once the whole tree is listed.
+ *
+ * @param arg t_walker of this worker
+ * @return NULL
+ */
+void	*glob_worker(void *arg)
+{
+	t_walker	*w;
+	t_walk_task	task;
+
+	w = arg;
+	while (atomic_load(&w->pool->pending) > 0)
+	{
+		if (take_task(w, &task))
+		{
+			process_task(w, &task);
+			atomic_fetch_sub(&w->pool->pending, 1);
+		}
+		else
+			sched_yield();
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Start the worker threads other than the calling one.
+ *
+ * Signals are blocked in the workers so that they are still handled by
+ * the main thread.
+ *
+ * @param pool Walker pool
+ * @param walkers Worker states, walkers[0] being the calling thread
+ * @param threads Filled with the started threads
+ * @return Number of workers running, the calling thread included
+ */
+size_t	start_workers(t_walk_pool *pool, t_walker *walkers, pthread_t *threads)
+{
+	sigset_t	all;
+	sigset_t	old;
+	size_t		started;
+
+	sigfillset(&all);
+	pthread_sigmask(SIG_BLOCK, &all, &old);
+	started = 1;
+	while (started < pool->nworkers
+		&& pthread_create(&threads[started], NULL, glob_worker,
+			&walkers[started]) == 0)
+		started++;
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+	return (started);
+}
@@ -0,0 +1,176 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_default.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:58:27 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:39:36 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Use the word of `${name=word}` or `${name?word}`.
+ *
+ * `=` assigns the word to the variable. `?` reports the word (or a
+ * default message) and abandons the rest of the input line, as an
+ * interactive bash does.
+ *
+ * @param p Expansion
+ * @param word Expanded word
+ * @return 0 on success, -1 on error (already reported)
+ */
+static int	param_use_word(t_param *p, char *word)
+{
+	if (*p->op == '?')
+	{
+		if (*word)
+			print_error(ERR_PREFIX, p->name, ": ", word);
+		else
+			print_error(ERR_PREFIX, p->name, ": ", ERR_PARAM_UNSET);
+		p->data->aborting = true;
+		return (-1);
+	}
+	if (*p->op != '=')
+		return (0);
+	if (ft_strchr(SPECIAL_PARAMS, p->name[0]))
+	{
+		print_error(ERR_PREFIX "$", p->name, ERR_PARAM_ASSIGN, NULL);
+		return (-1);
+	}
+	return (set_env_value(&p->data->env_list, p->name, word));
+}
+
+/**
+ * @brief Expand `${name-word}`, `${name=word}`, `${name?word}` or
+ * `${name+word}`, and their `:` forms.
+ *
+ * The parameter is missing when it is unset or, with `:`, empty. The word
+ * is only expanded when it is used. `?` fails the command.
+ *
+ * @param p Expansion
+ * @return 0 on success, -1 on error (already reported)
+ */
+int	param_default(t_param *p)
+{
+	char	*word;
+	bool	missing;
+	int		ret;
+
+	missing = (!p->value || (p->colon && !*p->value));
+	if (*p->op == '+' && missing)
+		return (0);
+	if (*p->op != '+' && !missing)
+		return (strbuf_append(p->buf, p->value, ft_strlen(p->value)));
+	word = expand_word(p->word, p->data);
+	if (!word)
+		return (-1);
+	ret = param_use_word(p, word);
+	if (ret == 0)
+		ret = strbuf_append(p->buf, word, ft_strlen(word));
+	free(word);
+	return (ret);
+}
+
+/**
+ * @brief Expand `${#name}`: the length of the value in bytes, or the
+ * number of positional parameters for `${#@}`.
+ *
+ * @param p Expansion
+ * @return 0 on success, -1 on allocation failure
+ */
+int	param_length(t_param *p)
+{
+	char	*digits;
+	size_t	len;
+	int		ret;
+
+	len = 0;
+	if (p->name[0] == '@')
+		len = count_params(p->data);
+	else if (p->value)
+		len = ft_strlen(p->value);
+	digits = ft_lltoa(len);
+	if (!digits)
+		return (-1);
+	ret = strbuf_append(p->buf, digits, ft_strlen(digits));
+	free(digits);
+	return (ret);
+}
+
+/**
+ * @brief Evaluate the offset and length of a substring expansion.
+ *
+ * Both are arithmetic expressions, expanded first; an empty one is 0.
+ *
+ * @param p Expansion
+ * @param sep ':' before the length in the operand, or NULL without one
+ * @param off Receives the offset
+ * @param len Receives the length (LLONG_MAX without one)
+ * @return 0 on success, -1 on error (already reported)
+ */
+static int	substring_bounds(t_param *p, char *sep, long long *off,
+	long long *len)
+{
+	char	*digits;
+	int		status;
+
+	*len = LLONG_MAX;
+	if (sep)
+		*sep = '\0';
+	digits = expand_word(p->word, p->data);
+	if (!digits)
+		return (-1);
+	status = arith_evaluate(digits, p->data, 0, off);
+	free(digits);
+	if (status == -1 || !sep)
+		return (status);
+	digits = expand_word(sep + 1, p->data);
+	if (!digits)
+		return (-1);
+	status = arith_evaluate(digits, p->data, 0, len);
+	free(digits);
+	return (status);
+}
+
+/**
+ * @brief Expand `${name:offset}` or `${name:offset:length}`.
+ *
+ * Offsets and lengths count bytes. A negative offset counts from the end
+ * of the value; a negative length is an end position counted from the
+ * end, which must not come before the offset.
+ *
+ * @param p Expansion
+ * @return 0 on success, -1 on error (already reported)
+ */
+int	param_substring(t_param *p)
+{
+	char		*sep;
+	long long	off;
+	long long	len;
+	long long	size;
+
+	sep = ft_strchr(p->word, ':');
+	if (substring_bounds(p, sep, &off, &len) == -1)
+		return (-1);
+	if (!p->value)
+		return (0);
+	size = ft_strlen(p->value);
+	if (off < 0)
+		off += size;
+	if (off < 0 || off > size)
+		return (0);
+	if (len < 0)
+		len += size - off;
+	if (len < 0)
+	{
+		print_error(ERR_PREFIX, sep + 1, ERR_SUBSTR_NEG, NULL);
+		return (-1);
+	}
+	if (len > size - off)
+		len = size - off;
+	return (strbuf_append(p->buf, p->value + off, len));
+}
@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_expand.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:58:27 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:58:27 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Report a malformed `${...}` expansion.
+ *
+ * @param p Expansion being parsed
+ * @return -1
+ */
+int	param_bad_subst(t_param *p)
+{
+	print_error(ERR_PREFIX "${", p->text, "}" ERR_BAD_SUBST, NULL);
+	return (-1);
+}
+
+/**
+ * @brief Look up the value of the parameter of an expansion.
+ *
+ * Unlike `$name`, an unset parameter is told apart from an empty one:
+ * p->value stays NULL for an unset variable or a positional parameter
+ * past `$#`.
+ *
+ * @param p Expansion with its name
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	param_value(t_param *p)
+{
+	t_env	*env;
+
+	p->value = NULL;
+	if (ft_isdigit(p->name[0]) && p->name[0] != '0'
+		&& (size_t)(p->name[0] - '0') > count_params(p->data))
+		return (0);
+	if (ft_strchr(SPECIAL_PARAMS, p->name[0]))
+		p->value = get_var_value(p->name, p->data);
+	else
+	{
+		env = get_env_node_by_key(p->data->env_list, p->name);
+		if (!env || !env->value)
+			return (0);
+		p->value = ft_strdup(env->value);
+	}
+	if (!p->value)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Apply the operator that follows the name.
+ *
+ * @param p Expansion with its name, value and operator
+ * @return 0 on success, -1 on error (already reported)
+ */
+static int	param_operator(t_param *p)
+{
+	char	c;
+
+	p->colon = (p->op[0] == ':' && p->op[1] && ft_strchr("-=?+", p->op[1]));
+	p->op += p->colon;
+	c = *p->op;
+	if (!c)
+	{
+		if (!p->value)
+			return (0);
+		return (strbuf_append(p->buf, p->value, ft_strlen(p->value)));
+	}
+	p->twice = (ft_strchr("#%/", c) && p->op[1] == c);
+	p->word = p->op + 1 + p->twice;
+	if (ft_strchr("-=?+", c))
+		return (param_default(p));
+	if (c == ':')
+		return (param_substring(p));
+	if (c == '#' || c == '%')
+		return (param_remove(p));
+	if (c == '/')
+		return (param_replace(p));
+	return (param_bad_subst(p));
+}
+
+/**
+ * @brief Split the text between the braces into name and operator, then
+ * expand.
+ *
+ * `${#name}` is the length form only when the name fills the braces, so
+ * that `${#}` and `${#:-x}` still read `#` as the parameter.
+ *
+ * @param p Expansion with its text
+ * @param s Word at the '$'
+ * @return 0 on success, -1 on error (already reported)
+ */
+static int	param_parse(t_param *p, const char *s)
+{
+	bool	length;
+
+	length = false;
+	if (p->text[0] == '#' && p->text[1])
+	{
+		p->name = extract_var_name(s, 2);
+		length = (p->name && !p->text[1 + ft_strlen(p->name)]);
+		if (!length)
+			free(p->name);
+	}
+	if (!length)
+		p->name = extract_var_name(s, 1);
+	if (!p->name)
+		return (param_bad_subst(p));
+	p->op = p->text + length + ft_strlen(p->name);
+	if (param_value(p) == -1)
+		return (-1);
+	if (length)
+		return (param_length(p));
+	return (param_operator(p));
+}
+
+/**
+ * @brief Expand one `${...}` into the expansion output.
+ *
+ * Supports `${name}`, `${#name}`, the defaults `-` `=` `?` `+` (with or
+ * without `:`), the pattern removals `#` `##` `%` `%%`, the replacements
+ * `/` `//` `/#` `/%` and the substring `:offset:length`. The result is
+ * appended as is, like any parameter value.
+ *
+ * @param buf Expansion output
+ * @param s Word at the '$'
+ * @param span Length of the expansion, closing brace included
+ * @param data Shell state structure
+ * @return 0 on success, -1 on error (already reported)
+ */
+int	append_param(t_strbuf *buf, const char *s, size_t span, t_shell *data)
+{
+	t_param	p;
+	int		ret;
+
+	ft_bzero(&p, sizeof(p));
+	p.buf = buf;
+	p.data = data;
+	if (span < 3)
+		span = 3;
+	p.text = ft_substr(s, 2, span - 3);
+	if (!p.text)
+		return (-1);
+	if (s[span - 1] != '}')
+		ret = param_bad_subst(&p);
+	else
+		ret = param_parse(&p, s);
+	free(p.text);
+	free(p.name);
+	free(p.value);
+	return (ret);
+}
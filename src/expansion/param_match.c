@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_match.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:58:27 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:58:27 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Compile the pattern operand of a `${...}` expansion.
+ *
+ * The operand is expanded first; its quoted wildcards only match
+ * themselves, as for pathname expansion.
+ *
+ * @param p Expansion
+ * @param word Raw operand
+ * @param len Length of the operand
+ * @param pat Compiled pattern to fill (release with pattern_free())
+ * @return 0 on success, -1 on error
+ */
+int	param_compile(t_param *p, const char *word, size_t len, t_pattern *pat)
+{
+	char	*raw;
+	char	*pattern;
+	int		ret;
+
+	raw = ft_substr(word, 0, len);
+	if (!raw)
+		return (-1);
+	pattern = expand_pattern(raw, p->data);
+	free(raw);
+	if (!pattern)
+		return (-1);
+	ret = pattern_compile(pattern, ft_strlen(pattern), pat);
+	free(pattern);
+	return (ret);
+}
+
+/**
+ * @brief Find the shortest or longest prefix of s matching a pattern.
+ *
+ * Each candidate is cut in place with a NUL byte and matched as a whole
+ * string; a pattern without wildcards is one comparison.
+ *
+ * @param pat Compiled pattern
+ * @param s String (restored before return)
+ * @param len Length of s
+ * @param longest true to prefer the longest match
+ * @return Length of the matching prefix, or -1 if none matches
+ */
+ssize_t	match_prefix(const t_pattern *pat, char *s, size_t len, bool longest)
+{
+	size_t	k;
+	char	saved;
+	bool	hit;
+
+	if (!pat->magic)
+	{
+		if (pat->count <= len && !ft_memcmp(s, pat->literal, pat->count))
+			return (pat->count);
+		return (-1);
+	}
+	k = len * longest;
+	while (k <= len)
+	{
+		saved = s[k];
+		s[k] = '\0';
+		hit = pattern_match(pat, s);
+		s[k] = saved;
+		if (hit)
+			return (k);
+		if (longest)
+			k--;
+		else
+			k++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Find the shortest or longest suffix of s matching a pattern.
+ *
+ * @param pat Compiled pattern
+ * @param s NUL-terminated string
+ * @param len Length of s
+ * @param longest true to prefer the longest match
+ * @return Start index of the matching suffix, or -1 if none matches
+ */
+ssize_t	match_suffix(const t_pattern *pat, const char *s, size_t len,
+	bool longest)
+{
+	size_t	i;
+
+	if (!pat->magic)
+	{
+		if (pat->count <= len
+			&& !ft_memcmp(s + len - pat->count, pat->literal, pat->count))
+			return (len - pat->count);
+		return (-1);
+	}
+	i = len * !longest;
+	while (i <= len)
+	{
+		if (pattern_match(pat, s + i))
+			return (i);
+		if (longest)
+			i++;
+		else
+			i--;
+	}
+	return (-1);
+}
@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_pattern.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:58:27 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:56:25 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Expand `${name#pat}`, `${name##pat}`, `${name%pat}` or
+ * `${name%%pat}`: the value without its shortest or longest matching
+ * prefix or suffix.
+ *
+ * @param p Expansion
+ * @return 0 on success, -1 on error
+ */
+int	param_remove(t_param *p)
+{
+	t_pattern	pat;
+	ssize_t		k;
+	size_t		len;
+
+	if (!p->value)
+		return (0);
+	if (param_compile(p, p->word, ft_strlen(p->word), &pat) == -1)
+		return (-1);
+	len = ft_strlen(p->value);
+	if (*p->op == '#')
+		k = match_prefix(&pat, p->value, len, p->twice);
+	else
+		k = match_suffix(&pat, p->value, len, p->twice);
+	pattern_free(&pat);
+	if (*p->op == '#' && k > 0)
+		return (strbuf_append(p->buf, p->value + k, len - k));
+	if (*p->op == '%' && k >= 0)
+		return (strbuf_append(p->buf, p->value, k));
+	return (strbuf_append(p->buf, p->value, len));
+}
+
+/**
+ * @brief Length of the pattern of `${name/pat/rep}`, up to the first '/'
+ * outside quotes and nested expansions and not escaped by a backslash.
+ *
+ * @param s Operand after the operator
+ * @return Length of the pattern
+ */
+static size_t	pattern_length(const char *s)
+{
+	t_quote	quote_state;
+	size_t	i;
+
+	quote_state = STATE_NOT_IN_QUOTE;
+	i = 0;
+	while (s[i] && (s[i] != '/' || quote_state != STATE_NOT_IN_QUOTE))
+	{
+		if (s[i] == '$' && s[i + 1] == '{'
+			&& quote_state != STATE_IN_SINGLE_QUOTE)
+			i += brace_group_length(s + i + 1);
+		else if (s[i] == '\\' && s[i + 1]
+			&& quote_state != STATE_IN_SINGLE_QUOTE)
+			i++;
+		else
+			quote_state = update_quote_state(quote_state, s[i]);
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Replace a match anchored at the start (`/#`) or the end (`/%`)
+ * of the value.
+ *
+ * @param p Expansion
+ * @param pat Compiled pattern
+ * @param rep Expanded replacement
+ * @param anchor '#' or '%'
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	replace_anchored(t_param *p, const t_pattern *pat,
+	const char *rep, char anchor)
+{
+	size_t	len;
+	ssize_t	k;
+
+	len = ft_strlen(p->value);
+	if (anchor == '#')
+		k = match_prefix(pat, p->value, len, true);
+	else
+		k = match_suffix(pat, p->value, len, true);
+	if (k < 0)
+		return (strbuf_append(p->buf, p->value, len));
+	if (anchor == '%' && strbuf_append(p->buf, p->value, k) == -1)
+		return (-1);
+	if (strbuf_append(p->buf, rep, ft_strlen(rep)) == -1)
+		return (-1);
+	if (anchor == '#')
+		return (strbuf_append(p->buf, p->value + k, len - k));
+	return (0);
+}
+
+/**
+ * @brief Replace the first (`/`) or every (`//`) longest non-empty match
+ * of the pattern, scanning the value left to right.
+ *
+ * @param p Expansion
+ * @param pat Compiled pattern
+ * @param rep Expanded replacement
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	replace_matches(t_param *p, const t_pattern *pat, const char *rep)
+{
+	size_t	start;
+	size_t	i;
+	size_t	len;
+	ssize_t	k;
+
+	len = ft_strlen(p->value);
+	start = 0;
+	i = 0;
+	while (i < len)
+	{
+		k = match_prefix(pat, p->value + i, len - i, true);
+		if (k <= 0)
+		{
+			i++;
+			continue ;
+		}
+		if (strbuf_append(p->buf, p->value + start, i - start) == -1
+			|| strbuf_append(p->buf, rep, ft_strlen(rep)) == -1)
+			return (-1);
+		i += k;
+		start = i;
+		if (!p->twice)
+			break ;
+	}
+	return (strbuf_append(p->buf, p->value + start, len - start));
+}
+
+/**
+ * @brief Expand `${name/pat/rep}` and its `//`, `/#` and `/%` forms.
+ *
+ * The replacement is optional (`${name/pat}` deletes the match) and is
+ * expanded like a plain word.
+ *
+ * @param p Expansion
+ * @return 0 on success, -1 on error
+ */
+int	param_replace(t_param *p)
+{
+	t_pattern	pat;
+	char		anchor;
+	size_t		len;
+	char		*rep;
+	int			ret;
+
+	anchor = '\0';
+	if (!p->twice && (*p->word == '#' || *p->word == '%'))
+		anchor = *p->word++;
+	len = pattern_length(p->word);
+	rep = expand_word(p->word + len + (p->word[len] == '/'), p->data);
+	if (!rep)
+		return (-1);
+	if (param_compile(p, p->word, len, &pat) == -1)
+		return (free(rep), -1);
+	ret = 0;
+	if (p->value && anchor)
+		ret = replace_anchored(p, &pat, rep, anchor);
+	else if (p->value)
+		ret = replace_matches(p, &pat, rep);
+	pattern_free(&pat);
+	free(rep);
+	return (ret);
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pattern_class.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:20:36 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:20:36 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Add the bytes of the k-th class name of pattern_set_class().
+ *
+ * @param k Index of the class name
+ * @param set Bitmap of the accepted bytes
+ */
+static void	class_add(size_t k, unsigned char *set)
+{
+	static int	(*const tests[])(int) = {isalnum, isalpha, isblank,
+		iscntrl, isdigit, isgraph, islower, isprint, ispunct, isspace,
+		isupper, isxdigit};
+	int			c;
+
+	c = 0;
+	while (c < 256)
+	{
+		if (tests[k](c))
+			set[c / 8] |= 1 << (c % 8);
+		c++;
+	}
+}
+
+/**
+ * @brief Add a character class `[:name:]` of a bracket expression.
+ *
+ * The classes are those of POSIX, tested with the <ctype.h> functions. A
+ * class with an unknown name is consumed but matches nothing, as in bash.
+ *
+ * @param s Bracket expression item, at the '['
+ * @param len Length of the rest of the expression
+ * @param set Bitmap of the accepted bytes
+ * @return Length of the class, 0 if s does not start one
+ */
+size_t	pattern_set_class(const char *s, size_t len, unsigned char *set)
+{
+	static const char	*names[] = {"alnum", "alpha", "blank", "cntrl",
+		"digit", "graph", "lower", "print", "punct", "space", "upper",
+		"xdigit", NULL};
+	size_t				end;
+	size_t				k;
+
+	if (len < 4 || s[0] != '[' || s[1] != ':')
+		return (0);
+	end = 2;
+	while (end + 1 < len && !(s[end] == ':' && s[end + 1] == ']'))
+		end++;
+	if (end + 1 >= len)
+		return (0);
+	k = 0;
+	while (names[k] && (ft_strlen(names[k]) != end - 2
+			|| ft_strncmp(names[k], s + 2, end - 2) != 0))
+		k++;
+	if (names[k])
+		class_add(k, set);
+	return (end + 2);
+}
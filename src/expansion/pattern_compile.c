@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pattern_compile.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:20:36 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:57:01 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Add one item of a bracket expression: a character, a range or a
+ * character class.
+ *
+ * @param s Bracket expression
+ * @param len Length of s
+ * @param i Index of the item
+ * @param set Bitmap of the accepted bytes
+ * @return Index of the next item
+ */
+static size_t	parse_set_item(const char *s, size_t len, size_t i,
+	unsigned char *set)
+{
+	int		from;
+	int		to;
+	size_t	n;
+
+	n = pattern_set_class(s + i, len - i, set);
+	if (n > 0)
+		return (i + n);
+	if (s[i] == '\\' && i + 1 < len)
+		i++;
+	from = (unsigned char)s[i++];
+	to = from;
+	if (i + 1 < len && s[i] == '-' && s[i + 1] != ']')
+	{
+		i++;
+		if (s[i] == '\\' && i + 1 < len)
+			i++;
+		to = (unsigned char)s[i++];
+	}
+	while (from <= to)
+	{
+		set[from / 8] |= 1 << (from % 8);
+		from++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Compile a bracket expression `[...]` into a 256-bit set.
+ *
+ * `[!...]` and `[^...]` negate the set; a ']' right after the opening
+ * bracket is a member. Ranges compare byte values, not the locale;
+ * `[:alpha:]` and the other POSIX classes are recognised.
+ *
+ * @param s Pattern at the '['
+ * @param len Length of the rest of the pattern
+ * @param elem Element to fill
+ * @return Length of the expression, 0 if it is not closed ('[' is then a
+ *         literal character)
+ */
+static size_t	parse_set(const char *s, size_t len, t_pat_elem *elem)
+{
+	size_t	i;
+	size_t	first;
+	bool	negate;
+
+	negate = (len > 1 && (s[1] == '!' || s[1] == '^'));
+	first = 1 + negate;
+	i = first;
+	ft_bzero(elem->set, sizeof(elem->set));
+	while (i < len && (s[i] != ']' || i == first))
+		i = parse_set_item(s, len, i, elem->set);
+	if (i >= len)
+		return (0);
+	first = 0;
+	while (negate && first < sizeof(elem->set))
+	{
+		elem->set[first] = ~elem->set[first];
+		first++;
+	}
+	elem->kind = PAT_SET;
+	return (i + 1);
+}
+
+/**
+ * @brief Compile the pattern element at s[0].
+ *
+ * @param s Pattern
+ * @param len Length of the rest of the pattern
+ * @param elem Element to fill
+ * @return Number of pattern bytes consumed
+ */
+static size_t	compile_elem(const char *s, size_t len, t_pat_elem *elem)
+{
+	size_t	n;
+
+	elem->kind = PAT_CHAR;
+	elem->c = s[0];
+	if (s[0] == '\\' && len > 1)
+	{
+		elem->c = s[1];
+		return (2);
+	}
+	if (s[0] == '*')
+		elem->kind = PAT_STAR;
+	else if (s[0] == '?')
+		elem->kind = PAT_ANY;
+	else if (s[0] == '[')
+	{
+		n = parse_set(s, len, elem);
+		if (n > 0)
+			return (n);
+	}
+	return (1);
+}
+
+/**
+ * @brief Compile a glob pattern once, for repeated matching.
+ *
+ * Backslash escapes a character; consecutive stars collapse into one. A
+ * component made of exactly two stars is flagged as recursive (`**`).
+ *
+ * @param s Pattern (one path component, escaped quoted characters)
+ * @param len Length of the pattern
+ * @param p Compiled pattern to fill (release with pattern_free())
+ * @return 0 on success, -1 on allocation failure
+ */
+int	pattern_compile(const char *s, size_t len, t_pattern *p)
+{
+	size_t	i;
+
+	ft_bzero(p, sizeof(*p));
+	p->elems = malloc(sizeof(t_pat_elem) * (len + 1));
+	p->literal = malloc(len + 1);
+	if (!p->elems || !p->literal)
+		return (pattern_free(p), -1);
+	i = 0;
+	while (i < len)
+	{
+		i += compile_elem(s + i, len - i, &p->elems[p->count]);
+		if (p->elems[p->count].kind == PAT_STAR && p->count > 0
+			&& p->elems[p->count - 1].kind == PAT_STAR)
+			continue ;
+		p->literal[p->count] = p->elems[p->count].c;
+		p->magic |= (p->elems[p->count].kind != PAT_CHAR);
+		p->count++;
+	}
+	p->literal[p->count] = '\0';
+	p->globstar = (len == 2 && s[0] == '*' && s[1] == '*');
+	pattern_set_shape(p);
+	return (0);
+}
+
+/**
+ * @brief Release a compiled pattern.
+ *
+ * @param p Pattern to release (left empty)
+ */
+void	pattern_free(t_pattern *p)
+{
+	free(p->elems);
+	free(p->literal);
+	ft_bzero(p, sizeof(*p));
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pattern_match.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:20:36 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:41:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if a single-character element accepts c.
+ *
+ * @param e PAT_CHAR, PAT_ANY or PAT_SET element
+ * @param c Byte to test
+ * @return true if the element matches c
+ */
+static bool	elem_matches(const t_pat_elem *e, unsigned char c)
+{
+	if (e->kind == PAT_CHAR)
+		return (e->c == c);
+	if (e->kind == PAT_ANY)
+		return (true);
+	return ((e->set[c / 8] >> (c % 8)) & 1);
+}
+
+/**
+ * @brief Match a string against the elements of a compiled pattern.
+ *
+ * Single left-to-right scan: on a mismatch only the last '*' is retried
+ * one byte further, which is enough for glob patterns and keeps the cost
+ * at O(len(str) * count) without recursion.
+ *
+ * @param p Compiled pattern
+ * @param str String to match
+ * @return true if the whole string matches
+ */
+static bool	match_general(const t_pattern *p, const char *str)
+{
+	t_match_pos	m;
+
+	ft_bzero(&m, sizeof(m));
+	while (str[m.si])
+	{
+		if (m.pi < p->count && p->elems[m.pi].kind == PAT_STAR)
+		{
+			m.star = ++m.pi;
+			m.mark = m.si;
+		}
+		else if (m.pi < p->count && elem_matches(&p->elems[m.pi], str[m.si]))
+		{
+			m.pi++;
+			m.si++;
+		}
+		else if (m.star == 0)
+			return (false);
+		else
+		{
+			m.pi = m.star;
+			m.si = ++m.mark;
+		}
+	}
+	return (m.pi == p->count || (m.pi + 1 == p->count
+			&& p->elems[m.pi].kind == PAT_STAR));
+}
+
+/**
+ * @brief Match a string against a compiled pattern.
+ *
+ * Simple shapes, found once by pattern_set_shape(), are one comparison
+ * of their fixed text: the whole string, its start, its end or a search
+ * in it. Other patterns go through match_general().
+ *
+ * @param p Compiled pattern
+ * @param str String to match (a file name or a `case` word)
+ * @return true if the whole string matches
+ */
+bool	pattern_match(const t_pattern *p, const char *str)
+{
+	size_t	len;
+
+	if (p->shape == SHAPE_LITERAL)
+		return (ft_strcmp(str, p->literal) == 0);
+	if (p->shape == SHAPE_ANY)
+		return (true);
+	if (p->shape == SHAPE_PREFIX)
+		return (ft_strncmp(str, p->literal, p->fixed_len) == 0);
+	if (p->shape == SHAPE_GENERAL)
+		return (match_general(p, str));
+	len = ft_strlen(str);
+	if (len < p->fixed_len)
+		return (false);
+	if (p->shape == SHAPE_SUFFIX)
+		return (ft_memcmp(str + len - p->fixed_len, p->literal,
+				p->fixed_len) == 0);
+	return (ft_strnstr(str, p->literal, len) != NULL);
+}
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pattern_shape.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:34:56 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:34:56 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Name the shape of a pattern made of literal characters between
+ * an optional leading and trailing '*'.
+ *
+ * @param first Index of the first literal element (1 after a '*')
+ * @param last End of the literal elements
+ * @param count Number of elements
+ * @return Shape of the pattern
+ */
+static t_pat_shape	shape_of(size_t first, size_t last, size_t count)
+{
+	if (first == 0 && last == count)
+		return (SHAPE_LITERAL);
+	if (first == last)
+		return (SHAPE_ANY);
+	if (first == 0)
+		return (SHAPE_PREFIX);
+	if (last == count)
+		return (SHAPE_SUFFIX);
+	return (SHAPE_INFIX);
+}
+
+/**
+ * @brief Find the shape of a compiled pattern.
+ *
+ * A pattern made of literal characters, with an optional '*' at either
+ * end, is matched by comparing its fixed text: `literal` is cut down to
+ * that text. Anything else (inner '*', '?', bracket sets) is general.
+ *
+ * @param p Compiled pattern (elements and literal already built)
+ */
+void	pattern_set_shape(t_pattern *p)
+{
+	size_t	first;
+	size_t	last;
+	size_t	i;
+
+	p->shape = SHAPE_GENERAL;
+	first = (p->count > 0 && p->elems[0].kind == PAT_STAR);
+	last = p->count;
+	if (last > first && p->elems[last - 1].kind == PAT_STAR)
+		last--;
+	i = first;
+	while (i < last && p->elems[i].kind == PAT_CHAR)
+		i++;
+	if (i < last)
+		return ;
+	p->fixed_len = last - first;
+	ft_memmove(p->literal, p->literal + first, p->fixed_len);
+	p->literal[p->fixed_len] = '\0';
+	p->shape = shape_of(first, last, p->count);
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:02:32 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:02:33 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,15 +16,17 @@
  * @brief Check if an operator type is a redirection.
  *
  * @param op_type The operator type to check.
- * @return true if it is OP_INPUT, OP_OUTPUT, OP_APPEND, or OP_HEREDOC;
- * false otherwise.
+ * @return true if it is OP_INPUT, OP_OUTPUT, OP_APPEND, OP_HEREDOC,
+ * OP_DUP_IN or OP_DUP_OUT; false otherwise.
  */
 bool	is_redir_operator(t_operator_type op_type)
 {
 	return (op_type == OP_INPUT
 		|| op_type == OP_OUTPUT
 		|| op_type == OP_APPEND
-		|| op_type == OP_HEREDOC);
+		|| op_type == OP_HEREDOC
+		|| op_type == OP_DUP_IN
+		|| op_type == OP_DUP_OUT);
 }
 
 /**
@@ -52,26 +54,16 @@ bool	has_redirections(t_token *start, t_token *end)
 /**
  * @brief Check if a token is a filename for a redirection.
  *
- * Scans the token range from start to end (excluded) to see if
- * `target` follows a redirection operator.
+ * The caller walks the token range and passes the token before `target`,
+ * so the check is constant time instead of a scan of the range.
  *
- * @param start Pointer to the first token in the range.
- * @param end Pointer to the token marking the end of the range (excluded).
+ * @param prev Token just before target in the range (NULL for the first)
  * @param target Token to check as a redirection target.
  * @return true if target is a redirection filename; false otherwise.
  */
-bool	is_redir_filename(t_token *start, t_token *end, t_token *target)
+bool	is_redir_filename(t_token *prev, t_token *target)
 {
-	t_token	*curr;
-
-	curr = start;
-	while (curr && curr != end)
-	{
-		if (is_redir_operator(curr->op_type) && curr->next == target)
-			return (true);
-		curr = curr->next;
-	}
-	return (false);
+	return (prev && prev->next == target && is_redir_operator(prev->op_type));
 }
 
 /**
@@ -88,13 +80,16 @@ int	count_command_words(t_token *start, t_token *end)
 {
 	int		count;
 	t_token	*curr;
+	t_token	*prev;
 
 	curr = start;
+	prev = NULL;
 	count = 0;
 	while (curr && curr != end)
 	{
-		if (curr->type == TOKEN_WORD && !is_redir_filename(start, end, curr))
+		if (curr->type == TOKEN_WORD && !is_redir_filename(prev, curr))
 			count++;
+		prev = curr;
 		curr = curr->next;
 	}
 	return (count);
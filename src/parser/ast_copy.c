@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_copy.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:58:56 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:30:29 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Duplicate a NULL-terminated array of strings.
+ *
+ * @param arr Array to copy
+ * @return The new array, or NULL on allocation failure
+ */
+char	**copy_strings_array(char **arr)
+{
+	char	**copy;
+	size_t	count;
+	size_t	i;
+
+	count = 0;
+	while (arr[count])
+		count++;
+	copy = malloc(sizeof(char *) * (count + 1));
+	if (!copy)
+		return (NULL);
+	i = 0;
+	while (i < count)
+	{
+		copy[i] = ft_strdup(arr[i]);
+		if (!copy[i])
+			return (free_string_array(copy, i), NULL);
+		i++;
+	}
+	copy[i] = NULL;
+	return (copy);
+}
+
+/**
+ * @brief Duplicate an optional string.
+ *
+ * @param str String to copy (may be NULL)
+ * @param copy Receives the copy, or NULL when str is NULL
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	copy_string(const char *str, char **copy)
+{
+	*copy = NULL;
+	if (!str)
+		return (0);
+	*copy = ft_strdup(str);
+	if (!*copy)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Copy the scalar and string fields of a node.
+ *
+ * The expanded `argv` is not copied: it is rebuilt from `words` on each
+ * execution, and `case` patterns are compiled again from `words`. A
+ * here-document keeps its content through a duplicated descriptor, marked
+ * close-on-exec so commands never inherit it.
+ *
+ * @param dst Zeroed destination node
+ * @param src Node to copy
+ * @return 0 on success, -1 on failure
+ */
+static int	copy_node_fields(t_ast *dst, t_ast *src)
+{
+	dst->type = src->type;
+	dst->op_type = src->op_type;
+	dst->in_shell = src->in_shell;
+	dst->heredoc_fd = -1;
+	if (copy_string(src->value, &dst->value) == -1
+		|| copy_string(src->filename, &dst->filename) == -1)
+		return (-1);
+	if (src->words)
+	{
+		dst->words = copy_strings_array(src->words);
+		if (!dst->words)
+			return (-1);
+	}
+	if (src->patterns && compile_case_patterns(dst) == -1)
+		return (-1);
+	if (src->heredoc_fd >= 0)
+	{
+		dst->heredoc_fd = fd_track(fcntl(src->heredoc_fd,
+					F_DUPFD_CLOEXEC, SHELL_FD_MIN));
+		if (dst->heredoc_fd == -1)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Copy a child subtree.
+ *
+ * @param src Subtree to copy (may be NULL)
+ * @param dst Receives the copy
+ * @return 0 on success, -1 on failure
+ */
+static int	copy_child(t_ast *src, t_ast **dst)
+{
+	*dst = NULL;
+	if (!src)
+		return (0);
+	*dst = copy_ast(src);
+	if (!*dst)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Deep copy an AST.
+ *
+ * Used to give a shell function its own body, independent from the line
+ * it was defined on, which is freed once executed.
+ *
+ * @param node Root of the tree to copy (may be NULL)
+ * @return The copy, or NULL on failure
+ */
+t_ast	*copy_ast(t_ast *node)
+{
+	t_ast	*copy;
+
+	if (!node)
+		return (NULL);
+	copy = ft_calloc(1, sizeof(t_ast));
+	if (!copy)
+		return (NULL);
+	if (copy_node_fields(copy, node) == -1
+		|| copy_child(node->left, &copy->left) == -1
+		|| copy_child(node->right, &copy->right) == -1
+		|| copy_child(node->next, &copy->next) == -1
+		|| copy_child(node->redirs, &copy->redirs) == -1)
+		return (free_ast(copy), NULL);
+	return (copy);
+}
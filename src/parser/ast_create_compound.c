@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_create_compound.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:12:35 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Allocate a zeroed AST node of the given type.
+ *
+ * All pointers start NULL and heredoc_fd is set to -1 so the node can be
+ * released with free_ast() at any point of its construction.
+ *
+ * @param type Node type to set.
+ * @return Pointer to the new node, or NULL on allocation failure.
+ */
+static t_ast	*new_ast_node(t_node_type type)
+{
+	t_ast	*node;
+
+	node = ft_calloc(1, sizeof(t_ast));
+	if (!node)
+		return (NULL);
+	node->type = type;
+	node->op_type = OP_NONE;
+	node->heredoc_fd = -1;
+	return (node);
+}
+
+/**
+ * @brief Create a command list node (`first ; rest`).
+ *
+ * @param left First command of the list.
+ * @param right Remaining commands of the list.
+ * @return Pointer to the new node, or NULL on allocation failure.
+ */
+t_ast	*create_list_node(t_ast *left, t_ast *right)
+{
+	t_ast	*node;
+
+	node = new_ast_node(NODE_LIST);
+	if (!node)
+		return (NULL);
+	node->left = left;
+	node->right = right;
+	return (node);
+}
+
+/**
+ * @brief Create a compound command node with two children.
+ *
+ * Used for `while` and `until` loops: left holds the condition list and
+ * right the loop body. A brace group only uses left.
+ *
+ * @param type NODE_WHILE, NODE_UNTIL, NODE_GROUP or NODE_ARITH.
+ * @param left Condition list.
+ * @param right Body list.
+ * @return Pointer to the new node, or NULL on allocation failure.
+ */
+t_ast	*create_compound_node(t_node_type type, t_ast *left, t_ast *right)
+{
+	t_ast	*node;
+
+	node = new_ast_node(type);
+	if (!node)
+		return (NULL);
+	node->left = left;
+	node->right = right;
+	return (node);
+}
+
+/**
+ * @brief Create a `for` loop node.
+ *
+ * The loop variable name is stored in `value`; the word list and the body
+ * are attached by the parser afterwards.
+ *
+ * @param name Name of the loop variable.
+ * @return Pointer to the new node, or NULL on allocation failure.
+ */
+t_ast	*create_for_node(const char *name)
+{
+	t_ast	*node;
+
+	node = new_ast_node(NODE_FOR);
+	if (!node)
+		return (NULL);
+	node->value = ft_strdup(name);
+	if (!node->value)
+		return (free(node), NULL);
+	return (node);
+}
+
+/**
+ * @brief Create a function definition node.
+ *
+ * @param name Function name (copied into `value`).
+ * @param body Parsed body, attached as the left child.
+ * @return Pointer to the new node, or NULL on allocation failure (the body
+ *         is left to the caller).
+ */
+t_ast	*create_function_node(const char *name, t_ast *body)
+{
+	t_ast	*node;
+
+	node = new_ast_node(NODE_FUNCTION);
+	if (!node)
+		return (NULL);
+	node->value = ft_strdup(name);
+	if (!node->value)
+		return (free(node), NULL);
+	node->left = body;
+	return (node);
+}
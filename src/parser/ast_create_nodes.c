@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:03:16 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:03:21 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 04:30:29 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,25 +26,26 @@
 char	**collect_argv(t_token *start, t_token *end)
 {
 	int		i;
-	int		count;
 	char	**argv;
 	t_token	*curr;
+	t_token	*prev;
 
-	count = count_command_words(start, end);
-	argv = malloc(sizeof (char *) * (count + 1));
+	argv = malloc(sizeof (char *) * (count_command_words(start, end) + 1));
 	if (!argv)
 		return (NULL);
 	i = 0;
 	curr = start;
+	prev = NULL;
 	while (curr && curr != end)
 	{
-		if (curr->type == TOKEN_WORD && !is_redir_filename(start, end, curr))
+		if (curr->type == TOKEN_WORD && !is_redir_filename(prev, curr))
 		{
 			argv[i] = ft_strdup(curr->value);
 			if (!argv[i])
 				return (free_strings_array(argv), NULL);
 			i++;
 		}
+		prev = curr;
 		curr = curr->next;
 	}
 	argv[i] = NULL;
@@ -95,7 +96,9 @@ t_ast	*collect_redirections(t_token *start, t_token *end)
  * @brief Create a single redirection AST node.
  *
  * Uses an operator token and a filename token to initialize an AST
- * node of type NODE_REDIR.
+ * node of type NODE_REDIR. A here-document already read with its line
+ * gets its own descriptor on the store: the node may be discarded with
+ * an unfinished parse while the token keeps the body.
  *
  * @param op_token Token representing the redirection operator.
  * @param file_token Token representing the filename for redirection.
@@ -105,7 +108,7 @@ t_ast	*create_redir_node(t_token *op_token, t_token *file_token)
 {
 	t_ast	*node;
 
-	node = malloc(sizeof(t_ast));
+	node = ft_calloc(1, sizeof(t_ast));
 	if (!node)
 		return (NULL);
 	node->type = NODE_REDIR;
@@ -113,14 +116,15 @@ t_ast	*create_redir_node(t_token *op_token, t_token *file_token)
 	node->value = ft_strdup(op_token->value);
 	if (!node->value)
 		return (free(node), NULL);
-	node->argv = NULL;
 	node->filename = ft_strdup(file_token->value);
 	if (!node->filename)
 		return (free(node->value), free(node), NULL);
 	node->heredoc_fd = -1;
-	node->left = NULL;
-	node->right = NULL;
-	node->next = NULL;
+	if (op_token->heredoc_fd >= 0)
+		node->heredoc_fd = fd_track(fcntl(op_token->heredoc_fd,
+					F_DUPFD_CLOEXEC, SHELL_FD_MIN));
+	if (op_token->heredoc_fd >= 0 && node->heredoc_fd == -1)
+		return (free(node->filename), free(node->value), free(node), NULL);
 	return (node);
 }
 
@@ -128,6 +132,8 @@ t_ast	*create_redir_node(t_token *op_token, t_token *file_token)
  * @brief Create a command AST node.
  *
  * Initializes an AST node of type NODE_CMD using the provided argv array.
+ * The array is stored as the raw `words` of the command; `argv` is only
+ * filled with their expansion right before each execution.
  *
  * @param argv NULL-terminated array of argument strings (argv[0] is the
  *             command name).
@@ -145,12 +151,16 @@ t_ast	*create_cmd_node(char **argv)
 	node->value = ft_strdup(argv[0]);
 	if (!node->value)
 		return (free(node), NULL);
-	node->argv = argv;
+	node->argv = NULL;
+	node->words = argv;
 	node->filename = NULL;
 	node->heredoc_fd = -1;
 	node->left = NULL;
 	node->right = NULL;
 	node->next = NULL;
+	node->redirs = NULL;
+	node->patterns = NULL;
+	node->in_shell = false;
 	return (node);
 }
 
@@ -177,10 +187,14 @@ t_ast	*create_pipe_node(t_ast *left, t_ast *right)
 	if (!node->value)
 		return (free(node), NULL);
 	node->argv = NULL;
+	node->words = NULL;
 	node->filename = NULL;
 	node->heredoc_fd = -1;
 	node->left = left;
 	node->right = right;
 	node->next = NULL;
+	node->redirs = NULL;
+	node->patterns = NULL;
+	node->in_shell = false;
 	return (node);
 }
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:03:33 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:21:05 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:41:22 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,7 +18,8 @@
  * Frees the following fields if they are not NULL:
  *  - value
  *  - filename
- *  - argv (via free_strings_array)
+ *  - argv and words (via free_strings_array)
+ *  - compiled `case` patterns
  *
  * @param node Pointer to the AST node whose strings will be freed.
  */
@@ -30,6 +31,10 @@ void	cleanup_node(t_ast *node)
 		free(node->filename);
 	if (node->argv)
 		free_strings_array(node->argv);
+	if (node->patterns)
+		free_case_patterns(node);
+	if (node->words)
+		free_strings_array(node->words);
 	if (node->heredoc_fd >= 0)
 		close_fds(&node->heredoc_fd);
 }
@@ -38,36 +43,21 @@ void	cleanup_node(t_ast *node)
  * @brief Recursively free an entire AST.
  *
  * Frees all nodes in the AST including:
- *  - left and right subtrees
- *  - right-linked redirection nodes for commands
- *  - all strings in each node via free_strings_in_node
+ *  - left and right subtrees (pipes, lists, loops, command redirections)
+ *  - the `next` chain of redirection nodes
+ *  - redirections attached to compound commands
+ *  - all strings in each node via cleanup_node
  *
  * @param node Pointer to the root AST node to free.
  */
 void	free_ast(t_ast *node)
 {
-	t_ast	*curr;
-	t_ast	*next;
-
 	if (!node)
 		return ;
-	if (node->left)
-		free_ast(node->left);
-	if (node->type == NODE_PIPE)
-	{
-		if (node->right)
-			free_ast(node->right);
-	}
-	else if (node->type == NODE_CMD)
-	{
-		curr = node->right;
-		while (curr)
-		{
-			next = curr->next;
-			free_ast(curr);
-			curr = next;
-		}
-	}
+	free_ast(node->left);
+	free_ast(node->right);
+	free_ast(node->next);
+	free_ast(node->redirs);
 	cleanup_node(node);
 	free(node);
 }
@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ast_optimize.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:28:16 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:30:29 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check that a word names the same file before and after expansion.
+ *
+ * Only characters that no expansion, quote removal or globbing touches
+ * are accepted, and the word may not look like an option (`-n`) or be
+ * `-` (standard input for cat).
+ *
+ * @param word Raw word of the command
+ * @return true if the word is a plain file name
+ */
+static bool	is_plain_file_word(const char *word)
+{
+	size_t	i;
+
+	if (!word || !word[0] || word[0] == '-')
+		return (false);
+	i = 0;
+	while (word[i])
+	{
+		if (!ft_isalnum(word[i]) && !ft_strchr(OPT_PLAIN_CHARS, word[i]))
+			return (false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Check whether a command is exactly `cat FILE` with a plain FILE.
+ *
+ * @param cmd Left side of a pipe
+ * @return true if the command only copies FILE to its output
+ */
+static bool	is_useless_cat(t_ast *cmd)
+{
+	if (!cmd || cmd->type != NODE_CMD || cmd->right || !cmd->words)
+		return (false);
+	if (!cmd->words[0] || ft_strcmp(cmd->words[0], "cat") != 0)
+		return (false);
+	if (!is_plain_file_word(cmd->words[1]) || cmd->words[2])
+		return (false);
+	return (true);
+}
+
+/**
+ * @brief Record the file of a `cat FILE | cmd` pipe in the pipe node.
+ *
+ * The pipe itself is kept: when FILE cannot be used at run time the
+ * pipeline falls back to running cat, so errors stay those of cat.
+ *
+ * @param node Pipe node
+ * @param debug Whether to report the rewrite
+ */
+static void	optimize_pipe(t_ast *node, bool debug)
+{
+	if (node->filename || !is_useless_cat(node->left))
+		return ;
+	node->filename = ft_strdup(node->left->words[1]);
+	if (node->filename && debug)
+		print_error(ERR_PREFIX, "optimize: reading ", node->filename,
+			" directly instead of through cat");
+}
+
+/**
+ * @brief Walk the commands of a tree and apply the rewrites.
+ *
+ * Redirections of commands are not walked: a redirection node reached
+ * here is a command made only of redirections, marked to run in the
+ * shell process instead of a child.
+ *
+ * @param node Subtree to optimize
+ * @param debug Whether to report the rewrites
+ */
+static void	optimize_node(t_ast *node, bool debug)
+{
+	while (node && node->type != NODE_CMD)
+	{
+		if (node->type == NODE_REDIR)
+		{
+			node->in_shell = true;
+			if (debug)
+				print_error(ERR_PREFIX, "optimize: redirections only, ",
+					"run in the shell", NULL);
+			return ;
+		}
+		if (node->type == NODE_PIPE)
+			optimize_pipe(node, debug);
+		optimize_node(node->left, debug);
+		optimize_node(node->next, debug);
+		node = node->right;
+	}
+}
+
+/**
+ * @brief Optimizer pass run between parsing and execution.
+ *
+ * `cat FILE | cmd` is marked so that `cmd` reads FILE directly, saving a
+ * fork, an exec and a copy through the pipe; commands made only of
+ * redirections are run by the shell itself (see execute_redirect_only()).
+ * Setting OPT_DEBUG_VAR reports each rewrite on standard error; setting
+ * OPT_DISABLE_VAR turns the pass off, to compare with the plain run.
+ *
+ * @param ast Parsed command line
+ * @param data Shell state structure
+ */
+void	optimize_ast(t_ast *ast, t_shell *data)
+{
+	t_env	*env;
+
+	env = get_env_node_by_key(data->env_list, OPT_DISABLE_VAR);
+	if (env && env->value && env->value[0])
+		return ;
+	env = get_env_node_by_key(data->env_list, OPT_DEBUG_VAR);
+	optimize_node(ast, env && env->value && env->value[0]);
+}
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   case_patterns.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:35:24 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:35:24 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Compile the patterns of a case item, when the AST is built.
+ *
+ * A pattern without '$' does not depend on the shell state: its quotes
+ * are removed (quoted wildcards escaped) and it is compiled once, so a
+ * case inside a loop does not parse it again. A pattern with an
+ * expansion is left uncompiled (NULL elements) and compiled at each run.
+ *
+ * @param item NODE_CASE_ITEM node (words: raw patterns)
+ * @return 0 on success, -1 on allocation failure
+ */
+int	compile_case_patterns(t_ast *item)
+{
+	char	*pattern;
+	size_t	count;
+	size_t	i;
+
+	count = 0;
+	while (item->words[count])
+		count++;
+	item->patterns = ft_calloc(count + 1, sizeof(t_pattern));
+	if (!item->patterns)
+		return (-1);
+	i = 0;
+	while (i < count)
+	{
+		if (!ft_strchr(item->words[i], '$'))
+		{
+			pattern = expand_pattern(item->words[i], NULL);
+			if (!pattern || pattern_compile(pattern, ft_strlen(pattern),
+					&item->patterns[i]) == -1)
+				return (free(pattern), -1);
+			free(pattern);
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Release the compiled patterns of a case item.
+ *
+ * @param item NODE_CASE_ITEM node (its words are still allocated)
+ */
+void	free_case_patterns(t_ast *item)
+{
+	size_t	i;
+
+	i = 0;
+	while (item->words && item->words[i])
+		pattern_free(&item->patterns[i++]);
+	free(item->patterns);
+	item->patterns = NULL;
+}
@@ -6,17 +6,49 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:04:47 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:05:15 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
+/**
+ * @brief Get the type of a redirection operator.
+ *
+ * The fd digit a redirection may start with does not change its type.
+ *
+ * @param token The token string to analyze.
+ * @return t_operator_type Enum value for the redirection type,
+ *         or OP_NONE if not a redirection.
+ */
+static int	get_redir_type(char *token)
+{
+	if (ft_isdigit(*token) && (token[1] == '<' || token[1] == '>'))
+		token++;
+	if (*token != '<' && *token != '>')
+		return (OP_NONE);
+	if (token[1] == '\0' && *token == '<')
+		return (OP_INPUT);
+	if (token[1] == '\0')
+		return (OP_OUTPUT);
+	if (token[2] != '\0')
+		return (OP_NONE);
+	if (*token == '<' && token[1] == '<')
+		return (OP_HEREDOC);
+	if (*token == '>' && token[1] == '>')
+		return (OP_APPEND);
+	if (*token == '<' && token[1] == '&')
+		return (OP_DUP_IN);
+	if (*token == '>' && token[1] == '&')
+		return (OP_DUP_OUT);
+	return (OP_NONE);
+}
+
 /**
  * @brief Get the operator type of a token.
  *
  * Determines if a given token is an operator
- * (pipe, redirection, heredoc, etc.).
+ * (pipe, redirection, heredoc, command separator, etc.).
  *
  * @param token The token string to analyze.
  * @return t_operator_type Enum value for the operator type,
@@ -28,22 +60,23 @@ int	get_operator_type(char *token)
 		return (OP_NONE);
 	if (*token == '|' && token[1] == '\0')
 		return (OP_PIPE);
-	if (*token == '<' && token[1] == '\0')
-		return (OP_INPUT);
-	if (*token == '>' && token[1] == '\0')
-		return (OP_OUTPUT);
-	if (*token == '<' && token[1] == '<' && token[2] == '\0')
-		return (OP_HEREDOC);
-	if (*token == '>' && token[1] == '>' && token[2] == '\0')
-		return (OP_APPEND);
-	return (OP_NONE);
+	if ((*token == ';' || *token == '\n') && token[1] == '\0')
+		return (OP_SEMI);
+	if (*token == '(' && token[1] == '\0')
+		return (OP_LPAREN);
+	if (*token == ')' && token[1] == '\0')
+		return (OP_RPAREN);
+	if (*token == ';' && token[1] == ';' && token[2] == '\0')
+		return (OP_DSEMI);
+	return (get_redir_type(token));
 }
 
 /**
  * @brief Free a linked list of tokens.
  *
  * Iterates through the list, freeing each token's
- * string value and the token node itself.
+ * string value, closing its here-document store if it has one, and
+ * freeing the token node itself.
  *
  * @param list Pointer to the head of the token list.
  */
@@ -57,6 +90,7 @@ void	free_tokens_list(t_token *list)
 		list = list->next;
 		if (current->value)
 			free(current->value);
+		close_fds(&current->heredoc_fd);
 		free(current);
 	}
 }
@@ -80,6 +114,7 @@ static t_token	*new_token_node(char *token)
 	if (!new)
 		return (NULL);
 	new->next = NULL;
+	new->heredoc_fd = -1;
 	new->value = ft_strdup(token);
 	if (!new->value)
 	{
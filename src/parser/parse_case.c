@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_case.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:35:24 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:35:24 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Copy the pattern words of a case item, skipping the '|' between.
+ *
+ * @param start First pattern token
+ * @param count Number of patterns
+ * @return NULL-terminated word array, or NULL on allocation failure
+ */
+static char	**collect_patterns(t_token *start, size_t count)
+{
+	char	**words;
+	size_t	i;
+
+	words = malloc(sizeof(char *) * (count + 1));
+	if (!words)
+		return (NULL);
+	i = 0;
+	while (i < count)
+	{
+		words[i] = ft_strdup(start->value);
+		if (!words[i])
+			return (free_string_array(words, i), NULL);
+		start = start->next->next;
+		i++;
+	}
+	words[i] = NULL;
+	return (words);
+}
+
+/**
+ * @brief Parse the pattern list of a case item: `[(] pat [| pat]... )`.
+ *
+ * @param p Parser state, positioned on the item
+ * @return NULL-terminated raw pattern words, or NULL on error
+ */
+static char	**parse_case_patterns(t_parser *p)
+{
+	t_token	*start;
+	size_t	count;
+	char	**words;
+
+	if (p->curr && p->curr->op_type == OP_LPAREN)
+		p->curr = p->curr->next;
+	start = p->curr;
+	count = 1;
+	while (p->curr && p->curr->type == TOKEN_WORD && p->curr->next
+		&& p->curr->next->op_type == OP_PIPE)
+	{
+		p->curr = p->curr->next->next;
+		count++;
+	}
+	if (!p->curr || p->curr->type != TOKEN_WORD)
+		return (parser_error(p, p->curr), NULL);
+	p->curr = p->curr->next;
+	if (!p->curr || p->curr->op_type != OP_RPAREN)
+		return (parser_error(p, p->curr), NULL);
+	p->curr = p->curr->next;
+	words = collect_patterns(start, count);
+	if (!words)
+		p->status = PARSE_MALLOC_ERROR;
+	return (words);
+}
+
+/**
+ * @brief Parse one case item: patterns, then a list up to ";;" or `esac`.
+ *
+ * Patterns are compiled here, once, unless they need an expansion.
+ *
+ * @param p Parser state, positioned on the item
+ * @return NODE_CASE_ITEM node (words: patterns, right: list), or NULL on
+ *         error
+ */
+static t_ast	*parse_case_item(t_parser *p)
+{
+	static const char	*esac_kw[] = {"esac", NULL};
+	t_ast				*item;
+	char				**words;
+
+	words = parse_case_patterns(p);
+	if (!words)
+		return (NULL);
+	item = create_compound_node(NODE_CASE_ITEM, NULL, NULL);
+	if (item)
+		item->words = words;
+	if (!item || compile_case_patterns(item) == -1)
+	{
+		p->status = PARSE_MALLOC_ERROR;
+		if (!item)
+			free_strings_array(words);
+		return (free_ast(item), NULL);
+	}
+	item->right = parse_list(p, esac_kw);
+	if (p->status != PARSE_OK)
+		return (free_ast(item), NULL);
+	return (item);
+}
+
+/**
+ * @brief Parse the items of a case command, up to and including `esac`.
+ *
+ * The last item may end with `esac` directly, without ";;".
+ *
+ * @param p Parser state, positioned after `in`
+ * @param node NODE_CASE node receiving the items, chained through `next`
+ * @return true on success, false on error
+ */
+static bool	parse_case_items(t_parser *p, t_ast *node)
+{
+	t_ast	**last;
+
+	last = &node->left;
+	skip_separators(p, true);
+	while (p->curr && !is_keyword(p->curr, "esac"))
+	{
+		*last = parse_case_item(p);
+		if (!*last)
+			return (false);
+		last = &(*last)->next;
+		if (p->curr && p->curr->op_type == OP_DSEMI)
+			p->curr = p->curr->next;
+		else if (!is_keyword(p->curr, "esac"))
+			return (parser_error(p, p->curr), false);
+		skip_separators(p, true);
+	}
+	return (expect_keyword(p, "esac"));
+}
+
+/**
+ * @brief Parse `case word in [pattern) list ;;]... esac`.
+ *
+ * @param p Parser state, positioned on the `case` keyword
+ * @return NODE_CASE node (value: raw word, left: first item), or NULL on
+ *         error
+ */
+t_ast	*parse_case(t_parser *p)
+{
+	t_ast	*node;
+
+	p->curr = p->curr->next;
+	if (!p->curr || p->curr->type != TOKEN_WORD)
+		return (parser_error(p, p->curr));
+	node = create_compound_node(NODE_CASE, NULL, NULL);
+	if (node)
+		node->value = ft_strdup(p->curr->value);
+	if (!node || !node->value)
+	{
+		p->status = PARSE_MALLOC_ERROR;
+		return (free_ast(node), NULL);
+	}
+	p->curr = p->curr->next;
+	skip_separators(p, true);
+	if (!expect_keyword(p, "in") || !parse_case_items(p, node))
+		return (free_ast(node), NULL);
+	return (parse_redirect_suffix(p, node));
+}
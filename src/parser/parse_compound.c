@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_compound.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:12:35 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Attach the redirections following a compound command.
+ *
+ * In `while ...; done < file` the redirections apply to the whole loop.
+ * They are stored in the node's `redirs` list and applied once per
+ * execution of the loop, not once per iteration.
+ *
+ * @param p Parser state
+ * @param node Compound command node (freed on failure)
+ * @return The node, or NULL on allocation failure
+ */
+t_ast	*parse_redirect_suffix(t_parser *p, t_ast *node)
+{
+	t_token	*start;
+
+	start = p->curr;
+	while (p->curr && is_redir_operator(p->curr->op_type) && p->curr->next)
+		p->curr = p->curr->next->next;
+	if (start == p->curr)
+		return (node);
+	node->redirs = collect_redirections(start, p->curr);
+	if (!node->redirs)
+	{
+		p->status = PARSE_MALLOC_ERROR;
+		return (free_ast(node), NULL);
+	}
+	return (node);
+}
+
+/**
+ * @brief Parse an arithmetic command `(( expression ))`.
+ *
+ * The tokenizer keeps the whole `(( ... ))` group in one word, so the
+ * expression is simply the text between the double parentheses.
+ *
+ * @param p Parser state, positioned on the word starting with "(("
+ * @return NODE_ARITH node (value: expression), or NULL on error
+ */
+t_ast	*parse_arith_command(t_parser *p)
+{
+	t_ast	*node;
+	char	*word;
+	size_t	len;
+
+	word = p->curr->value;
+	len = ft_strlen(word);
+	if (len < 4 || word[len - 1] != ')' || word[len - 2] != ')')
+		return (parser_error(p, p->curr));
+	node = create_compound_node(NODE_ARITH, NULL, NULL);
+	if (node)
+		node->value = ft_substr(word, 2, len - 4);
+	if (!node || !node->value)
+	{
+		p->status = PARSE_MALLOC_ERROR;
+		return (free_ast(node), NULL);
+	}
+	p->curr = p->curr->next;
+	return (parse_redirect_suffix(p, node));
+}
+
+/**
+ * @brief Parse a loop body: `do list done`.
+ *
+ * Separators before `do` are skipped, so `for i in a b\ndo` is accepted.
+ *
+ * @param p Parser state
+ * @return Body list, or NULL on error (status set in the parser)
+ */
+t_ast	*parse_do_group(t_parser *p)
+{
+	static const char	*done_kw[] = {"done", NULL};
+	t_ast				*body;
+
+	skip_separators(p, false);
+	if (!expect_keyword(p, "do"))
+		return (NULL);
+	body = parse_list(p, done_kw);
+	if (!body)
+		return (parser_error(p, p->curr));
+	if (!expect_keyword(p, "done"))
+		return (free_ast(body), NULL);
+	return (body);
+}
+
+/**
+ * @brief Parse `while list; do list; done` or the `until` equivalent.
+ *
+ * @param p Parser state, positioned on the `while`/`until` keyword
+ * @param type NODE_WHILE or NODE_UNTIL
+ * @return Loop node, or NULL on error
+ */
+t_ast	*parse_loop(t_parser *p, t_node_type type)
+{
+	static const char	*do_kw[] = {"do", NULL};
+	t_ast				*cond;
+	t_ast				*body;
+	t_ast				*node;
+
+	p->curr = p->curr->next;
+	cond = parse_list(p, do_kw);
+	if (!cond)
+		return (parser_error(p, p->curr));
+	body = parse_do_group(p);
+	if (!body)
+		return (free_ast(cond), NULL);
+	node = create_compound_node(type, cond, body);
+	if (!node)
+	{
+		p->status = PARSE_MALLOC_ERROR;
+		return (free_ast(cond), free_ast(body), NULL);
+	}
+	return (parse_redirect_suffix(p, node));
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_for.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 01:55:40 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Collect the raw words of `for name in words`.
+ *
+ * The word list ends at the first ';' or newline. Any other operator
+ * there is a syntax error.
+ *
+ * @param p Parser state, positioned after the `in` keyword
+ * @return NULL-terminated word array (possibly empty), or NULL on error
+ */
+static char	**collect_for_words(t_parser *p)
+{
+	t_token	*end;
+	char	**words;
+
+	end = p->curr;
+	while (end && end->type == TOKEN_WORD)
+		end = end->next;
+	if (end && end->op_type != OP_SEMI)
+	{
+		parser_error(p, end);
+		return (NULL);
+	}
+	words = collect_argv(p->curr, end);
+	if (!words)
+		p->status = PARSE_MALLOC_ERROR;
+	p->curr = end;
+	return (words);
+}
+
+/**
+ * @brief Parse the head of a for loop: `for name [in words]`.
+ *
+ * Without `in`, `words` stays NULL and the loop iterates over the
+ * positional parameters.
+ *
+ * @param p Parser state, positioned on the `for` keyword
+ * @return For node without body, or NULL on error
+ */
+static t_ast	*parse_for_head(t_parser *p)
+{
+	t_ast	*node;
+
+	p->curr = p->curr->next;
+	if (!p->curr || p->curr->type != TOKEN_WORD
+		|| !is_valid_key(p->curr->value) || ft_strchr(p->curr->value, '=')
+		|| ft_strchr(p->curr->value, '+'))
+		return (parser_error(p, p->curr));
+	node = create_for_node(p->curr->value);
+	if (!node)
+	{
+		p->status = PARSE_MALLOC_ERROR;
+		return (NULL);
+	}
+	p->curr = p->curr->next;
+	if (is_keyword(p->curr, "in"))
+	{
+		p->curr = p->curr->next;
+		node->words = collect_for_words(p);
+		if (!node->words)
+			return (free_ast(node), NULL);
+	}
+	return (node);
+}
+
+/**
+ * @brief Parse `for name [in words]; do list; done`.
+ *
+ * @param p Parser state, positioned on the `for` keyword
+ * @return Loop node, or NULL on error
+ */
+t_ast	*parse_for(t_parser *p)
+{
+	t_ast	*node;
+	t_ast	*body;
+
+	node = parse_for_head(p);
+	if (!node)
+		return (NULL);
+	body = parse_do_group(p);
+	if (!body)
+		return (free_ast(node), NULL);
+	node->right = body;
+	return (parse_redirect_suffix(p, node));
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_function.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:58:36 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 01:58:36 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if the cursor is on a function definition: `name ( )`.
+ *
+ * Only the unquoted word followed by '(' is looked at; a missing ')' is
+ * reported later by parse_function().
+ *
+ * @param p Parser state
+ * @return true if a function definition starts at the cursor
+ */
+bool	is_function_definition(t_parser *p)
+{
+	return (p->curr && p->curr->type == TOKEN_WORD
+		&& p->curr->next && p->curr->next->op_type == OP_LPAREN);
+}
+
+/**
+ * @brief Parse a brace group: `{ list; }`.
+ *
+ * The group runs in the current shell; it is mostly used as a function
+ * body. Its trailing redirections apply to the whole group.
+ *
+ * @param p Parser state, positioned on the `{` reserved word
+ * @return NODE_GROUP node (left: list), or NULL on error
+ */
+t_ast	*parse_group(t_parser *p)
+{
+	static const char	*close_kw[] = {"}", NULL};
+	t_ast				*body;
+	t_ast				*node;
+
+	p->curr = p->curr->next;
+	body = parse_list(p, close_kw);
+	if (!body)
+		return (parser_error(p, p->curr));
+	if (!expect_keyword(p, "}"))
+		return (free_ast(body), NULL);
+	node = create_compound_node(NODE_GROUP, body, NULL);
+	if (!node)
+	{
+		p->status = PARSE_MALLOC_ERROR;
+		return (free_ast(body), NULL);
+	}
+	return (parse_redirect_suffix(p, node));
+}
+
+/**
+ * @brief Check that the token can start a function body.
+ *
+ * Like in bash, the body must be a compound command: a brace group or
+ * a loop.
+ *
+ * @param tok Token following `name ()` and optional newlines
+ * @return true if the token starts a compound command
+ */
+static bool	is_compound_start(t_token *tok)
+{
+	return (is_keyword(tok, "{") || is_keyword(tok, "while")
+		|| is_keyword(tok, "until") || is_keyword(tok, "for"));
+}
+
+/**
+ * @brief Parse `name () compound-command`.
+ *
+ * The body is parsed once, here; defining the function at run time only
+ * copies this subtree into the function table.
+ *
+ * @param p Parser state, positioned on the function name
+ * @return NODE_FUNCTION node (value: name, left: body), or NULL on error
+ */
+t_ast	*parse_function(t_parser *p)
+{
+	t_token	*name;
+	t_ast	*body;
+	t_ast	*node;
+
+	name = p->curr;
+	if (!is_valid_key(name->value) || ft_strchr(name->value, '=')
+		|| ft_strchr(name->value, '+'))
+		return (parser_error(p, name->next));
+	p->curr = name->next->next;
+	if (!p->curr || p->curr->op_type != OP_RPAREN)
+		return (parser_error(p, p->curr));
+	p->curr = p->curr->next;
+	skip_separators(p, true);
+	if (!p->curr || !is_compound_start(p->curr))
+		return (parser_error(p, p->curr));
+	body = parse_command(p);
+	if (!body)
+		return (NULL);
+	node = create_function_node(name->value, body);
+	if (!node)
+	{
+		p->status = PARSE_MALLOC_ERROR;
+		return (free_ast(body), NULL);
+	}
+	return (node);
+}
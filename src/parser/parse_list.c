@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_list.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:41:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if the cursor reached the end of the current list.
+ *
+ * A list ends at the end of input, at ";;" (end of a `case` item) or at
+ * one of the reserved words that closes the enclosing compound command
+ * (e.g. "do" after a loop condition, "done" after a loop body).
+ *
+ * @param p Parser state
+ * @param stops NULL-terminated reserved words closing the list (may be NULL)
+ * @return true if the list is finished, false otherwise
+ */
+static bool	at_list_end(t_parser *p, const char **stops)
+{
+	int	i;
+
+	if (!p->curr || p->curr->op_type == OP_DSEMI)
+		return (true);
+	i = 0;
+	while (stops && stops[i])
+	{
+		if (is_keyword(p->curr, stops[i]))
+			return (true);
+		i++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Parse a simple command up to the next non-redirection operator.
+ *
+ * Delegates node construction to build_simple_command() on the token
+ * range, then moves the cursor to the end of that range.
+ *
+ * @param p Parser state
+ * @return Command (or redirection) node, or NULL on allocation failure
+ */
+static t_ast	*parse_simple_command(t_parser *p)
+{
+	t_token	*end;
+	t_ast	*node;
+
+	end = p->curr;
+	while (end && (end->type == TOKEN_WORD || is_redir_operator(end->op_type)))
+		end = end->next;
+	node = build_simple_command(p->curr, end);
+	if (!node)
+		p->status = PARSE_MALLOC_ERROR;
+	p->curr = end;
+	return (node);
+}
+
+/**
+ * @brief Parse a single command: a compound command or a simple one.
+ *
+ * Reserved words are only recognized here, in command position, so that
+ * `echo done` still prints "done". A word followed by '(' starts a
+ * function definition.
+ *
+ * @param p Parser state
+ * @return Command node, or NULL on error (status set in the parser)
+ */
+t_ast	*parse_command(t_parser *p)
+{
+	if (!p->curr)
+		return (parser_error(p, NULL));
+	if (is_keyword(p->curr, "while"))
+		return (parse_loop(p, NODE_WHILE));
+	if (is_keyword(p->curr, "until"))
+		return (parse_loop(p, NODE_UNTIL));
+	if (is_keyword(p->curr, "for"))
+		return (parse_for(p));
+	if (is_keyword(p->curr, "{"))
+		return (parse_group(p));
+	if (is_keyword(p->curr, "case"))
+		return (parse_case(p));
+	if (p->curr->type == TOKEN_WORD && !ft_strncmp(p->curr->value, "((", 2))
+		return (parse_arith_command(p));
+	if (is_reserved_word(p->curr))
+		return (parser_error(p, p->curr));
+	if (is_function_definition(p))
+		return (parse_function(p));
+	if (p->curr->type == TOKEN_OPERATOR
+		&& !is_redir_operator(p->curr->op_type))
+		return (parser_error(p, p->curr));
+	return (parse_simple_command(p));
+}
+
+/**
+ * @brief Parse commands joined by pipes.
+ *
+ * Builds the same right-leaning NODE_PIPE chain as before: the left child
+ * is the first command, the right child the rest of the pipeline.
+ * Newlines are allowed right after a pipe.
+ *
+ * @param p Parser state
+ * @return Pipeline root, or NULL on error
+ */
+t_ast	*parse_pipeline(t_parser *p)
+{
+	t_ast	*left;
+	t_ast	*right;
+	t_ast	*pipe_node;
+
+	left = parse_command(p);
+	if (!left || !p->curr || p->curr->op_type != OP_PIPE)
+		return (left);
+	p->curr = p->curr->next;
+	skip_separators(p, true);
+	right = parse_pipeline(p);
+	if (!right)
+		return (free_ast(left), NULL);
+	pipe_node = create_pipe_node(left, right);
+	if (!pipe_node)
+	{
+		p->status = PARSE_MALLOC_ERROR;
+		return (free_ast(left), free_ast(right), NULL);
+	}
+	return (pipe_node);
+}
+
+/**
+ * @brief Parse a list of pipelines separated by ';' or newlines.
+ *
+ * The list stops at the end of input or at one of the `stops` reserved
+ * words, which is left for the caller to consume. Several commands are
+ * chained as NODE_LIST nodes (left: first command, right: the rest).
+ *
+ * @param p Parser state
+ * @param stops NULL-terminated reserved words closing the list (may be NULL)
+ * @return List root, NULL if the list is empty or on error (check status)
+ */
+t_ast	*parse_list(t_parser *p, const char **stops)
+{
+	t_ast	*first;
+	t_ast	*rest;
+	t_ast	*list;
+
+	skip_separators(p, true);
+	if (at_list_end(p, stops))
+		return (NULL);
+	first = parse_pipeline(p);
+	if (!first)
+		return (NULL);
+	if (p->curr && p->curr->op_type != OP_SEMI && p->curr->op_type != OP_DSEMI)
+		return (free_ast(first), parser_error(p, p->curr));
+	skip_separators(p, false);
+	if (at_list_end(p, stops))
+		return (first);
+	rest = parse_list(p, stops);
+	if (!rest)
+		return (free_ast(first), NULL);
+	list = create_list_node(first, rest);
+	if (!list)
+	{
+		p->status = PARSE_MALLOC_ERROR;
+		return (free_ast(first), free_ast(rest), NULL);
+	}
+	return (list);
+}
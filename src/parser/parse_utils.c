@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:55:40 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:41:22 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Check if a token is the given unquoted reserved word.
+ *
+ * Reserved words are only meaningful as plain TOKEN_WORD tokens: a quoted
+ * "done" keeps its quotes at this stage and never matches.
+ *
+ * @param tok Token to check (may be NULL)
+ * @param keyword Reserved word to compare with (e.g. "do")
+ * @return true if the token is exactly that word, false otherwise
+ */
+bool	is_keyword(t_token *tok, const char *keyword)
+{
+	return (tok && tok->type == TOKEN_WORD
+		&& ft_strcmp(tok->value, keyword) == 0);
+}
+
+/**
+ * @brief Check if a token is a reserved word that cannot start a command.
+ *
+ * Words such as "do", "done", "esac" or "}" close a compound command.
+ * Found where a command is expected, they are a syntax error.
+ *
+ * @param tok Token to check (may be NULL)
+ * @return true if the token is a closing reserved word, false otherwise
+ */
+bool	is_reserved_word(t_token *tok)
+{
+	return (is_keyword(tok, "do") || is_keyword(tok, "done")
+		|| is_keyword(tok, "esac") || is_keyword(tok, "}"));
+}
+
+/**
+ * @brief Skip the separator ending a command: one ';' and/or newlines.
+ *
+ * Only a single ';' is accepted, so `cmd ;; cmd` or a leading ';' are
+ * left for parse_command() to report as syntax errors. With
+ * `newlines_only`, no ';' is consumed at all (start of a list).
+ *
+ * @param p Parser state, advanced past the separators
+ * @param newlines_only true to skip empty lines only
+ */
+void	skip_separators(t_parser *p, bool newlines_only)
+{
+	if (!newlines_only && p->curr && p->curr->op_type == OP_SEMI)
+		p->curr = p->curr->next;
+	while (p->curr && p->curr->op_type == OP_SEMI && p->curr->value[0] == '\n')
+		p->curr = p->curr->next;
+}
+
+/**
+ * @brief Record a parse failure at the given token.
+ *
+ * Running out of tokens means the command is not finished yet (e.g. a
+ * `while` still waiting for its `done`): the status becomes
+ * PARSE_INCOMPLETE so the caller can read another line. Any other token
+ * is a syntax error, reported like bash does. The first failure wins.
+ *
+ * @param p Parser state
+ * @param tok Offending token, or NULL at end of input
+ * @return Always NULL, for convenience in parser return chains
+ */
+t_ast	*parser_error(t_parser *p, t_token *tok)
+{
+	if (p->status != PARSE_OK)
+		return (NULL);
+	if (!tok)
+	{
+		p->status = PARSE_INCOMPLETE;
+		return (NULL);
+	}
+	p->status = PARSE_SYNTAX_ERROR;
+	if (tok->value[0] == '\n')
+		print_error(ERR_PREFIX, ERR_SYNTAX, "newline", "'");
+	else
+		print_error(ERR_PREFIX, ERR_SYNTAX, tok->value, "'");
+	return (NULL);
+}
+
+/**
+ * @brief Consume a mandatory reserved word.
+ *
+ * @param p Parser state
+ * @param keyword Reserved word expected at the cursor
+ * @return true if found and consumed, false after recording the error
+ */
+bool	expect_keyword(t_parser *p, const char *keyword)
+{
+	if (is_keyword(p->curr, keyword))
+	{
+		p->curr = p->curr->next;
+		return (true);
+	}
+	parser_error(p, p->curr);
+	return (false);
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:05:49 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:05:50 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,7 +17,8 @@
  *
  * Recognizes the following operators as single tokens:
  *  - Pipe: |
- *  - Redirections: <, >, <<, >>
+ *  - Redirections: <, >, <<, >>, <&, >&, with an optional fd digit
+ *  - Separators: ; and newline
  *
  * Advances the index past the operator.
  *
@@ -29,22 +30,18 @@
  */
 static int	count_operator_at_index(const char *s, size_t *i)
 {
-	if (s[*i] == '|' || s[*i] == '<' || s[*i] == '>')
-	{
-		if ((s[*i] == '<' || s[*i] == '>') && s[*i + 1] && s[*i + 1] == s[*i])
-			*i += 2;
-		else
-			(*i)++;
-		return (1);
-	}
-	return (0);
+	size_t	len;
+
+	len = operator_length(s + *i);
+	*i += len;
+	return (len > 0);
 }
 
 /**
  * @brief Count a word or quoted token starting at the current index.
  *
  * A word token is a sequence of characters that is not a shell separator.
- * Handles quoted strings, updating the quote state as it parses.
+ * Handles quoted strings and `$( )` groups through word_length().
  * Advances the index until a shell separator or the end of the string.
  *
  * Helper for: count_shell_tokens()
@@ -55,14 +52,7 @@ static int	count_operator_at_index(const char *s, size_t *i)
  */
 static int	count_word_at_index(const char *s, size_t *i)
 {
-	t_quote	quote_state;
-
-	quote_state = STATE_NOT_IN_QUOTE;
-	while (s[*i] && !is_a_shell_separator(quote_state, s[*i]))
-	{
-		quote_state = update_quote_state(quote_state, s[*i]);
-		(*i)++;
-	}
+	*i += word_length(s + *i);
 	return (1);
 }
 
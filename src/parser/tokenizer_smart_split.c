@@ -6,23 +6,23 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:05:58 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:05:59 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:56:42 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
 /**
- * @brief Extract a special operator token (<, >, <<, >> and single |)
- * from the string.
+ * @brief Extract a special operator token (<, >, <<, >>, single |, ; and
+ * newline) from the string.
  *
- * Only extracts if we're in STATE_NOT_IN_QUOTE.
  * For mandatory part: treats << and >> as single double char tokens,
  * || as two separate tokens. (if we want || to be interpreted as a
  * double char for the bonus, we would need another implementation)
  *
- * Note: Recalculate quote state from start of string due to 42 norm
- * limitation (max 4 function parameters could not pass the enum as a 5th param)
+ * Tokens start outside quotes: a word only ends at an unquoted separator
+ * and unclosed quotes are rejected first, so the quote state needs no
+ * tracking here.
  *
  * Helper for: extract_tokens_to_tab()
  *
@@ -36,24 +36,12 @@
 static t_token_error	extract_operator(const char *s, char **tab,
 	size_t *i, size_t *token)
 {
-	t_quote	quote_state;
-	size_t	j;
 	size_t	len;
 
-	quote_state = STATE_NOT_IN_QUOTE;
-	j = 0;
-	while (j < *i)
-	{
-		quote_state = update_quote_state(quote_state, s[j]);
-		j++;
-	}
-	if (quote_state != STATE_NOT_IN_QUOTE
-		|| (s[*i] != '|' && s[*i] != '<' && s[*i] != '>'))
+	len = operator_length(s + *i);
+	if (len == 0)
 		return (TOKEN_NOT_OPERATOR);
-	len = 1;
-	if ((s[*i] == '<' || s[*i] == '>') && s[*i + 1] && s[*i + 1] == s[*i])
-		len = 2;
-	tab[*token] = ft_substr(s, *i, len);
+	tab[*token] = ft_strndup(s + *i, len);
 	if (!tab[*token])
 		return (free_string_array(tab, *token), TOKEN_MALLOC_ERROR);
 	*i += len;
@@ -67,7 +55,7 @@ static t_token_error	extract_operator(const char *s, char **tab,
  * Extracts one word from the string, taking into account quote states.
  * Processes characters until a separator is found, respecting quote boundaries.
  * Handles both single and double quotes, preserving metacharacters
- * inside quotes.
+ * inside quotes and inside `$( )` groups (see word_length()).
  *
  * Helper for: extract_tokens_to_tab()
  *
@@ -81,18 +69,12 @@ static t_token_error	extract_word(const char *s, char **tab, size_t *i,
 	size_t *token)
 {
 	size_t	start;
-	t_quote	current_quote_state;
 
 	start = *i;
-	current_quote_state = STATE_NOT_IN_QUOTE;
-	while (s[*i] && !is_a_shell_separator(current_quote_state, s[*i]))
-	{
-		current_quote_state = update_quote_state(current_quote_state, s[*i]);
-		(*i)++;
-	}
+	*i += word_length(s + *i);
 	if (*i > start)
 	{
-		tab[*token] = ft_substr(s, start, *i - start);
+		tab[*token] = ft_strndup(s + start, *i - start);
 		if (!tab[*token])
 		{
 			free_string_array(tab, *token);
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:06:09 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:06:10 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,7 +17,8 @@
  * Update the current quote state based on a character.
  *
  * This function updates the shell's quote state when encountering
- * single or double quote characters.
+ * single or double quote characters. Any other byte is rejected by a
+ * single lookup in g_char_class.
  *
  * Used by: has_unclosed_quotes(), extract_operator(), extract_word(),
  *
@@ -27,6 +28,8 @@
  */
 t_quote	update_quote_state(t_quote current_quote_state, char c)
 {
+	if (!(g_char_class[(unsigned char)c] & CC_QUOTE))
+		return (current_quote_state);
 	if (c == '\'' && current_quote_state == STATE_NOT_IN_QUOTE)
 		current_quote_state = STATE_IN_SINGLE_QUOTE;
 	else if (c == '"' && current_quote_state == STATE_NOT_IN_QUOTE)
@@ -41,7 +44,7 @@ t_quote	update_quote_state(t_quote current_quote_state, char c)
 /**
  * @brief Check if a character is a shell separator.
  *
- * A separator is a whitespace or a special shell operator (|, <, >)
+ * A separator is a whitespace or a special shell operator (|, <, >, ;, (, ))
  * when not inside quotes. Inside quotes, metacharacters are preserved
  * and not treated as separators.
  *
@@ -55,18 +58,15 @@ bool	is_a_shell_separator(t_quote current_quote_state, char c)
 {
 	if (current_quote_state != STATE_NOT_IN_QUOTE)
 		return (false);
-	if (is_whitespace(c))
-		return (true);
-	if ((c == '|' || c == '<' || c == '>'))
-		return (true);
-	return (false);
+	return ((g_char_class[(unsigned char)c] & CC_SEP) != 0);
 }
 
 /**
  * @brief Detect if the string has unclosed quotes.
  *
  * Scans the string and checks if there is any quote that is
- * not closed at the end of the string.
+ * not closed at the end of the string. Runs of bytes that cannot change
+ * the quote state are skipped with plain_run_length().
  *
  * Used in: ft_split_tokens() to reject invalid input early
  *
@@ -86,6 +86,7 @@ bool	has_unclosed_quotes(char const *s)
 	{
 		current_quote_state = update_quote_state(current_quote_state, s[i]);
 		i++;
+		i += plain_run_length(s + i, current_quote_state, false);
 	}
 	if (current_quote_state != STATE_NOT_IN_QUOTE)
 		return (true);
@@ -98,6 +99,7 @@ bool	has_unclosed_quotes(char const *s)
  *
  * Advances the index pointer until a non-whitespace character is found.
  * This ensures that no empty tokens are counted when parsing shell input.
+ * Newlines are not skipped: they separate commands like ';' does.
  *
  * Used by : count_shell_tokens(), extract_tokens_to_tab()
  *
@@ -106,6 +108,42 @@ bool	has_unclosed_quotes(char const *s)
  */
 void	skip_whitespace(char const *s, size_t *i)
 {
-	while (s[*i] && is_whitespace(s[*i]))
+	while (g_char_class[(unsigned char)s[*i]] & CC_BLANK)
 		(*i)++;
 }
+
+/**
+ * @brief Length of the unquoted operator starting at s[0], if any.
+ *
+ * Recognized operators: |, <, >, <<, >>, <& and >& (fd duplication),
+ * ( and ) (function definitions), ; and newline (a command separator,
+ * categorized like ';') and ;; (end of a `case` item). "((" starts an
+ * arithmetic command, which is a word. A redirection may be prefixed by
+ * the single digit of the fd it targets (`2>`, `3>>`, `0<&`).
+ *
+ * Used by: count_operator_at_index(), extract_operator()
+ *
+ * @param s String positioned on the candidate operator
+ * @return Operator length in bytes, 0 if s[0] does not start an operator
+ */
+size_t	operator_length(const char *s)
+{
+	size_t	io;
+
+	io = (ft_isdigit(s[0]) && (s[1] == '<' || s[1] == '>'));
+	if (!(g_char_class[(unsigned char)s[io]] & CC_OP))
+		return (0);
+	if (s[0] == '(' && s[1] == '(')
+		return (0);
+	if ((s[io] == '<' || s[io] == '>')
+		&& (s[io + 1] == s[io] || s[io + 1] == '&'))
+		return (io + 2);
+	if (s[io] == '<' || s[io] == '>')
+		return (io + 1);
+	if (s[0] == ';' && s[1] == ';')
+		return (2);
+	if (s[0] == '|' || s[0] == '<' || s[0] == '>' || s[0] == ';'
+		|| s[0] == '\n' || s[0] == '(' || s[0] == ')')
+		return (1);
+	return (0);
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tokenizer_words.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:06:20 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:56:42 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Length of a bracketed group, up to its matching closing byte.
+ *
+ * Quotes inside the group are honoured, so `$(echo ")")` is one group.
+ * An unbalanced group extends to the end of the string.
+ *
+ * @param s String positioned on the opening byte
+ * @param open Opening byte, '(' or '{'
+ * @param close Matching closing byte
+ * @return Number of bytes from the opening to the closing byte included
+ */
+static size_t	group_length(const char *s, char open, char close)
+{
+	size_t	i;
+	int		depth;
+	t_quote	quote_state;
+
+	i = 0;
+	depth = 0;
+	quote_state = STATE_NOT_IN_QUOTE;
+	while (s[i])
+	{
+		quote_state = update_quote_state(quote_state, s[i]);
+		if (quote_state == STATE_NOT_IN_QUOTE && s[i] == open)
+			depth++;
+		else if (quote_state == STATE_NOT_IN_QUOTE && s[i] == close)
+			depth--;
+		i++;
+		if (depth == 0)
+			break ;
+	}
+	return (i);
+}
+
+/**
+ * @brief Length of a parenthesized group, up to its matching ')'.
+ *
+ * Used by: word_length(), expand_arithmetic()
+ *
+ * @param s String positioned on the opening '('
+ * @return Number of bytes from '(' to the matching ')' included
+ */
+size_t	paren_group_length(const char *s)
+{
+	return (group_length(s, '(', ')'));
+}
+
+/**
+ * @brief Length of the braces of a parameter expansion `${...}`.
+ *
+ * Used by: word_length(), append_dollar(), is_glob_word()
+ *
+ * @param s String positioned on the opening '{'
+ * @return Number of bytes from '{' to the matching '}' included
+ */
+size_t	brace_group_length(const char *s)
+{
+	return (group_length(s, '{', '}'));
+}
+
+/**
+ * @brief Length of the word token starting at s[0].
+ *
+ * A word ends at an unquoted separator. `$( ... )`, `$(( ... ))` and
+ * `${ ... }` are kept whole even if they contain spaces or operators, and
+ * so is an arithmetic command `(( ... ))` at the start of a word.
+ * Ordinary bytes are skipped a run at a time with plain_run_length().
+ *
+ * Used by: count_word_at_index(), extract_word()
+ *
+ * @param s String positioned at the start of the word
+ * @return Word length in bytes
+ */
+size_t	word_length(const char *s)
+{
+	size_t	i;
+	t_quote	quote_state;
+
+	if (s[0] == '(' && s[1] == '(')
+		return (paren_group_length(s));
+	i = 0;
+	quote_state = STATE_NOT_IN_QUOTE;
+	while (s[i] && !is_a_shell_separator(quote_state, s[i]))
+	{
+		if (s[i] == '$' && s[i + 1] == '('
+			&& quote_state != STATE_IN_SINGLE_QUOTE)
+			i += 1 + paren_group_length(s + i + 1);
+		else if (s[i] == '$' && s[i + 1] == '{'
+			&& quote_state != STATE_IN_SINGLE_QUOTE)
+			i += 1 + brace_group_length(s + i + 1);
+		else
+			quote_state = update_quote_state(quote_state, s[i++]);
+		i += plain_run_length(s + i, quote_state, true);
+	}
+	return (i);
+}
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:06:52 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:06:53 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:22:24 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -30,13 +30,10 @@
  */
 static int	syntax_error(t_token *token)
 {
-	ft_putstr_fd(ERR_PREFIX, STDERR_FILENO);
-	ft_putstr_fd(ERR_SYNTAX, STDERR_FILENO);
-	if (token && token->value)
-		ft_putstr_fd(token->value, STDERR_FILENO);
+	if (token && token->value && token->value[0] != '\n')
+		print_error(ERR_PREFIX, ERR_SYNTAX, token->value, "'");
 	else
-		ft_putstr_fd("newline", STDERR_FILENO);
-	ft_putstr_fd("'\n", STDERR_FILENO);
+		print_error(ERR_PREFIX, ERR_SYNTAX, "newline", "'");
 	return (MISUSAGE_ERROR);
 }
 
@@ -53,7 +50,9 @@ static bool	is_token_redirection(t_token *token)
 	return (token->op_type == OP_INPUT
 		|| token->op_type == OP_OUTPUT
 		|| token->op_type == OP_APPEND
-		|| token->op_type == OP_HEREDOC);
+		|| token->op_type == OP_HEREDOC
+		|| token->op_type == OP_DUP_IN
+		|| token->op_type == OP_DUP_OUT);
 }
 
 /**
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   char_class.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:45:20 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 04:58:55 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Class of each byte, for the lexer, the expansions and the quote
+ * removal.
+ *
+ * One lookup replaces a chain of comparisons: a scanning loop tests a
+ * mask of classes, and the NUL byte has its own class so that the end
+ * of the string needs no extra test. Bytes above 0x7f have no class.
+ *
+ *  - CC_SPACE: whitespace, as in is_whitespace()
+ *  - CC_BLANK: whitespace separating words, newline excluded
+ *  - CC_SEP: ends an unquoted word (whitespace or operator)
+ *  - CC_OP: starts an operator (see operator_length())
+ *  - CC_SQUOTE, CC_DQUOTE: quotes
+ *  - CC_DOLLAR: starts an expansion
+ *  - CC_VAR_START, CC_VAR_CHAR: first and next bytes of a variable name
+ *  - CC_GLOB: unquoted wildcard
+ */
+const unsigned short	g_char_class[256] = {
+	['\0'] = CC_NUL,
+	['\t'] = CC_SPACE | CC_BLANK | CC_SEP,
+	['\n'] = CC_SPACE | CC_SEP | CC_OP,
+	['\v'] = CC_SPACE | CC_BLANK | CC_SEP,
+	['\f'] = CC_SPACE | CC_BLANK | CC_SEP,
+	['\r'] = CC_SPACE | CC_BLANK | CC_SEP,
+	[' '] = CC_SPACE | CC_BLANK | CC_SEP,
+	['|'] = CC_SEP | CC_OP, ['<'] = CC_SEP | CC_OP, ['>'] = CC_SEP | CC_OP,
+	[';'] = CC_SEP | CC_OP, ['('] = CC_SEP | CC_OP, [')'] = CC_SEP | CC_OP,
+	['\''] = CC_SQUOTE, ['"'] = CC_DQUOTE, ['$'] = CC_DOLLAR,
+	['*'] = CC_GLOB, ['?'] = CC_GLOB, ['['] = CC_GLOB,
+	['_'] = CC_NAME,
+	['0'] = CC_VAR_CHAR, ['1'] = CC_VAR_CHAR, ['2'] = CC_VAR_CHAR,
+	['3'] = CC_VAR_CHAR, ['4'] = CC_VAR_CHAR, ['5'] = CC_VAR_CHAR,
+	['6'] = CC_VAR_CHAR, ['7'] = CC_VAR_CHAR, ['8'] = CC_VAR_CHAR,
+	['9'] = CC_VAR_CHAR,
+	['A'] = CC_NAME, ['B'] = CC_NAME, ['C'] = CC_NAME, ['D'] = CC_NAME,
+	['E'] = CC_NAME, ['F'] = CC_NAME, ['G'] = CC_NAME, ['H'] = CC_NAME,
+	['I'] = CC_NAME, ['J'] = CC_NAME, ['K'] = CC_NAME, ['L'] = CC_NAME,
+	['M'] = CC_NAME, ['N'] = CC_NAME, ['O'] = CC_NAME, ['P'] = CC_NAME,
+	['Q'] = CC_NAME, ['R'] = CC_NAME, ['S'] = CC_NAME, ['T'] = CC_NAME,
+	['U'] = CC_NAME, ['V'] = CC_NAME, ['W'] = CC_NAME, ['X'] = CC_NAME,
+	['Y'] = CC_NAME, ['Z'] = CC_NAME, ['a'] = CC_NAME, ['b'] = CC_NAME,
+	['c'] = CC_NAME, ['d'] = CC_NAME, ['e'] = CC_NAME, ['f'] = CC_NAME,
+	['g'] = CC_NAME, ['h'] = CC_NAME, ['i'] = CC_NAME, ['j'] = CC_NAME,
+	['k'] = CC_NAME, ['l'] = CC_NAME, ['m'] = CC_NAME, ['n'] = CC_NAME,
+	['o'] = CC_NAME, ['p'] = CC_NAME, ['q'] = CC_NAME, ['r'] = CC_NAME,
+	['s'] = CC_NAME, ['t'] = CC_NAME, ['u'] = CC_NAME, ['v'] = CC_NAME,
+	['w'] = CC_NAME, ['x'] = CC_NAME, ['y'] = CC_NAME, ['z'] = CC_NAME,
+};
+
+#if defined(__x86_64__) && !defined(CHAR_SCAN_SCALAR)
+
+/**
+ * @brief Find the first byte of a stop class with the widest kernel the
+ * CPU supports: AVX2 when available, SSE2 otherwise.
+ *
+ * @param s String to scan
+ * @param stop CC_NUL plus any of CC_SQUOTE, CC_DQUOTE, CC_DOLLAR, CC_SEP
+ * @return Index of the first byte in a stop class
+ */
+static size_t	scan_stop(const char *s, unsigned short stop)
+{
+	if (__builtin_cpu_supports("avx2"))
+		return (scan_stop_avx2(s, stop));
+	return (scan_stop_sse2(s, stop));
+}
+
+#else
+
+/**
+ * @brief Find the first byte of a stop class, one byte at a time.
+ *
+ * Used without x86-64 vector support, or when built with SIMD=0.
+ *
+ * @param s String to scan
+ * @param stop Classes of g_char_class, CC_NUL included
+ * @return Index of the first byte in a stop class
+ */
+static size_t	scan_stop(const char *s, unsigned short stop)
+{
+	return (scan_stop_scalar(s, stop));
+}
+
+#endif
+
+/**
+ * @brief Length of the run of bytes at s that a scanner can skip.
+ *
+ * The run stops at the end of the string and at any byte that may change
+ * the quote state or start an expansion in that state: a quote or '$'
+ * outside quotes, '"' or '$' in double quotes, '\'' in single quotes.
+ * Outside quotes it also stops at a word separator when asked.
+ *
+ * The first bytes are tested one at a time, as most runs are short; a
+ * longer run, such as a large quoted argument, is finished by a vector
+ * kernel that tests 16 or 32 bytes at once.
+ *
+ * @param s String to scan
+ * @param quote_state Quote state at s[0]
+ * @param separators true to stop at unquoted separators too
+ * @return Number of bytes in the run
+ */
+size_t	plain_run_length(const char *s, t_quote quote_state, bool separators)
+{
+	unsigned short	stop;
+	size_t			i;
+
+	stop = CC_NUL | CC_SQUOTE;
+	if (quote_state == STATE_IN_DOUBLE_QUOTE)
+		stop = CC_NUL | CC_DQUOTE | CC_DOLLAR;
+	else if (quote_state == STATE_NOT_IN_QUOTE)
+		stop = CC_NUL | CC_QUOTE | CC_DOLLAR;
+	if (quote_state == STATE_NOT_IN_QUOTE && separators)
+		stop |= CC_SEP;
+	i = 0;
+	while (i < SCAN_SCALAR_BYTES
+		&& !(g_char_class[(unsigned char)s[i]] & stop))
+		i++;
+	if (i < SCAN_SCALAR_BYTES)
+		return (i);
+	return (i + scan_stop(s + i, stop));
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   char_scan_avx2.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:57:39 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:00:56 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+#if defined(__x86_64__)
+# include <immintrin.h>
+
+/**
+ * @brief Mark the bytes of a block that end an unquoted word.
+ *
+ * Same tests as the SSE2 version, on 32 bytes.
+ *
+ * @param v 32 bytes of input
+ * @return 0xff for each whitespace or operator byte, 0 elsewhere
+ */
+__attribute__((target("avx2")))
+static __m256i	avx2_separators(__m256i v)
+{
+	__m256i	t;
+	__m256i	hit;
+
+	t = _mm256_sub_epi8(v, _mm256_set1_epi8(9));
+	hit = _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(4)), t);
+	hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+	hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('|')));
+	hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('<')));
+	hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('>')));
+	hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(';')));
+	hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('(')));
+	return (_mm256_or_si256(hit,
+			_mm256_cmpeq_epi8(v, _mm256_set1_epi8(')'))));
+}
+
+/**
+ * @brief Bit mask of the bytes of a block that belong to the stop classes.
+ *
+ * @param v 32 bytes of input
+ * @param stop Stop classes, as for the SSE2 kernel
+ * @return One bit per byte, bit 0 for the first byte
+ */
+__attribute__((target("avx2")))
+static unsigned int	avx2_stop_bits(__m256i v, unsigned short stop)
+{
+	__m256i	hit;
+
+	hit = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+	if (stop & CC_SQUOTE)
+		hit = _mm256_or_si256(hit,
+				_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\'')));
+	if (stop & CC_DQUOTE)
+		hit = _mm256_or_si256(hit,
+				_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')));
+	if (stop & CC_DOLLAR)
+		hit = _mm256_or_si256(hit,
+				_mm256_cmpeq_epi8(v, _mm256_set1_epi8('$')));
+	if (stop & CC_SEP)
+		hit = _mm256_or_si256(hit, avx2_separators(v));
+	return ((unsigned int)_mm256_movemask_epi8(hit));
+}
+
+/**
+ * @brief Find the first byte of a stop class, 32 bytes at a time.
+ *
+ * Aligned loads, as in scan_stop_sse2(), never cross a page boundary.
+ *
+ * @param s String to scan
+ * @param stop Stop classes
+ * @return Index of the first byte in a stop class (the NUL at worst)
+ */
+__attribute__((target("avx2"), no_sanitize_address))
+size_t	scan_stop_avx2(const char *s, unsigned short stop)
+{
+	const char		*p;
+	unsigned int	bits;
+
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)31);
+	bits = avx2_stop_bits(_mm256_load_si256((const __m256i *)p), stop);
+	bits >>= (s - p);
+	if (bits)
+		return (__builtin_ctz(bits));
+	p += 32;
+	bits = avx2_stop_bits(_mm256_load_si256((const __m256i *)p), stop);
+	while (!bits)
+	{
+		p += 32;
+		bits = avx2_stop_bits(_mm256_load_si256((const __m256i *)p), stop);
+	}
+	return (p - s + __builtin_ctz(bits));
+}
+
+#endif
@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   char_scan_scalar.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:57:39 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:57:39 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Find the first byte of a stop class, one byte at a time.
+ *
+ * Used without x86-64 vector support or when built with SIMD=0, and as
+ * the reference the vector kernels are tested against.
+ *
+ * @param s String to scan
+ * @param stop Classes of g_char_class, CC_NUL included
+ * @return Index of the first byte in a stop class
+ */
+size_t	scan_stop_scalar(const char *s, unsigned short stop)
+{
+	size_t	i;
+
+	i = 0;
+	while (!(g_char_class[(unsigned char)s[i]] & stop))
+		i++;
+	return (i);
+}
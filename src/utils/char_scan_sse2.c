@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   char_scan_sse2.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:57:39 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:00:56 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+#if defined(__x86_64__)
+# include <emmintrin.h>
+
+/**
+ * @brief Mark the bytes of a block that end an unquoted word.
+ *
+ * Whitespace 9 to 13 is one range test: x - 9, as unsigned, is at most 4.
+ *
+ * @param v 16 bytes of input
+ * @return 0xff for each whitespace or operator byte, 0 elsewhere
+ */
+static __m128i	sse2_separators(__m128i v)
+{
+	__m128i	t;
+	__m128i	hit;
+
+	t = _mm_sub_epi8(v, _mm_set1_epi8(9));
+	hit = _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(4)), t);
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('|')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('<')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('>')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8(';')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('(')));
+	return (_mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8(')'))));
+}
+
+/**
+ * @brief Bit mask of the bytes of a block that belong to the stop classes.
+ *
+ * @param v 16 bytes of input
+ * @param stop Classes of g_char_class: CC_NUL always, plus any of
+ *        CC_SQUOTE, CC_DQUOTE, CC_DOLLAR and CC_SEP
+ * @return One bit per byte, bit 0 for the first byte
+ */
+static unsigned int	sse2_stop_bits(__m128i v, unsigned short stop)
+{
+	__m128i	hit;
+
+	hit = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+	if (stop & CC_SQUOTE)
+		hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('\'')));
+	if (stop & CC_DQUOTE)
+		hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+	if (stop & CC_DOLLAR)
+		hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('$')));
+	if (stop & CC_SEP)
+		hit = _mm_or_si128(hit, sse2_separators(v));
+	return ((unsigned int)_mm_movemask_epi8(hit));
+}
+
+/**
+ * @brief Find the first byte of a stop class, 16 bytes at a time.
+ *
+ * Loads are aligned, so a block never crosses a page boundary even past
+ * the terminating NUL; the bytes before s in the first block are masked
+ * out. Reading past the end of the string is deliberate, hence the
+ * address sanitizer exemption.
+ *
+ * @param s String to scan
+ * @param stop Stop classes (see sse2_stop_bits())
+ * @return Index of the first byte in a stop class (the NUL at worst)
+ */
+__attribute__((no_sanitize_address))
+size_t	scan_stop_sse2(const char *s, unsigned short stop)
+{
+	const char		*p;
+	unsigned int	bits;
+
+	p = (const char *)((uintptr_t)s & ~(uintptr_t)15);
+	bits = sse2_stop_bits(_mm_load_si128((const __m128i *)p), stop);
+	bits >>= (s - p);
+	if (bits)
+		return (__builtin_ctz(bits));
+	p += 16;
+	bits = sse2_stop_bits(_mm_load_si128((const __m128i *)p), stop);
+	while (!bits)
+	{
+		p += 16;
+		bits = sse2_stop_bits(_mm_load_si128((const __m128i *)p), stop);
+	}
+	return (p - s + __builtin_ctz(bits));
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:07:31 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:07:32 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:56:42 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,7 +23,5 @@
  */
 bool	is_whitespace(char c)
 {
-	if ((c >= 9 && c <= 13) || c == ' ')
-		return (true);
-	return (false);
+	return ((g_char_class[(unsigned char)c] & CC_SPACE) != 0);
 }
@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:07:37 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:07:38 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:32:41 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -47,6 +47,8 @@ void	cleanup_shell(t_shell *data)
 		return ;
 	if (data->env_list)
 		ft_lstclear(&data->env_list, del_env);
+	free_function_table(data);
+	free_dir_cache(data);
 	rl_clear_history();
 }
 
@@ -86,3 +88,31 @@ void	cleanup_line(char **tokens,
 		line = NULL;
 	}
 }
+
+/**
+ * @brief Drop the directory listings cached for pathname expansion.
+ *
+ * Called once a line has run, so the next line sees fresh listings.
+ *
+ * @param data Shell state structure
+ */
+void	free_dir_cache(t_shell *data)
+{
+	t_dirlist	*dir;
+	t_dirlist	*next;
+	size_t		i;
+
+	i = 0;
+	while (i < data->dir_cache.size)
+	{
+		dir = data->dir_cache.buckets[i++];
+		while (dir)
+		{
+			next = dir->next;
+			del_dir_listing(dir);
+			dir = next;
+		}
+	}
+	free(data->dir_cache.buckets);
+	ft_bzero(&data->dir_cache, sizeof(t_dircache));
+}
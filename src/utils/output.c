@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:06:15 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:06:15 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Get the output buffer of a standard fd.
+ *
+ * The buffers live for the whole process. They are empty whenever the
+ * shell forks, since every builtin and error message flushes them.
+ *
+ * @param fd File descriptor
+ * @return Buffer of fd, or NULL if fd is not a standard fd
+ */
+t_outbuf	*out_buffer(int fd)
+{
+	static t_outbuf	buffers[OUT_FDS];
+
+	if (fd < 0 || fd >= OUT_FDS)
+		return (NULL);
+	return (&buffers[fd]);
+}
+
+/**
+ * @brief Write every iovec segment, resuming after short writes.
+ *
+ * @param fd File descriptor
+ * @param iov Segments (consumed)
+ * @param count Number of segments
+ * @return 0 on success, -1 on write error (errno set)
+ */
+static int	write_iov(int fd, struct iovec *iov, int count)
+{
+	ssize_t	n;
+
+	while (count > 0)
+	{
+		n = writev(fd, iov, count);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n < 0)
+			return (-1);
+		while (count > 0 && (size_t)n >= iov->iov_len)
+		{
+			n -= iov->iov_len;
+			iov++;
+			count--;
+		}
+		if (count > 0)
+		{
+			iov->iov_base = (char *)iov->iov_base + n;
+			iov->iov_len -= n;
+		}
+	}
+	return (0);
+}
+
+/**
+ * @brief Send the buffered bytes followed by `extra` in one writev().
+ *
+ * A capturing buffer appends them to the command substitution output
+ * instead. The first error is kept until out_flush() reports it.
+ *
+ * @param buf Buffer to empty
+ * @param fd File descriptor of the buffer
+ * @param extra Bytes to send after the buffered ones (can be NULL)
+ * @param len Number of extra bytes
+ * @return 0 on success, -1 on error
+ */
+static int	drain(t_outbuf *buf, int fd, const char *extra, size_t len)
+{
+	struct iovec	iov[2];
+	int				ret;
+
+	ret = 0;
+	if (buf->capture && (strbuf_append(buf->capture, buf->data, buf->len)
+			== -1 || strbuf_append(buf->capture, extra, len) == -1))
+		ret = -1;
+	else if (!buf->capture)
+	{
+		iov[0].iov_base = buf->data;
+		iov[0].iov_len = buf->len;
+		iov[1].iov_base = (void *)extra;
+		iov[1].iov_len = len;
+		ret = write_iov(fd, iov, 2);
+	}
+	if (ret == -1 && !buf->failed)
+	{
+		buf->failed = true;
+		buf->err = errno;
+	}
+	buf->len = 0;
+	return (ret);
+}
+
+/**
+ * @brief Buffer bytes for fd, writing them out once the buffer is full.
+ *
+ * Pending output of the other standard stream is flushed first, so that
+ * stdout and stderr stay in order when both reach the same file. Other
+ * fds are written directly.
+ *
+ * @param fd File descriptor
+ * @param s Bytes to write
+ * @param len Number of bytes
+ * @return 0 on success, -1 on write error
+ */
+int	out_write(int fd, const char *s, size_t len)
+{
+	t_outbuf		*buf;
+	t_outbuf		*other;
+	struct iovec	iov;
+
+	buf = out_buffer(fd);
+	if (!buf)
+	{
+		iov.iov_base = (void *)s;
+		iov.iov_len = len;
+		return (write_iov(fd, &iov, 1));
+	}
+	other = NULL;
+	if (fd == STDOUT_FILENO || fd == STDERR_FILENO)
+		other = out_buffer(STDOUT_FILENO + STDERR_FILENO - fd);
+	if (other && other->len)
+		drain(other, STDOUT_FILENO + STDERR_FILENO - fd, NULL, 0);
+	if (buf->len + len > OUT_BUF_SIZE)
+		return (drain(buf, fd, s, len));
+	ft_memcpy(buf->data + buf->len, s, len);
+	buf->len += len;
+	return (0);
+}
+
+/**
+ * @brief Write out the buffered bytes of fd and report any write error.
+ *
+ * @param fd File descriptor
+ * @return 0 on success, -1 if a write failed since the last flush (errno
+ *         set to the first error)
+ */
+int	out_flush(int fd)
+{
+	t_outbuf	*buf;
+
+	buf = out_buffer(fd);
+	if (!buf)
+		return (0);
+	if (buf->len)
+		drain(buf, fd, NULL, 0);
+	if (!buf->failed)
+		return (0);
+	buf->failed = false;
+	errno = buf->err;
+	return (-1);
+}
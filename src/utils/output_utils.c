@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output_utils.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:06:15 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 03:06:15 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Buffer a string for fd.
+ *
+ * @param fd File descriptor
+ * @param s String to write (NULL writes nothing)
+ * @return 0 on success, -1 on write error
+ */
+int	out_str(int fd, const char *s)
+{
+	if (!s)
+		return (0);
+	return (out_write(fd, s, ft_strlen(s)));
+}
+
+/**
+ * @brief Buffer a single character for fd.
+ *
+ * @param fd File descriptor
+ * @param c Character to write
+ * @return 0 on success, -1 on write error
+ */
+int	out_char(int fd, char c)
+{
+	return (out_write(fd, &c, 1));
+}
+
+/**
+ * @brief Flush both standard streams at the end of a builtin.
+ *
+ * A failed write to stdout is reported like bash does:
+ * "[mini$HELL]: echo: write error: No space left on device".
+ *
+ * @param cmd Name of the builtin
+ * @return 0 on success, -1 if its output could not be written
+ */
+int	out_finish(const char *cmd)
+{
+	int	ret;
+
+	ret = out_flush(STDOUT_FILENO);
+	if (ret == -1)
+		print_error(ERR_PREFIX, (char *)cmd, ERR_WRITE, strerror(errno));
+	out_flush(STDERR_FILENO);
+	return (ret);
+}
+
+/**
+ * @brief Print "s: <strerror(errno)>" to stderr, like perror().
+ *
+ * Goes through the stderr buffer so that it stays ordered with the
+ * buffered stdout, and keeps errno.
+ *
+ * @param s Message prefix (can be NULL)
+ */
+void	out_perror(const char *s)
+{
+	int	err;
+
+	err = errno;
+	if (s && *s)
+	{
+		out_str(STDERR_FILENO, s);
+		out_str(STDERR_FILENO, ": ");
+	}
+	out_str(STDERR_FILENO, strerror(err));
+	out_char(STDERR_FILENO, '\n');
+	out_flush(STDERR_FILENO);
+	errno = err;
+}
+
+/**
+ * @brief Send the stdout buffer to a command substitution output.
+ *
+ * Pending output goes to the previous target first.
+ *
+ * @param capture Output to append to, or NULL to write to fd 1 again
+ * @return The previous capture, to restore afterwards
+ */
+t_strbuf	*out_capture(t_strbuf *capture)
+{
+	t_outbuf	*buf;
+	t_strbuf	*previous;
+
+	out_flush(STDOUT_FILENO);
+	buf = out_buffer(STDOUT_FILENO);
+	previous = buf->capture;
+	buf->capture = capture;
+	return (previous);
+}
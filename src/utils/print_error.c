@@ -6,7 +6,7 @@
 /*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/10/15 18:07:51 by pafroidu          #+#    #+#             */
-/*   Updated: 2025/10/15 18:07:52 by pafroidu         ###   ########.fr       */
+/*   Updated: 2026/10/19 03:08:29 by pafroidu         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,9 @@
 /**
  * @brief Print up to 4 message parts to stderr as one line
  *
+ * The line is assembled in the stderr buffer and written with a single
+ * write(), after any pending stdout output.
+ *
  * @param p1 First part (required)
  * @param p2 Second part (can be NULL)
  * @param p3 Third part (can be NULL)
@@ -22,13 +25,10 @@
  */
 void	print_error(char *p1, char *p2, char *p3, char *p4)
 {
-	if (p1)
-		ft_putstr_fd(p1, STDERR_FILENO);
-	if (p2)
-		ft_putstr_fd(p2, STDERR_FILENO);
-	if (p3)
-		ft_putstr_fd(p3, STDERR_FILENO);
-	if (p4)
-		ft_putstr_fd(p4, STDERR_FILENO);
-	ft_putchar_fd('\n', STDERR_FILENO);
+	out_str(STDERR_FILENO, p1);
+	out_str(STDERR_FILENO, p2);
+	out_str(STDERR_FILENO, p3);
+	out_str(STDERR_FILENO, p4);
+	out_char(STDERR_FILENO, '\n');
+	out_flush(STDERR_FILENO);
 }
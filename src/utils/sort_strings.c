@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_strings.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:19:46 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:19:46 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Merge the sorted runs [lo, mid) and [mid, hi) of src into dst.
+ *
+ * On equal keys the element of the left run comes first, which keeps the
+ * sort stable.
+ *
+ * @param m Merge state (source, destination, size, comparison)
+ * @param lo Start of the left run
+ * @param mid End of the left run, start of the right one
+ * @param hi End of the right run
+ */
+static void	merge_runs(t_merge *m, size_t lo, size_t mid, size_t hi)
+{
+	size_t	i;
+	size_t	j;
+	size_t	k;
+
+	i = lo;
+	j = mid;
+	k = lo;
+	while (i < mid && j < hi)
+	{
+		if (m->cmp(m->src[j], m->src[i]) < 0)
+			m->dst[k++] = m->src[j++];
+		else
+			m->dst[k++] = m->src[i++];
+	}
+	while (i < mid)
+		m->dst[k++] = m->src[i++];
+	while (j < hi)
+		m->dst[k++] = m->src[j++];
+}
+
+/**
+ * @brief Merge every pair of adjacent runs of `width` elements.
+ *
+ * The merged runs end up in m->src again: source and destination are
+ * swapped after the pass.
+ *
+ * @param m Merge state
+ * @param width Length of the sorted runs of the source
+ */
+static void	merge_pass(t_merge *m, size_t width)
+{
+	char	**tmp;
+	size_t	lo;
+	size_t	mid;
+	size_t	hi;
+
+	lo = 0;
+	while (lo < m->n)
+	{
+		mid = lo + width;
+		if (mid > m->n)
+			mid = m->n;
+		hi = mid + width;
+		if (hi > m->n)
+			hi = m->n;
+		merge_runs(m, lo, mid, hi);
+		lo = hi;
+	}
+	tmp = m->src;
+	m->src = m->dst;
+	m->dst = tmp;
+}
+
+/**
+ * @brief Check if an array is already sorted.
+ *
+ * @param items Array of strings
+ * @param n Number of strings
+ * @param cmp Comparison function
+ * @return true if no element is greater than the next one
+ */
+static bool	is_sorted(char **items, size_t n,
+	int (*cmp)(const char *, const char *))
+{
+	size_t	i;
+
+	i = 1;
+	while (i < n && cmp(items[i - 1], items[i]) <= 0)
+		i++;
+	return (i >= n);
+}
+
+/**
+ * @brief Stable sort of an array of strings, without recursion.
+ *
+ * Bottom-up merge sort: O(n log n) comparisons whatever the input, and an
+ * already sorted array (the usual case for directory listings read in
+ * order) costs a single scan. The comparison is bytewise, so the order
+ * does not depend on the locale.
+ *
+ * @param items Array to sort in place
+ * @param n Number of strings
+ * @param cmp Comparison function, ft_strcmp() for plain byte order
+ * @return 0 on success, -1 on allocation failure (array unchanged)
+ */
+int	sort_strings(char **items, size_t n,
+	int (*cmp)(const char *, const char *))
+{
+	t_merge	m;
+	char	**buf;
+	size_t	width;
+
+	if (n < 2 || is_sorted(items, n, cmp))
+		return (0);
+	buf = malloc(sizeof(char *) * n);
+	if (!buf)
+		return (-1);
+	m.src = items;
+	m.dst = buf;
+	m.n = n;
+	m.cmp = cmp;
+	width = 1;
+	while (width < n)
+	{
+		merge_pass(&m, width);
+		width *= 2;
+	}
+	if (m.src != items)
+		ft_memcpy(items, m.src, sizeof(char *) * n);
+	free(buf);
+	return (0);
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strbuf.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:09:13 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:25:43 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Initialize an empty growable string buffer.
+ *
+ * @param buf Buffer to initialize (no memory is allocated yet)
+ */
+void	strbuf_init(t_strbuf *buf)
+{
+	buf->data = NULL;
+	buf->len = 0;
+	buf->cap = 0;
+}
+
+/**
+ * @brief Make room for `extra` more bytes plus the terminating NUL.
+ *
+ * The capacity at least doubles, so appending n bytes piece by piece
+ * costs O(n) copies overall.
+ *
+ * @param buf Buffer to grow
+ * @param extra Number of bytes about to be appended
+ * @return 0 on success, -1 on allocation failure (buffer unchanged)
+ */
+int	strbuf_reserve(t_strbuf *buf, size_t extra)
+{
+	char	*new_data;
+	size_t	new_cap;
+
+	if (buf->len + extra < buf->cap)
+		return (0);
+	new_cap = buf->cap * 2;
+	if (new_cap < STRBUF_MIN_CAP)
+		new_cap = STRBUF_MIN_CAP;
+	while (new_cap <= buf->len + extra)
+		new_cap *= 2;
+	new_data = malloc(new_cap);
+	if (!new_data)
+		return (-1);
+	if (buf->data)
+		ft_memcpy(new_data, buf->data, buf->len);
+	free(buf->data);
+	buf->data = new_data;
+	buf->cap = new_cap;
+	return (0);
+}
+
+/**
+ * @brief Append `len` bytes to the buffer.
+ *
+ * @param buf Buffer to append to
+ * @param src Bytes to copy
+ * @param len Number of bytes
+ * @return 0 on success, -1 on allocation failure
+ */
+int	strbuf_append(t_strbuf *buf, const char *src, size_t len)
+{
+	if (len == 0)
+		return (0);
+	if (strbuf_reserve(buf, len) == -1)
+		return (-1);
+	ft_memcpy(buf->data + buf->len, src, len);
+	buf->len += len;
+	return (0);
+}
+
+/**
+ * @brief Terminate the buffer and hand its string over to the caller.
+ *
+ * @param buf Buffer to finish (left empty)
+ * @return NUL-terminated string to free, or NULL on allocation failure
+ */
+char	*strbuf_finish(t_strbuf *buf)
+{
+	char	*str;
+
+	if (strbuf_reserve(buf, 0) == -1)
+	{
+		free(buf->data);
+		strbuf_init(buf);
+		return (NULL);
+	}
+	buf->data[buf->len] = '\0';
+	str = buf->data;
+	strbuf_init(buf);
+	return (str);
+}
+
+/**
+ * @brief Backslash-escape the bytes of `set` appended since `start`.
+ *
+ * The region is widened in place, from its end, so each byte moves once.
+ *
+ * @param buf Buffer to edit
+ * @param start Offset of the region to escape (up to the end)
+ * @param set Bytes to escape
+ * @return 0 on success, -1 on allocation failure
+ */
+int	strbuf_escape(t_strbuf *buf, size_t start, const char *set)
+{
+	size_t	set_len;
+	size_t	count;
+	size_t	i;
+	size_t	j;
+
+	set_len = ft_strlen(set);
+	count = 0;
+	i = start;
+	while (i < buf->len)
+		count += (ft_memchr(set, buf->data[i++], set_len) != NULL);
+	if (count == 0)
+		return (0);
+	if (strbuf_reserve(buf, count) == -1)
+		return (-1);
+	i = buf->len;
+	j = buf->len + count;
+	while (i > start)
+	{
+		buf->data[--j] = buf->data[--i];
+		if (ft_memchr(set, buf->data[j], set_len))
+			buf->data[--j] = '\\';
+	}
+	buf->len += count;
+	return (0);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strvec.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pafroidu <pafroidu@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:19:46 by pafroidu          #+#    #+#             */
+/*   Updated: 2026/10/19 02:19:46 by pafroidu         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Initialize an empty string array.
+ *
+ * @param vec Array to initialize (no memory is allocated yet)
+ */
+void	strvec_init(t_strvec *vec)
+{
+	vec->items = NULL;
+	vec->len = 0;
+	vec->cap = 0;
+}
+
+/**
+ * @brief Append a string, taking ownership of it.
+ *
+ * The capacity doubles when full and always keeps one slot for the
+ * terminating NULL of strvec_finish().
+ *
+ * @param vec Array to append to
+ * @param str Malloc'ed string (freed on failure; NULL is a failure)
+ * @return 0 on success, -1 on allocation failure
+ */
+int	strvec_push(t_strvec *vec, char *str)
+{
+	char	**items;
+	size_t	cap;
+
+	if (!str)
+		return (-1);
+	if (vec->len + 1 >= vec->cap)
+	{
+		cap = vec->cap * 2;
+		if (cap < 8)
+			cap = 8;
+		items = malloc(sizeof(char *) * cap);
+		if (!items)
+			return (free(str), -1);
+		if (vec->items)
+			ft_memcpy(items, vec->items, sizeof(char *) * vec->len);
+		free(vec->items);
+		vec->items = items;
+		vec->cap = cap;
+	}
+	vec->items[vec->len++] = str;
+	return (0);
+}
+
+/**
+ * @brief Move every string of `src` to the end of `dst`.
+ *
+ * @param dst Destination array
+ * @param src Source array, left empty (its strings are freed on failure)
+ * @return 0 on success, -1 on allocation failure
+ */
+int	strvec_move_all(t_strvec *dst, t_strvec *src)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < src->len)
+	{
+		if (strvec_push(dst, src->items[i++]) == -1)
+		{
+			while (i < src->len)
+				free(src->items[i++]);
+			return (free(src->items), strvec_init(src), -1);
+		}
+	}
+	free(src->items);
+	strvec_init(src);
+	return (0);
+}
+
+/**
+ * @brief NULL-terminate the array and hand it over to the caller.
+ *
+ * @param vec Array to finish (left empty)
+ * @return NULL-terminated array (possibly empty), or NULL on allocation
+ *         failure
+ */
+char	**strvec_finish(t_strvec *vec)
+{
+	char	**items;
+
+	if (!vec->items)
+		vec->items = malloc(sizeof(char *));
+	items = vec->items;
+	if (items)
+		items[vec->len] = NULL;
+	strvec_init(vec);
+	return (items);
+}
+
+/**
+ * @brief Free every string and the array itself.
+ *
+ * @param vec Array to clear (left empty)
+ */
+void	strvec_clear(t_strvec *vec)
+{
+	while (vec->len > 0)
+		free(vec->items[--vec->len]);
+	free(vec->items);
+	strvec_init(vec);
+}
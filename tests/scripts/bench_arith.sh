@@ -0,0 +1,29 @@
+#!/bin/bash
+# Time a counter loop driven by `(( ))`: the condition, the increment and
+# an offset computation are evaluated in the shell process, with no fork.
+# The same script is run by bash as a reference.
+#
+# usage: tests/scripts/bench_arith.sh [iterations]
+
+MINISHELL=${MINISHELL:-./minishell}
+N=${1:-100000}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+{
+	echo 'export i=0 off=0'
+	echo "while ((i < $N)); do ((off += i * 4 + 1)); ((i++)); done"
+	echo 'echo $off'
+} > "$TMP/counter.sh"
+
+run()
+{
+	local start end out
+	start=$(date +%s%N)
+	out=$("$@" < "$TMP/counter.sh")
+	end=$(date +%s%N)
+	echo "$(( (end - start) / N )) ns/iteration (result $out)"
+}
+
+echo "minishell: $(run "$MINISHELL")"
+echo "bash:      $(run bash)"
@@ -0,0 +1,40 @@
+#!/bin/bash
+# Time a case command with many items inside a loop. The patterns are
+# compiled once, when the loop is parsed; each iteration only matches.
+# The case is written on one line so that the time is spent matching,
+# not reading continuation lines. Bash runs the same script for reference.
+#
+# usage: tests/scripts/bench_case.sh [number of items]
+
+MINISHELL=${MINISHELL:-./minishell}
+ITEMS=${1:-50}
+ITER=10000
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+HUNDRED=$(seq -s ' ' 1 100)
+{
+	echo "for i in $HUNDRED; do for j in $HUNDRED; do"
+	printf 'case word$j.txt in'
+	for ((n = 0; n < ITEMS; n++)); do
+		printf ' literal%d) export X=%d;;' "$n" "$n"
+		printf ' pre%d*) export X=%d;;' "$n" "$n"
+		printf ' *.suf%d) export X=%d;;' "$n" "$n"
+		printf ' *in%d*) export X=%d;;' "$n" "$n"
+		printf ' [a-c]?x%d*) export X=%d;;' "$n" "$n"
+	done
+	echo ' *) export X=none;; esac'
+	echo "done; done"
+} > "$TMP/case.sh"
+
+run()
+{
+	local start end
+	start=$(date +%s%N)
+	$1 < "$TMP/case.sh" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / ITER ))
+}
+
+echo "$((ITEMS * 5)) patterns, minishell: $(run "$MINISHELL") ns/iteration"
+echo "$((ITEMS * 5)) patterns, bash:      $(run "bash --norc") ns/iteration"
@@ -0,0 +1,35 @@
+#!/bin/bash
+# Compare calling a shell function with calling the same helper written as
+# an external script. The function body only runs builtins, so a call is
+# an AST walk in the shell process; the script costs a fork and an exec.
+#
+# usage: tests/scripts/bench_functions.sh [hundreds of calls]
+
+MINISHELL=${MINISHELL:-./minishell}
+OUTER=${1:-20}
+CALLS=$((OUTER * 100))
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+printf '#!/bin/sh\necho "[log] $@"\n' > "$TMP/log.sh"
+chmod +x "$TMP/log.sh"
+LOOP="for i in $(seq -s ' ' 1 "$OUTER"); do for j in $(seq -s ' ' 1 100); do"
+{
+	echo 'log() { echo "[log] $@"; }'
+	echo "$LOOP log step \$i \$j; done; done"
+} > "$TMP/function.sh"
+echo "$LOOP $TMP/log.sh step \$i \$j; done; done" > "$TMP/external.sh"
+
+run()
+{
+	local start end
+	start=$(date +%s%N)
+	"$MINISHELL" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / CALLS ))
+}
+
+FUNC_NS=$(run "$TMP/function.sh")
+EXT_NS=$(run "$TMP/external.sh")
+echo "function: $CALLS calls, ${FUNC_NS} ns/call"
+echo "external: $CALLS calls, ${EXT_NS} ns/call"
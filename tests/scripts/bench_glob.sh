@@ -0,0 +1,36 @@
+#!/bin/bash
+# Time pathname expansion over a large directory. The second run expands
+# three patterns on the same line: the directory is read once and the
+# cached listing is matched three times. The last runs expand `**` over a
+# tree of the same number of files, compared with bash -O globstar.
+#
+# usage: tests/scripts/bench_glob.sh [number of files]
+
+MINISHELL=${MINISHELL:-./minishell}
+FILES=${1:-100000}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+mkdir "$TMP/dir"
+(cd "$TMP/dir" && seq -f 'f%06g.log' 1 "$FILES" | xargs touch)
+echo "cd $TMP/dir; echo *.log" > "$TMP/one.sh"
+echo "cd $TMP/dir; echo *.log f*[0-4].log f0000??.log" > "$TMP/three.sh"
+for d in $(seq 1 $((FILES / 400))); do
+	mkdir -p "$TMP/tree/m$((d % 20))/p$d/src"
+	(cd "$TMP/tree/m$((d % 20))/p$d/src" && seq -f 'f%03g.c' 1 400 | xargs touch)
+done
+echo "cd $TMP/tree; echo **/*.c" > "$TMP/tree.sh"
+
+run()
+{
+	local start end
+	start=$(date +%s%N)
+	${2:-$MINISHELL} < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / 1000000 ))
+}
+
+echo "$FILES files, one pattern:    $(run "$TMP/one.sh") ms"
+echo "$FILES files, three patterns: $(run "$TMP/three.sh") ms"
+echo "$FILES files in a tree, **:   $(run "$TMP/tree.sh") ms"
+echo "same with bash -O globstar: $(run "$TMP/tree.sh" "bash -O globstar") ms"
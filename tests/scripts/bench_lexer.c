@@ -0,0 +1,147 @@
+#include "minishell.h"
+#include <time.h>
+#ifdef __x86_64__
+# include <x86intrin.h>
+#endif
+
+/*
+ * Throughput of the lexer kernels, on a long line of typical input and
+ * on a command with two large quoted arguments (base64 and JSON).
+ * Bytes per cycle use the time stamp counter on x86-64 (reference cycles,
+ * independent of frequency scaling); elsewhere only bytes/ns is printed.
+ *
+ * build: make -C tests build TEST=scripts/bench_lexer.c
+ *        (make SIMD=0 first for the scalar scanner)
+ * usage: tests/bin/bench_lexer [size in KiB] [rounds]
+ */
+
+#define SAMPLE "echo plain_word \"double $HOME quoted\" 'single quoted' a|b>out; "
+#define BASE64 "QmFzZTY0IGJsb2IgaW5zaWRlIHF1b3Rlcw+/"
+#define JSON "{\"key\": [1, 2.5, true, null], 'k': \"v\\u00e9\"}, "
+
+static void	fill(char *dst, const char *pattern, size_t size)
+{
+	size_t	len;
+	size_t	i;
+
+	len = strlen(pattern);
+	i = 0;
+	while (i + len <= size)
+	{
+		memcpy(dst + i, pattern, len);
+		i += len;
+	}
+	while (i < size)
+		dst[i++] = 'x';
+}
+
+/* echo '<base64>' "<json with its double quotes removed>" */
+static char	*build_quoted(size_t size)
+{
+	char	*line;
+	size_t	half;
+	size_t	i;
+
+	half = size / 2;
+	line = malloc(size + 16);
+	if (!line)
+		return (NULL);
+	memcpy(line, "echo '", 6);
+	fill(line + 6, BASE64, half);
+	memcpy(line + 6 + half, "' \"", 3);
+	fill(line + 9 + half, JSON, half);
+	for (i = 9 + half; i < 9 + 2 * half; i++)
+		if (line[i] == '"' || line[i] == '\\')
+			line[i] = '\'';
+	strcpy(line + 9 + 2 * half, "\"");
+	return (line);
+}
+
+static double	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+static unsigned long long	cycles(void)
+{
+#ifdef __x86_64__
+	return (__rdtsc());
+#else
+	return (0);
+#endif
+}
+
+static void	report(const char *name, size_t bytes, double ns,
+	unsigned long long cyc)
+{
+	printf("  %-20s %8.3f GB/s", name, bytes / ns);
+	if (cyc)
+		printf("  %6.3f bytes/cycle", (double)bytes / cyc);
+	printf("\n");
+}
+
+static void	bench(const char *title, const char *line, int rounds)
+{
+	t_token_error		err;
+	char				**tokens;
+	size_t				size;
+	int					i;
+	double				start;
+	unsigned long long	c0;
+
+	size = strlen(line);
+	printf("%s (%zu bytes)\n", title, size);
+	start = now_ns();
+	c0 = cycles();
+	for (i = 0; i < rounds; i++)
+		if (has_unclosed_quotes(line))
+			exit(1);
+	report("has_unclosed_quotes", size * rounds, now_ns() - start,
+		cycles() - c0);
+	start = now_ns();
+	c0 = cycles();
+	for (i = 0; i < rounds; i++)
+		free(trim_quotes(line));
+	report("trim_quotes", size * rounds, now_ns() - start, cycles() - c0);
+	start = now_ns();
+	c0 = cycles();
+	for (i = 0; i < rounds; i++)
+	{
+		tokens = ft_split_tokens(line, &err);
+		if (!tokens)
+			exit(1);
+		free_strings_array(tokens);
+	}
+	report("ft_split_tokens", size * rounds, now_ns() - start,
+		cycles() - c0);
+}
+
+int	main(int argc, char **argv)
+{
+	char	*line;
+	size_t	size;
+	int		rounds;
+
+	size = 10 * 1024 * 1024;
+	rounds = 10;
+	if (argc > 1)
+		size = (size_t)atoi(argv[1]) * 1024;
+	if (argc > 2)
+		rounds = atoi(argv[2]);
+	line = malloc(size + 1);
+	if (!line)
+		return (1);
+	fill(line, SAMPLE, size);
+	line[size] = '\0';
+	bench("short words", line, rounds);
+	free(line);
+	line = build_quoted(size);
+	if (!line)
+		return (1);
+	bench("quoted arguments", line, rounds);
+	free(line);
+	return (0);
+}
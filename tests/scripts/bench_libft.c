@@ -0,0 +1,163 @@
+#include "minishell.h"
+#include <time.h>
+
+/*
+ * Time the libft string and memory kernels against glibc at the sizes the
+ * shell sees (env keys, words, lines, file chunks). Each call works on a
+ * buffer of the given length with its terminator or target at the end.
+ *
+ * build: make -C tests build TEST=scripts/bench_libft.c
+ *        (make KERNELS=byte re first for the byte loops)
+ * usage: tests/bin/bench_libft [total MiB per measurement]
+ */
+
+typedef size_t	(*t_kernel)(char *dst, char *src, size_t len);
+
+static size_t	g_sink;
+
+static size_t	run_ft_strlen(char *dst, char *src, size_t len)
+{
+	(void)dst;
+	(void)len;
+	return (ft_strlen(src));
+}
+
+static size_t	run_strlen(char *dst, char *src, size_t len)
+{
+	(void)dst;
+	(void)len;
+	return (strlen(src));
+}
+
+static size_t	run_ft_strchr(char *dst, char *src, size_t len)
+{
+	(void)dst;
+	return ((size_t)ft_strchr(src, src[len - 1]));
+}
+
+static size_t	run_strchr(char *dst, char *src, size_t len)
+{
+	(void)dst;
+	return ((size_t)strchr(src, src[len - 1]));
+}
+
+static size_t	run_ft_strcmp(char *dst, char *src, size_t len)
+{
+	(void)len;
+	return (ft_strcmp(dst, src));
+}
+
+static size_t	run_strcmp(char *dst, char *src, size_t len)
+{
+	(void)len;
+	return (strcmp(dst, src));
+}
+
+static size_t	run_ft_memchr(char *dst, char *src, size_t len)
+{
+	(void)dst;
+	return ((size_t)ft_memchr(src, src[len - 1], len));
+}
+
+static size_t	run_memchr(char *dst, char *src, size_t len)
+{
+	(void)dst;
+	return ((size_t)memchr(src, src[len - 1], len));
+}
+
+static size_t	run_ft_memcpy(char *dst, char *src, size_t len)
+{
+	return ((size_t)ft_memcpy(dst, src, len));
+}
+
+static size_t	run_memcpy(char *dst, char *src, size_t len)
+{
+	return ((size_t)memcpy(dst, src, len));
+}
+
+static size_t	run_ft_memset(char *dst, char *src, size_t len)
+{
+	(void)src;
+	return ((size_t)ft_memset(dst, 'x', len));
+}
+
+static size_t	run_memset(char *dst, char *src, size_t len)
+{
+	(void)src;
+	return ((size_t)memset(dst, 'x', len));
+}
+
+static double	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+static double	measure(t_kernel kernel, char *dst, char *src, size_t len,
+	size_t total)
+{
+	size_t	calls;
+	size_t	i;
+	double	start;
+
+	calls = total / len + 1;
+	start = now_ns();
+	for (i = 0; i < calls; i++)
+		g_sink += kernel(dst, src, len);
+	return ((now_ns() - start) / calls);
+}
+
+static const struct s_pair
+{
+	const char	*name;
+	t_kernel	ft;
+	t_kernel	libc;
+}	g_pairs[] = {
+	{"strlen", run_ft_strlen, run_strlen},
+	{"strchr", run_ft_strchr, run_strchr},
+	{"strcmp", run_ft_strcmp, run_strcmp},
+	{"memchr", run_ft_memchr, run_memchr},
+	{"memcpy", run_ft_memcpy, run_memcpy},
+	{"memset", run_ft_memset, run_memset},
+};
+
+int	main(int argc, char **argv)
+{
+	static const size_t	sizes[] = {8, 32, 128, 1024, 65536, 1 << 20};
+	size_t				total;
+	char				*src;
+	char				*dst;
+	size_t				i;
+	size_t				j;
+	double				ft;
+	double				libc;
+
+	total = 256 << 20;
+	if (argc > 1)
+		total = (size_t)atoi(argv[1]) << 20;
+	src = malloc((1 << 20) + 1);
+	dst = malloc((1 << 20) + 1);
+	if (!src || !dst)
+		return (1);
+	printf("%-8s %8s %12s %12s %8s\n", "kernel", "bytes", "ft ns/call",
+		"libc ns/call", "ft/libc");
+	for (i = 0; i < sizeof(g_pairs) / sizeof(*g_pairs); i++)
+	{
+		for (j = 0; j < sizeof(sizes) / sizeof(*sizes); j++)
+		{
+			memset(src, 'a', sizes[j]);
+			src[sizes[j] - 1] = 'z';
+			src[sizes[j]] = '\0';
+			memcpy(dst, src, sizes[j] + 1);
+			ft = measure(g_pairs[i].ft, dst, src, sizes[j], total);
+			libc = measure(g_pairs[i].libc, dst, src, sizes[j], total);
+			printf("%-8s %8zu %12.1f %12.1f %8.2f\n", g_pairs[i].name,
+				sizes[j], ft, libc, ft / libc);
+		}
+	}
+	free(src);
+	free(dst);
+	return (g_sink == 42);
+}
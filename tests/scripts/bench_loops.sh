@@ -0,0 +1,39 @@
+#!/bin/bash
+# Compare a parsed-once loop with the same work written as unrolled lines.
+# Both run a non-forking builtin, so the difference is the per-line cost
+# of tokenizing and parsing.
+#
+# usage: tests/scripts/bench_loops.sh [unrolled lines]
+
+MINISHELL=${MINISHELL:-./minishell}
+ITER=1000000
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+HUNDRED=$(seq -s ' ' 1 100)
+{
+	echo "for i in $HUNDRED; do"
+	echo "for j in $HUNDRED; do"
+	echo "for k in $HUNDRED; do export X=\$k; done"
+	echo "done"
+	echo "done"
+} > "$TMP/loop.sh"
+
+UNROLLED=${1:-100000}
+for ((n = 0; n < UNROLLED; n++)); do
+	echo "export X=$n"
+done > "$TMP/unrolled.sh"
+
+run()
+{
+	local start end
+	start=$(date +%s%N)
+	"$MINISHELL" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / $2 ))
+}
+
+LOOP_NS=$(run "$TMP/loop.sh" "$ITER")
+LINE_NS=$(run "$TMP/unrolled.sh" "$UNROLLED")
+echo "loop:     $ITER iterations, ${LOOP_NS} ns/iteration"
+echo "unrolled: $UNROLLED lines,      ${LINE_NS} ns/line"
@@ -0,0 +1,27 @@
+#!/bin/bash
+# Time the file name of a path taken with `${p##*/}` and `${p%.*}` against
+# forking basename and sed for it.
+#
+# usage: tests/scripts/bench_param.sh [iterations]
+
+MINISHELL=${MINISHELL:-./minishell}
+COUNT=${1:-2000}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+LOOP="export p=/usr/share/doc/pkg/README.txt; while ((i++ < $COUNT)); do"
+echo "$LOOP echo \${p##*/} \${p%.*}; done" > "$TMP/param.sh"
+echo "$LOOP basename \$p; echo \$p | sed 's/\.[^.]*\$//'; done" \
+	> "$TMP/fork.sh"
+
+run()
+{
+	local start end
+	start=$(date +%s%N)
+	"$MINISHELL" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / COUNT ))
+}
+
+echo "\${p##*/} \${p%.*}:  $COUNT iterations, $(run "$TMP/param.sh") ns each"
+echo "basename + sed:     $COUNT iterations, $(run "$TMP/fork.sh") ns each"
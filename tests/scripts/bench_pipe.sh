@@ -0,0 +1,24 @@
+#!/bin/bash
+# Measure pipeline throughput against the pipe capacity set through
+# MINISHELL_PIPE_SIZE, to pick a value for a host. The stream is made of
+# large writes and large reads, so the pipe size is the limiting factor.
+#
+# usage: tests/scripts/bench_pipe.sh [MiB] [sizes...]
+
+MINISHELL=${MINISHELL:-./minishell}
+MIB=${1:-4096}
+shift
+SIZES=${*:-"65536 262144 1048576"}
+MAX=$(cat /proc/sys/fs/pipe-max-size)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+echo "dd if=/dev/zero bs=1M count=$MIB | dd of=/dev/null bs=1M" > "$TMP/pipe.sh"
+
+echo "pipe-max-size: $MAX"
+for size in $SIZES; do
+	start=$(date +%s%N)
+	MINISHELL_PIPE_SIZE=$size "$MINISHELL" < "$TMP/pipe.sh" > /dev/null 2>&1
+	end=$(date +%s%N)
+	echo "$size: $(( MIB * 1000000000 / (end - start) )) MiB/s"
+done
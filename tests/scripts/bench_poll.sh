@@ -0,0 +1,29 @@
+#!/bin/bash
+# Time one pass of a polling loop (`true`, `sleep 0`, `kill -0 pid`) run
+# with the builtins, then with the external programs, which cost a fork
+# and an exec each.
+#
+# usage: tests/scripts/bench_poll.sh [hundreds of passes]
+
+MINISHELL=${MINISHELL:-./minishell}
+OUTER=${1:-20}
+PASSES=$((OUTER * 100))
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+LOOP="for i in $(seq -s ' ' 1 "$OUTER"); do for j in $(seq -s ' ' 1 100); do"
+echo "$LOOP true; sleep 0; kill -0 $$; done; done" > "$TMP/builtin.sh"
+echo "$LOOP /bin/true; /bin/sleep 0; /bin/kill -0 $$; done; done" \
+	> "$TMP/external.sh"
+
+run()
+{
+	local start end
+	start=$(date +%s%N)
+	"$MINISHELL" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / PASSES ))
+}
+
+echo "builtin:  $PASSES passes, $(run "$TMP/builtin.sh") ns each"
+echo "external: $PASSES passes, $(run "$TMP/external.sh") ns each"
@@ -0,0 +1,30 @@
+#!/bin/bash
+# Compare printf as a builtin, formatted in the shell process, with the
+# same loop calling the external /usr/bin/printf, which costs a fork and
+# an exec per line.
+#
+# usage: tests/scripts/bench_printf.sh [hundreds of lines]
+
+MINISHELL=${MINISHELL:-./minishell}
+OUTER=${1:-100}
+LINES=$((OUTER * 100))
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+LOOP="for i in $(seq -s ' ' 1 "$OUTER"); do for j in $(seq -s ' ' 1 100); do"
+echo "$LOOP printf '%05d %-8s|%x\n' \$j row\$i \$i; done; done" \
+	> "$TMP/builtin.sh"
+echo "$LOOP /usr/bin/printf '%05d %-8s|%x\n' \$j row\$i \$i; done; done" \
+	> "$TMP/external.sh"
+
+run()
+{
+	local start end
+	start=$(date +%s%N)
+	"$MINISHELL" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / $2 ))
+}
+
+echo "builtin:  $LINES lines, $(run "$TMP/builtin.sh" "$LINES") ns each"
+echo "external: $LINES lines, $(run "$TMP/external.sh" "$LINES") ns each"
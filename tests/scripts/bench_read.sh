@@ -0,0 +1,26 @@
+#!/bin/bash
+# Time a `while read` loop over a regular file, read in blocks with the
+# offset moved back after each line, and over a pipe, read byte by byte.
+#
+# usage: tests/scripts/bench_read.sh [thousands of lines]
+
+MINISHELL=${MINISHELL:-./minishell}
+LINES=$((${1:-100} * 1000))
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+seq -f 'line %g of the input file' 1 "$LINES" > "$TMP/input"
+echo "while read a b c; do echo \$c; done < $TMP/input" > "$TMP/file.sh"
+echo "cat $TMP/input | while read a b c; do echo \$c; done" > "$TMP/pipe.sh"
+
+run()
+{
+	local start end
+	start=$(date +%s%N)
+	"$MINISHELL" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / LINES ))
+}
+
+echo "regular file: $LINES lines, $(run "$TMP/file.sh") ns each"
+echo "pipe:         $LINES lines, $(run "$TMP/pipe.sh") ns each"
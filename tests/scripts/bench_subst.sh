@@ -0,0 +1,32 @@
+#!/bin/bash
+# Compare command substitution of a builtin, captured in memory by the
+# shell process, with the same command run as an external program, which
+# costs a pipe, a fork and an exec. A last run measures a large output
+# read back through the pipe.
+#
+# usage: tests/scripts/bench_subst.sh [hundreds of substitutions]
+
+MINISHELL=${MINISHELL:-./minishell}
+OUTER=${1:-20}
+CALLS=$((OUTER * 100))
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+LOOP="for i in $(seq -s ' ' 1 "$OUTER"); do for j in $(seq -s ' ' 1 100); do"
+echo "$LOOP export v=\$(echo step \$i \$j); done; done" > "$TMP/builtin.sh"
+echo "$LOOP export v=\$(/bin/echo step \$i \$j); done; done" > "$TMP/external.sh"
+head -c 16777216 /dev/zero | tr '\0' 'x' > "$TMP/big"
+echo "echo \$(cat $TMP/big)" > "$TMP/large.sh"
+
+run()
+{
+	local start end
+	start=$(date +%s%N)
+	"$MINISHELL" < "$1" > /dev/null
+	end=$(date +%s%N)
+	echo $(( (end - start) / $2 ))
+}
+
+echo "builtin:  $CALLS substitutions, $(run "$TMP/builtin.sh" "$CALLS") ns each"
+echo "external: $CALLS substitutions, $(run "$TMP/external.sh" "$CALLS") ns each"
+echo "16 MiB output: $(run "$TMP/large.sh" 1000000) ms"
@@ -0,0 +1,161 @@
+#ifndef SHELL_RUN_H
+# define SHELL_RUN_H
+
+# include "minishell.h"
+# include <sys/wait.h>
+
+/*
+ * Behaviour checks: each case feeds a script to the shell loop on stdin,
+ * in a forked child working in a scratch directory, and compares what it
+ * wrote on stdout and stderr and its exit status. A NULL expected stream
+ * is not compared.
+ *
+ * Include this from one tests/unit/test_*.c file, call run_case() per
+ * case (or run_script() and run_result() for other checks) and return
+ * run_summary() from main().
+ */
+
+# define RUN_TIMEOUT 10
+
+typedef struct s_case
+{
+	const char	*name;
+	const char	*script;
+	const char	*out;
+	const char	*err;
+	int			status;
+}	t_case;
+
+extern char	**environ;
+
+static int	g_run_failures;
+static int	g_run_count;
+static int	g_run_ready;
+static char	g_run_dir[] = "/tmp/minishell_test.XXXXXX";
+
+/* whole content of a stream, from its start */
+static char	*run_slurp(FILE *f)
+{
+	char	*buf;
+	long	len;
+
+	fflush(f);
+	fseek(f, 0, SEEK_END);
+	len = ftell(f);
+	rewind(f);
+	buf = calloc(len + 1, 1);
+	if (buf && fread(buf, 1, len, f) != (size_t)len)
+		buf[0] = '\0';
+	return (buf);
+}
+
+static void	run_child(FILE *in, FILE *out, FILE *err)
+{
+	t_shell	data;
+
+	if (dup2(fileno(in), STDIN_FILENO) < 0
+		|| dup2(fileno(out), STDOUT_FILENO) < 0
+		|| dup2(fileno(err), STDERR_FILENO) < 0
+		|| chdir(g_run_dir) < 0)
+		_exit(127);
+	fclose(in);
+	fclose(out);
+	fclose(err);
+	alarm(RUN_TIMEOUT);
+	init_shell(&data, environ);
+	setup_signals_interactive();
+	data.status = minishell_loop(&data);
+	cleanup_shell(&data);
+	exit(data.status);
+}
+
+/* run script; returns its exit status, or -1 (with *out / *err unset) */
+static int	run_script(const char *script, char **out, char **err)
+{
+	FILE	*f[3];
+	pid_t	pid;
+	int		st;
+
+	if (!g_run_ready && !mkdtemp(g_run_dir))
+		return (perror("mkdtemp"), -1);
+	g_run_ready = 1;
+	f[0] = tmpfile();
+	f[1] = tmpfile();
+	f[2] = tmpfile();
+	if (!f[0] || !f[1] || !f[2])
+		return (-1);
+	fputs(script, f[0]);
+	fflush(NULL);
+	rewind(f[0]);
+	pid = fork();
+	if (pid == 0)
+		run_child(f[0], f[1], f[2]);
+	if (pid < 0 || waitpid(pid, &st, 0) < 0)
+		return (-1);
+	*out = run_slurp(f[1]);
+	*err = run_slurp(f[2]);
+	fclose(f[0]);
+	fclose(f[1]);
+	fclose(f[2]);
+	if (WIFSIGNALED(st))
+		return (128 + WTERMSIG(st));
+	return (WEXITSTATUS(st));
+}
+
+static void	run_report(const char *what, const char *want, const char *got)
+{
+	printf(RED "    %s: expected [%s] got [%s]" RESET "\n", what, want, got);
+}
+
+/* count a check and print PASS/FAIL; returns ok */
+static int	run_result(const char *name, int ok)
+{
+	printf("%s %s" RESET "\n", ok ? GRN "PASS" : RED "FAIL", name);
+	g_run_count++;
+	g_run_failures += !ok;
+	return (ok);
+}
+
+/* run one case and print PASS/FAIL; returns 1 when it passed */
+static int	run_case(const t_case *c)
+{
+	char	*out;
+	char	*err;
+	int		status;
+	int		ok;
+
+	out = NULL;
+	err = NULL;
+	status = run_script(c->script, &out, &err);
+	ok = run_result(c->name, status == c->status && out && err
+			&& (!c->out || strcmp(out, c->out) == 0)
+			&& (!c->err || strcmp(err, c->err) == 0));
+	if (!ok && c->out && out && strcmp(out, c->out))
+		run_report("stdout", c->out, out);
+	if (!ok && c->err && err && strcmp(err, c->err))
+		run_report("stderr", c->err, err);
+	if (!ok && status != c->status)
+		printf(RED "    status: expected %d got %d" RESET "\n",
+			c->status, status);
+	free(out);
+	free(err);
+	return (ok);
+}
+
+/* remove the scratch directory; returns the process exit status */
+static int	run_summary(void)
+{
+	char	cmd[sizeof(g_run_dir) + 16];
+
+	if (g_run_ready)
+	{
+		snprintf(cmd, sizeof(cmd), "rm -rf %s", g_run_dir);
+		if (system(cmd) != 0)
+			perror(cmd);
+	}
+	printf("%s%d/%d passed" RESET "\n", g_run_failures ? RED : GRN,
+		g_run_count - g_run_failures, g_run_count);
+	return (g_run_failures != 0);
+}
+
+#endif
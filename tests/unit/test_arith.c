@@ -0,0 +1,84 @@
+#include "shell_run.h"
+
+/* $(( )), (( )) and the integer value cached in t_env */
+
+static const t_case	g_cases[] = {
+	{"precedence and grouping",
+		"echo $((1 + 2 * 3)) $(( (1+2)*3 )) $((2**10)) $((1<<4))\n",
+		"7 9 1024 16\n", "", 0},
+	{"division, modulo, comparisons",
+		"echo $((7/2)) $((-7%3)) $((5>3)) $((1&&0)) $((!0)) $((~0))\n",
+		"3 -1 1 0 1 -1\n", "", 0},
+	{"octal and hex constants", "echo $((0x1f)) $((010))\n", "31 8\n", "", 0},
+	{"64-bit wrap around", "echo $((9223372036854775807 + 1))\n",
+		"-9223372036854775808\n", "", 0},
+	{"variables", "export x=5\necho $((x+1)) $((x*x))\n", "6 25\n", "", 0},
+	{"cache follows export",
+		"export x=5\necho $((x))\nexport x=7\necho $((x+1)) $x\n",
+		"5\n8 7\n", "", 0},
+	{"cache follows for",
+		"export i=100\necho $((i))\nfor i in 1 2; do echo $((i * 10)); done\n"
+		"echo $((i + 1))\n", "100\n10\n20\n3\n", "", 0},
+	{"cache follows unset", "export i=3\necho $((i))\nunset i\necho $((i+1))\n",
+		"3\n1\n", "", 0},
+	{"assignment operators",
+		"export x=7\n(( x++ ))\necho $x\n(( x += 10 ))\necho $x $((x))\n"
+		"(( x <<= 1 ))\necho $x\n", "8\n18 18\n36\n", "", 0},
+	{"loop counter",
+		"export c=0\nfor i in 1 2 3 4 5; do (( c += i )); done\necho $c\n",
+		"15\n", "", 0},
+	{"variable holding an expression", "export e=x+1 x=4\necho $((e*2))\n",
+		"10\n", "", 0},
+	{"octal variable value", "export x=010\necho $((x)) $((x+0))\n",
+		"8 8\n", "", 0},
+	{"bad octal variable value", "export x=08\necho $((x))\necho $?\n",
+		"1\n", "[mini$HELL]: 08: value too great for base\n", 0},
+	{"unset and blank variables are 0",
+		"export b=\" \"\necho $((nope + 1)) $((b + 2))\n", "1 2\n", "", 0},
+	{"(( )) status", "(( 0 ))\necho $?\n(( 3 ))\necho $?\n", "1\n0\n", "", 0},
+	{"division by zero", "echo $((1/0))\necho $?\n", "1\n",
+		"[mini$HELL]: 1/0: division by 0\n", 0},
+	{"syntax error", "echo $(( 1 + ))\necho $?\n", "1\n",
+		"[mini$HELL]:  1 + : syntax error in expression\n", 0},
+	{"a variable holding a bad expression",
+		"export x=\"1 +\" y=\"x * 2\"\necho $((x + 1))\necho $(( y ))\n"
+		"echo $?\n", "1\n", "[mini$HELL]: 1 +: syntax error in expression\n"
+		"[mini$HELL]: 1 +: syntax error in expression\n", 0},
+};
+
+/* the parsed value is kept in t_env until the variable changes */
+static void	check_cache(void)
+{
+	t_shell		data;
+	t_env		*env;
+	long long	value;
+	int			ok;
+
+	init_shell(&data, (char *[]){"N=41", NULL});
+	env = get_env_node_by_key(data.env_list, "N");
+	ok = env && !env->num_valid;
+	ok = ok && arith_evaluate("N + 1", &data, 0, &value) == 0 && value == 42;
+	ok = ok && env->num_valid && env->num == 41;
+	ok = ok && set_env_node(&data.env_list, "N=9") == 0;
+	env = get_env_node_by_key(data.env_list, "N");
+	ok = ok && env && !env->num_valid;
+	ok = ok && arith_evaluate("N++", &data, 0, &value) == 0 && value == 9;
+	env = get_env_node_by_key(data.env_list, "N");
+	ok = ok && env && env->num_valid && env->num == 10
+		&& strcmp(env->value, "10") == 0;
+	cleanup_shell(&data);
+	printf("%s cached integer value" RESET "\n", ok ? GRN "PASS" : RED "FAIL");
+	g_run_count++;
+	g_run_failures += !ok;
+}
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== ARITHMETIC TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	check_cache();
+	return (run_summary());
+}
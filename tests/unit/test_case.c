@@ -0,0 +1,65 @@
+#include "shell_run.h"
+
+/* case: pattern shapes, quoting, alternatives and the (pat) form */
+
+#define SHAPES "case $w in (apple) echo \"1 $w\";; *.c) echo \"2 $w\";;"
+#define SHAPES2 " \"a b\") echo \"3 $w\";; '*') echo \"4 lit\";;"
+#define SHAPES3 " [0-9]) echo \"5 $w\";; '') echo \"6 empty\";;"
+#define SHAPES4 " [!a-z]) echo \"7 $w\";; *) echo \"8 $w\";; esac"
+
+static const t_case	g_cases[] = {
+	{"pattern shapes",
+		"for w in apple b.c \"a b\" x '*' 7 \"\" Z; do "
+		SHAPES SHAPES2 SHAPES3 SHAPES4 "; done\n",
+		"1 apple\n2 b.c\n3 a b\n8 x\n4 lit\n5 7\n6 empty\n7 Z\n", "", 0},
+	{"first matching item wins", "case ab in a*) echo 1;; ab) echo 2;; esac\n",
+		"1\n", "", 0},
+	{"alternatives", "case abc in a|x) echo no;; x|ab?|y) echo alt;; esac\n",
+		"alt\n", "", 0},
+	{"(pat) form with alternatives",
+		"case y in (x|y) echo paren;; esac\n", "paren\n", "", 0},
+	{"quoted wildcards are literal",
+		"case abc in \"a*c\") echo no;; a'*'c) echo no;; a*c) echo glob;;"
+		" esac\n"
+		"case 'a*c' in \"a*c\") echo lit;; esac\n", "glob\nlit\n", "", 0},
+	{"unquoted expansion keeps its wildcards",
+		"export p='a*'\ncase abc in $p) echo varpat;; esac\n"
+		"case abc in \"$p\") echo no;; *) echo quotedvar;; esac\n",
+		"varpat\nquotedvar\n", "", 0},
+	{"expanded word", "case \"$HOME\" in /*) echo abs;; esac\n", "abs\n",
+		"", 0},
+	{"brackets", "case b in [abc]) echo br;; esac\ncase ']' in []]) echo rb;;"
+		" esac\ncase - in [a-]) echo dash;; esac\n", "br\nrb\ndash\n", "", 0},
+	{"status: no match and empty body",
+		"case x in y) echo no;; esac; echo $?\ncase x in x) ;; esac; echo $?\n",
+		"0\n0\n", "", 0},
+	{"character classes",
+		"for w in b 5 ' ' _ x9; do case \"$w\" in [[:alpha:]]) echo \"$w a\";;"
+		" [[:digit:]]) echo \"$w d\";; [[:space:]]) echo s;;"
+		" [![:alnum:]]) echo \"$w o\";; *) echo \"$w n\";; esac; done\n"
+		"case 7 in [a[:digit:]z]) echo mixed;; esac\n"
+		"case x in [[:foo:]]) echo bad;; *) echo unknown;; esac\n",
+		"b a\n5 d\ns\n_ o\nx9 n\nmixed\nunknown\n", "", 0},
+	{"status of the matching body",
+		"case x in x) false;; esac; echo $?\n", "1\n", "", 0},
+	{"multi-line case",
+		"case a in\n  a)\n    echo multi\n    ;;\n  b) echo no\nesac\n",
+		"multi\n", "", 0},
+	{"last item without ;;", "case x in x) echo last\nesac\n", "last\n",
+		"", 0},
+	{"case in a function",
+		"f() { case $1 in -*) echo opt;; *) echo arg;; esac; }\nf -v\nf v\n",
+		"opt\narg\n", "", 0},
+	{"missing esac", "case x in x) echo no;;\n", "",
+		"[mini$HELL]: syntax error: unexpected end of file\n", 2},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== CASE TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
@@ -0,0 +1,61 @@
+#include "shell_run.h"
+
+/*
+ * The cat builtin picks a copy call per fd pair: copy_file_range() for
+ * file to file, splice() around pipes, a read()/write() loop otherwise
+ * or when the kernel refuses. Every path must copy the same bytes.
+ */
+
+#define SETUP "seq 1 200000 > big; printf 'x\\ny\\n' > small; mkdir -p dir\n"
+#define CMP_OK "cmp - c; echo $?\n"
+
+static const t_case	g_cases[] = {
+	{"file to file", SETUP "cat big > c; cmp big c; echo $?\n", "0\n", "", 0},
+	{"several files to a file",
+		SETUP "cat small big small > c; cat small big small | " CMP_OK,
+		"0\n", "", 0},
+	{"file to a pipe", SETUP "cat big small | wc -l\n", "200002\n", "", 0},
+	{"pipe to a pipe", SETUP "seq 1 200000 | cat | cmp - big; echo $?\n",
+		"0\n", "", 0},
+	{"pipe to a file", SETUP "seq 1 200000 | cat > c; cmp big c; echo $?\n",
+		"0\n", "", 0},
+	{"standard input redirected from a file",
+		SETUP "cat < big > c; cmp big c; echo $?\n", "0\n", "", 0},
+	{"- operand between files", SETUP "seq 1 3 | cat small - small\n",
+		"x\ny\n1\n2\n3\nx\ny\n", "", 0},
+	{"appending output uses the fallback loop",
+		SETUP "echo pre > c; cat big >> c; echo pre | cat - big | " CMP_OK,
+		"0\n", "", 0},
+	{"character device output", SETUP "cat big > /dev/null; echo $?\n",
+		"0\n", "", 0},
+	{"copy starts at the input offset",
+		SETUP "f() { head -n 1 > /dev/null; cat; }\nf < small\n", "y\n",
+		"", 0},
+	{"empty input", SETUP "cat /dev/null > c; wc -c < c\n", "0\n", "", 0},
+	{"input file is output file", SETUP "cat small >> small; echo $?\n",
+		"1\n", "[mini$HELL]: cat: small: input file is output file\n", 0},
+	{"truncated output file is empty input",
+		SETUP "cat small > small; echo $?; wc -c < small\n", "0\n0\n", "", 0},
+	{"missing operand, next one still copied",
+		SETUP "cat missing small; echo $?\n", "x\ny\n1\n",
+		"[mini$HELL]: cat: missing: No such file or directory\n", 0},
+	{"directory operand", SETUP "cat dir; echo $?\n", "1\n",
+		"[mini$HELL]: cat: dir: Is a directory\n", 0},
+	{"closed standard output", SETUP "cat small 1>&-; echo $?\n", "1\n",
+		"[mini$HELL]: cat: standard output: Bad file descriptor\n", 0},
+	{"-u and --", SETUP "cat -u small -- small\n", "x\ny\nx\ny\n", "", 0},
+	{"other options run the cat program", SETUP "cat -n small\n",
+		"     1\tx\n     2\ty\n", "", 0},
+	{"early exit of the reader", SETUP "cat big small | head -1\n", "1\n",
+		"", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== CAT TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
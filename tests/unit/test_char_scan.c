@@ -0,0 +1,162 @@
+#include "minishell.h"
+#include <sys/mman.h>
+
+/*
+ * Check the byte class table against the character lists it encodes, and
+ * fuzz the stop scanners (scalar, SSE2, AVX2 when the CPU has it) and
+ * plain_run_length() against a plain byte loop. Every string ends right
+ * before a PROT_NONE page, so every alignment and run length is tried
+ * next to a page end, with runs crossing 16 and 32 byte blocks.
+ *
+ * usage: tests/bin/unit/test_char_scan [iterations]
+ */
+
+#define GUARD_PAGE 4096
+#define MAX_LEN 300
+#define OPERATORS "|<>;()"
+
+static char	*g_page;
+static int	g_failures;
+
+static const unsigned short	g_stops[] = {CC_NUL | CC_SQUOTE,
+	CC_NUL | CC_DQUOTE | CC_DOLLAR, CC_NUL | CC_QUOTE | CC_DOLLAR,
+	CC_NUL | CC_QUOTE | CC_DOLLAR | CC_SEP};
+
+static void	check(int ok, const char *name, size_t len, unsigned short stop)
+{
+	if (ok)
+		return ;
+	if (g_failures++ < 20)
+		printf("FAIL %s len=%zu stop=%#x\n", name, len, stop);
+}
+
+/* the classes each byte must have, from the lists in char_class.c */
+static unsigned short	expected_class(int c)
+{
+	unsigned short	cc;
+	int				space;
+	int				op;
+
+	space = (c == ' ' || (c >= '\t' && c <= '\r'));
+	op = (c != 0 && strchr(OPERATORS, c) != NULL);
+	cc = (c == 0) * CC_NUL | space * CC_SPACE;
+	cc |= (space && c != '\n') * CC_BLANK | (space || op) * CC_SEP;
+	cc |= (op || c == '\n') * CC_OP | (c == '\'') * CC_SQUOTE;
+	cc |= (c == '"') * CC_DQUOTE | (c == '$') * CC_DOLLAR;
+	cc |= (c == '_' || (c < 128 && isalpha(c))) * CC_VAR_START;
+	cc |= (c == '_' || (c < 128 && isalnum(c))) * CC_VAR_CHAR;
+	cc |= (c != 0 && strchr("*?[", c) != NULL) * CC_GLOB;
+	return (cc);
+}
+
+static size_t	byte_scan(const char *s, unsigned short stop)
+{
+	size_t	i;
+
+	i = 0;
+	while (!(expected_class((unsigned char)s[i]) & stop))
+		i++;
+	return (i);
+}
+
+/* a string of len bytes ending at the guard page, mostly long runs */
+static char	*place(size_t len)
+{
+	static const char	run[] = "aaaaaaaab_9Z\x80\xff";
+	static const char	stop[] = " \t\n|<>;()'\"$";
+	char				*s;
+	size_t				i;
+
+	s = g_page + GUARD_PAGE - len - 1;
+	for (i = 0; i < len; i++)
+	{
+		s[i] = run[rand() % (sizeof(run) - 1)];
+		if (rand() % 24 == 0)
+			s[i] = stop[rand() % (sizeof(stop) - 1)];
+	}
+	s[len] = '\0';
+	return (s);
+}
+
+static void	check_scanners(size_t len)
+{
+	const char		*s;
+	unsigned short	stop;
+	size_t			want;
+	size_t			i;
+
+	s = place(len);
+	for (i = 0; i < sizeof(g_stops) / sizeof(g_stops[0]); i++)
+	{
+		stop = g_stops[i];
+		want = byte_scan(s, stop);
+		check(scan_stop_scalar(s, stop) == want, "scalar", len, stop);
+#if defined(__x86_64__)
+		check(scan_stop_sse2(s, stop) == want, "sse2", len, stop);
+		if (__builtin_cpu_supports("avx2"))
+			check(scan_stop_avx2(s, stop) == want, "avx2", len, stop);
+#endif
+	}
+	check(plain_run_length(s, STATE_IN_SINGLE_QUOTE, true)
+		== byte_scan(s, g_stops[0]), "plain_run_length '", len, g_stops[0]);
+	check(plain_run_length(s, STATE_IN_DOUBLE_QUOTE, true)
+		== byte_scan(s, g_stops[1]), "plain_run_length \"", len, g_stops[1]);
+	check(plain_run_length(s, STATE_NOT_IN_QUOTE, false)
+		== byte_scan(s, g_stops[2]), "plain_run_length", len, g_stops[2]);
+	check(plain_run_length(s, STATE_NOT_IN_QUOTE, true)
+		== byte_scan(s, g_stops[3]), "plain_run_length sep", len, g_stops[3]);
+}
+
+/* one stop byte after runs of every length, at every block offset */
+static void	check_block_edges(void)
+{
+	char	*s;
+	size_t	len;
+	size_t	run;
+
+	for (len = 1; len <= 96; len++)
+	{
+		for (run = 0; run < len; run++)
+		{
+			s = g_page + GUARD_PAGE - len - 1;
+			memset(s, 'a', len);
+			s[run] = "$'\"|"[run % 4];
+			s[len] = '\0';
+			check(scan_stop_scalar(s, g_stops[3]) == run, "scalar edge", len,
+				g_stops[3]);
+#if defined(__x86_64__)
+			check(scan_stop_sse2(s, g_stops[3]) == run, "sse2 edge", len,
+				g_stops[3]);
+			if (__builtin_cpu_supports("avx2"))
+				check(scan_stop_avx2(s, g_stops[3]) == run, "avx2 edge", len,
+					g_stops[3]);
+#endif
+		}
+	}
+}
+
+int	main(int argc, char **argv)
+{
+	long	iterations;
+	long	i;
+	int		c;
+
+	iterations = 100000;
+	if (argc > 1)
+		iterations = atol(argv[1]);
+	for (c = 0; c < 256; c++)
+		check(g_char_class[c] == expected_class(c), "g_char_class", c, 0);
+	g_page = mmap(NULL, 2 * GUARD_PAGE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (g_page == MAP_FAILED
+		|| mprotect(g_page + GUARD_PAGE, GUARD_PAGE, PROT_NONE))
+		return (1);
+	srand(42);
+	check_block_edges();
+	for (i = 0; i < iterations; i++)
+		check_scanners(rand() % MAX_LEN);
+	printf("char scanners: %ld iterations, %d failures\n", iterations,
+		g_failures);
+	munmap(g_page, 2 * GUARD_PAGE);
+	return (g_failures != 0);
+}
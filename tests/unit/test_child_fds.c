@@ -0,0 +1,37 @@
+#include "shell_run.h"
+
+/*
+ * The descriptors the shell holds while it runs a command (saved std
+ * fds, pipes, here-document stores, substitution captures) are
+ * close-on-exec, so children see none of them. FD_LIST prints a child's
+ * open fds, where 3 is the directory ls itself reads.
+ */
+
+#define FD_LIST "ls /proc/self/fd | tr '\\n' ' '"
+
+static const t_case	g_cases[] = {
+	{"a plain command", FD_LIST "; echo\n", "0 1 2 3 \n", "", 0},
+	{"inside a command substitution",
+		"echo \"[$(" FD_LIST ")]\"\necho \"[$(echo x; " FD_LIST ")]\"\n",
+		"[0 1 2 3 ]\n[x\n0 1 2 3 ]\n", "", 0},
+	{"reading a here-document",
+		"ls /proc/self/fd << E | tr '\\n' ' '; echo\nbody\nE\n",
+		"0 1 2 3 \n", "", 0},
+	{"in a pipeline", "echo | " FD_LIST " | cat; echo\n", "0 1 2 3 \n", "",
+		0},
+	{"under a redirected group, function or loop",
+		"echo l > in; { " FD_LIST "; } > o; cat o; echo\n"
+		"f() { " FD_LIST "; echo; }; f < in\n"
+		"for i in 1; do echo \"$(" FD_LIST ")\" | cat; done > o; cat o\n",
+		"0 1 2 3 \n0 1 2 3 \n0 1 2 3 \n", "", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== CHILD DESCRIPTOR TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
@@ -0,0 +1,59 @@
+#include "shell_run.h"
+
+/*
+ * $( ): echo and pwd alone are captured in the shell process, anything
+ * else runs in a child. Both must give the same words and statuses.
+ */
+
+static const t_case	g_cases[] = {
+	{"in shell: echo", "echo \"<$(echo hi)>\"\n", "<hi>\n", "", 0},
+	{"in shell: echo -n then echo", "echo \"<$(echo -n a)$(echo b)>\"\n",
+		"<ab>\n", "", 0},
+	{"in shell: pwd", "cd /\necho \"<$(pwd)>\"\n", "</>\n", "", 0},
+	{"in shell: quotes and $ in the output are kept",
+		"echo \"<$(echo '$HOME \"q\"')>\"\n", "<$HOME \"q\">\n", "", 0},
+	{"child: a list of commands", "echo \"<$(echo a; echo b)>\"\n",
+		"<a\nb>\n", "", 0},
+	{"child: external command", "echo \"<$(/bin/echo child)>\"\n",
+		"<child>\n", "", 0},
+	{"child: pipeline", "echo \"<$(echo one | tr a-z A-Z)>\"\n",
+		"<ONE>\n", "", 0},
+	{"child: trailing newlines trimmed", "echo \"<$(printf 'x\\n\\n\\n')>\"\n",
+		"<x>\n", "", 0},
+	{"child: stderr is not captured",
+		"echo \"<$(sh -c 'echo err >&2')>\"\n",
+		"<>\n", "err\n", 0},
+	{"child: redirected echo",
+		"echo \"<$(echo x > sub_out)>\"\ncat sub_out\n", "<>\nx\n", "", 0},
+	{"child: function", "f() { echo fn$1; }\necho \"<$(f 1)>\"\n",
+		"<fn1>\n", "", 0},
+	{"child: recursive function",
+		"fact() { while [ $1 -eq 0 ]; do echo 1; return; done;"
+		" echo $(( $1 * $(fact $(( $1 - 1 ))) )); }\nfact 5\n", "120\n", "",
+		0},
+	{"child: large output", "echo \"$(seq 1 100000)\" | tail -1\n",
+		"100000\n", "", 0},
+	{"status of the substitution",
+		"echo \"<$(exit 3)>\" $?\necho \"<$(false)>\" $?\n",
+		"<> 3\n<> 1\n", "", 0},
+	{"command not found", "echo \"<$(nosuchcmd)>\" $?\n", "<> 127\n",
+		"nosuchcmd: command not found\n", 0},
+	{"nested", "echo \"<$(echo $(echo nested))>\"\n", "<nested>\n", "", 0},
+	{"no side effects on the shell",
+		"echo \"<$(cd /; export zz=1; exit 4)>\"$zz\npwd | grep -c /tmp/\n",
+		"<>\n1\n", "", 0},
+	{"assignments in a substitution stay in it",
+		"echo $(echo ${QX:=set}); echo \"[$QX]\"\n"
+		"echo $(echo ${QY=v}); echo \"[$QY]\"\n", "set\n[]\nv\n[]\n", "", 0},
+	{"value of export", "export v=$(echo val)\necho $v\n", "val\n", "", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== COMMAND SUBSTITUTION TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
@@ -0,0 +1,62 @@
+#include "shell_run.h"
+
+/*
+ * The environment list is kept sorted by key and each exported variable
+ * is one KEY=value entry, passed to execve() as the envp of children.
+ */
+
+/* keys only: a value may hold newlines */
+#define SORTED_CHECK "export LC_ALL=C\n" \
+	"env | grep -o '^[A-Za-z_][A-Za-z0-9_]*=' | sort -c; echo $?\n"
+
+static const t_case	g_cases[] = {
+	{"env lists variables sorted by key",
+		"export ZB=2 AA=1 M=mid\nenv | grep -E '^(AA|M|ZB)='\n",
+		"AA=1\nM=mid\nZB=2\n", "", 0},
+	{"whole environment sorted", "export zz=1 AAA=2 _x=3\n" SORTED_CHECK,
+		"0\n", "", 0},
+	{"export lists variables sorted by key",
+		"export ZB=2 AA=1 M=mid\nexport | grep -E ' (AA|M|ZB)='\n",
+		"declare -x AA=\"1\"\ndeclare -x M=\"mid\"\ndeclare -x ZB=\"2\"\n",
+		"", 0},
+	{"children get the same environment",
+		"export B=2 A=1\nenv > e1\n/usr/bin/env > e2\ncmp e1 e2; echo $?\n",
+		"0\n", "", 0},
+	{"changed value in envp",
+		"export AA=1\nexport AA=changed\n/usr/bin/env | grep '^AA='\n",
+		"AA=changed\n", "", 0},
+	{"appended value in envp",
+		"export AA=1\nexport AA+=2\n/usr/bin/env | grep '^AA='\n",
+		"AA=12\n", "", 0},
+	{"unset removes the entry",
+		"export M=1\nunset M\n/usr/bin/env | grep -c '^M='\n", "0\n", "", 1},
+	{"empty value", "export EMPTY=\n/usr/bin/env | grep '^EMPTY='\n",
+		"EMPTY=\n", "", 0},
+	{"value with =", "export X=a=b\n/usr/bin/env | grep '^X='\n", "X=a=b\n",
+		"", 0},
+	{"variable without a value is not in envp",
+		"export NOVAL\n/usr/bin/env | grep -c '^NOVAL'\nexport | grep NOVAL\n",
+		"0\ndeclare -x NOVAL\n", "", 0},
+	{"export NAME keeps the value exported",
+		"export B=2\nexport B\n/usr/bin/env | grep '^B='\necho $B\n",
+		"B=2\n2\n", "", 0},
+	{"loop variable in envp",
+		"for V in 1 2; do /usr/bin/env | grep '^V='; done\n", "V=1\nV=2\n",
+		"", 0},
+	{"invalid identifier",
+		"export 1bad=x\necho $?\n", "1\n",
+		"[mini$HELL]: export: `1bad=x': not a valid identifier\n", 0},
+	{"PATH is read from the environment",
+		"export PATH=/nonexistent\nls\necho $?\n", "127\n",
+		"ls: command not found\n", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== ENVIRONMENT TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
@@ -0,0 +1,50 @@
+#include "shell_run.h"
+
+/*
+ * exec: without a command its redirections stay on the shell, with one
+ * the shell is replaced by it.
+ */
+
+static const t_case	g_cases[] = {
+	{"open a fd for the rest of the script",
+		"exec 3> fd3; echo to3 >&3; echo more >&3; cat fd3\n",
+		"to3\nmore\n", "", 0},
+	{"close a fd",
+		"exec 3> fd3; exec 3>&-; echo z >&3; echo $?\n", "1\n",
+		"[mini$HELL]: 3: Bad file descriptor\n", 0},
+	{"read a fd opened by exec",
+		"printf 'a\\nb\\n' > in4\nexec 4<in4; head -n 1 <&4\n"
+		"head -n 1 <&4\nexec 4<&-\n", "a\nb\n", "", 0},
+	{"save, redirect and restore stdout",
+		"exec 5>&1; exec > eo; echo inside; exec 1>&5 5>&-; echo back\n"
+		"cat eo\n", "back\ninside\n", "", 0},
+	{"redirect stderr for good",
+		"exec 2>/dev/null; cd /nope; echo $?\n", "1\n", "", 0},
+	{"several fds at once",
+		"exec 6>x6 7>x7; echo a >&6; echo b >&7; exec 6>&- 7>&-; cat x6 x7\n",
+		"a\nb\n", "", 0},
+	{"dup of stdout", "exec 8>&1; echo via8 >&8\n", "via8\n", "", 0},
+	{"no arguments", "exec\necho $?\n", "0\n", "", 0},
+	{"children inherit fds opened by exec",
+		"exec 3>o\nls /proc/self/fd | wc -l\nexec 3>&-\n"
+		"ls /proc/self/fd | wc -l\n", "5\n4\n", "", 0},
+	{"failed redirection", "exec 3< /nonexistent\necho $?\n", "1\n",
+		"/nonexistent: No such file or directory\n", 0},
+	{"command replaces the shell", "exec echo hi\necho no\n", "hi\n", "", 0},
+	{"status of the replacing command",
+		"exec sh -c 'exit 3'\necho no\n", "", "", 3},
+	{"command with redirections",
+		"exec sh -c 'echo out; echo err >&2' 2>&1\n", "out\nerr\n", "", 0},
+	{"command not found", "exec nosuchcmd\necho never\n", "",
+		"nosuchcmd: command not found\n", 127},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== EXEC TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
@@ -0,0 +1,43 @@
+#include "shell_run.h"
+
+/* shell functions: positional parameters, return and recursion */
+
+static const t_case	g_cases[] = {
+	{"positional parameters", "f() { echo \"$#:$1:$2:$@\"; }\nf a b c\n",
+		"3:a:b:a b c\n", "", 0},
+	{"caller parameters outside the call",
+		"f() { echo $1; }\nf x\necho \"top:$#:$1\"\n", "x\ntop:0:\n", "", 0},
+	{"nested call restores the parameters",
+		"g() { echo g:$1; }\nf() { g inner; echo f:$1:$#; }\nf outer two\n",
+		"g:inner\nf:outer:2\n", "", 0},
+	{"quoted argument stays one parameter",
+		"x() { echo \"[$1]\"; }\nx \"a b\" c\n", "[a b]\n", "", 0},
+	{"return status", "g() { echo in; return 3; echo no; }\ng; echo $?\n",
+		"in\n3\n", "", 0},
+	{"return status modulo 256", "y() { return 300; }\ny; echo $?\n",
+		"44\n", "", 0},
+	{"return outside a function", "return\necho $?\n", "2\n",
+		"[mini$HELL]: return: can only `return' from a function\n", 0},
+	{"recursion unwinds in order",
+		"rec() { while [ -n \"$1\" ]; do echo d$1; rec $2 $3 $4; echo u$1;"
+		" break; done; }\nrec 0 1 2\n", "d0\nd1\nd2\nu2\nu1\nu0\n", "", 0},
+	{"function defined by a function",
+		"n() { m() { echo inner; }; }\nn; m\n", "inner\n", "", 0},
+	{"redefinition replaces the body",
+		"f() { echo one; }\nf() { echo two; }\nf\n", "two\n", "", 0},
+	{"function in a pipeline", "k() { echo k; }\nk | cat\n", "k\n", "", 0},
+	{"multi-line body", "fun() {\necho multi $1\n}\nfun line\n",
+		"multi line\n", "", 0},
+	{"function status is the last command",
+		"f() { false; }\nf\necho $?\n", "1\n", "", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== FUNCTION TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
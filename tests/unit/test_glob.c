@@ -0,0 +1,55 @@
+#include "shell_run.h"
+
+/*
+ * Pathname expansion and the directory cache: a listing read earlier on
+ * the same line must be read again once the directory changed.
+ */
+
+static const t_case	g_cases[] = {
+	{"star, question mark and brackets",
+		"mkdir g1; cd g1; touch a1 a2 b1 .h\n"
+		"echo a* ?1 a[12] a[!1] [ab]1\n",
+		"a1 a2 a1 b1 a1 a2 a2 a1 b1\n", "", 0},
+	{"character classes",
+		"mkdir g11; cd g11; touch a1 B2 3c _d\necho [[:lower:]]*"
+		" [[:digit:]]* *[[:digit:]] [![:alpha:]]* [[:upper:][:digit:]]2\n",
+		"a1 3c B2 a1 3c _d B2\n", "", 0},
+	{"character class in a path", "echo /etc/[[:alpha:]]osts\n",
+		"/etc/hosts\n", "", 0},
+	{"sorted, hidden files only with a leading dot",
+		"mkdir g2; cd g2; touch c b a .h\necho * .*\n", "a b c .h\n", "", 0},
+	{"no match keeps the word",
+		"mkdir g3; cd g3\necho nomatch* [\n", "nomatch* [\n", "", 0},
+	{"quoted wildcards are literal",
+		"mkdir g4; cd g4; touch g1\necho \"g*\" 'g*' g\\*\n",
+		"g* g* g*\n", "", 0},
+	{"trailing slash matches directories only",
+		"mkdir g5; cd g5; mkdir d1 d2; touch f1\necho */\n",
+		"d1/ d2/\n", "", 0},
+	{"path components",
+		"mkdir -p g6/x/y g6/z/y; touch g6/x/y/f g6/z/y/f\necho g6/*/y/f\n",
+		"g6/x/y/f g6/z/y/f\n", "", 0},
+	{"file created later on the same line",
+		"mkdir g7; cd g7\ntouch g1; echo g*; touch g2; echo g*\n",
+		"g1\ng1 g2\n", "", 0},
+	{"file removed later on the same line",
+		"mkdir g8; cd g8\ntouch g1 g2; echo g*; rm g1; echo g*\n",
+		"g1 g2\ng2\n", "", 0},
+	{"directory replaced on the same line",
+		"mkdir -p g9/d; touch g9/d/old\n"
+		"echo g9/d/*; rm -r g9/d; mkdir g9/d; touch g9/d/new; echo g9/d/*\n",
+		"g9/d/old\ng9/d/new\n", "", 0},
+	{"expansion inside a loop sees each change",
+		"mkdir g10; cd g10\nfor i in 1 2 3; do touch f$i; echo f*; done\n",
+		"f1\nf1 f2\nf1 f2 f3\n", "", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== GLOB TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
@@ -0,0 +1,54 @@
+#include "shell_run.h"
+
+/* recursive ** globbing, as bash -O globstar */
+
+#define TREE "mkdir -p d/e/f d/.hid; touch d/a.c d/e/b.c d/e/f/c.c d/.hid/h.c"
+#define LINKS "; ln -s e d/link; ln -s ../.. d/e/up\n"
+
+static const t_case	g_cases[] = {
+	{"**/ matches any number of levels",
+		"mkdir s1; cd s1; " TREE "\necho **/*.c d/**/*.c\n",
+		"d/a.c d/e/b.c d/e/f/c.c d/a.c d/e/b.c d/e/f/c.c\n", "", 0},
+	{"final ** lists every entry",
+		"mkdir s2; cd s2; " TREE "; touch x\necho ** d/**\n",
+		"d d/a.c d/e d/e/b.c d/e/f d/e/f/c.c x d/ d/a.c d/e d/e/b.c d/e/f"
+		" d/e/f/c.c\n", "", 0},
+	{"**/ with a trailing slash lists directories",
+		"mkdir s3; cd s3; " TREE "\necho d/**/\n", "d/ d/e/ d/e/f/\n", "", 0},
+	{"** between literal components",
+		"mkdir s4; cd s4; " TREE "\necho d/**/f d/**/f/c.c\n",
+		"d/e/f d/e/f/c.c\n", "", 0},
+	{"** next to other characters is a plain star",
+		"mkdir s5; cd s5; " TREE "\necho d/e**\n", "d/e\n", "", 0},
+	{"symlinks below a named directory count as one level",
+		"mkdir s6; cd s6; " TREE LINKS "echo d/**/*.c\necho d/**/\n",
+		"d/a.c d/e/b.c d/e/f/c.c d/link/b.c\n"
+		"d/ d/e/ d/e/f/ d/e/up/ d/link/\n", "", 0},
+	{"a leading ** does not match inside symlinks",
+		"mkdir s11; cd s11; mkdir -p d/real; touch top.c d/real/1.c;"
+		" ln -s real d/link\necho **/*.c\necho **/1.c\necho d/**/1.c\n",
+		"d/real/1.c top.c\nd/real/1.c\nd/link/1.c d/real/1.c\n", "", 0},
+	{"no match keeps the word",
+		"mkdir s7; cd s7; " TREE "\necho d/**/*.h\n", "d/**/*.h\n", "", 0},
+	{"cached tree follows new files",
+		"mkdir s8; cd s8; " TREE "\n"
+		"for i in 1 2; do touch d/e/f/n$i.c; echo d/**/n*.c; done\n",
+		"d/e/f/n1.c\nd/e/f/n1.c d/e/f/n2.c\n", "", 0},
+	{"cached tree follows removed directories",
+		"mkdir s9; cd s9; " TREE "\necho d/**/*.c; rm -r d/e; echo d/**\n",
+		"d/a.c d/e/b.c d/e/f/c.c\nd/ d/a.c\n", "", 0},
+	{"wide tree",
+		"mkdir s10; cd s10\nfor i in 1 2 3 4 5 6 7 8 9; do"
+		" mkdir -p t/$i/x; touch t/$i/x/f$i; done\necho t/**/f* | wc -w\n",
+		"9\n", "", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== GLOBSTAR TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
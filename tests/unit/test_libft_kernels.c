@@ -0,0 +1,108 @@
+#include "minishell.h"
+#include <sys/mman.h>
+
+/*
+ * Fuzz the word-at-a-time libft kernels against glibc. Every string ends
+ * right before a PROT_NONE page, at every alignment, so a load that
+ * crosses into the next page crashes the test instead of passing.
+ *
+ * usage: tests/bin/unit/test_libft_kernels [iterations]
+ */
+
+#define GUARD_PAGE 4096
+#define MAX_LEN 300
+
+static char	*g_page;
+static int	g_failures;
+
+static void	check(int ok, const char *name, size_t len, size_t align)
+{
+	if (ok)
+		return ;
+	if (g_failures++ < 20)
+		printf("FAIL %s len=%zu align=%zu\n", name, len, align);
+}
+
+/* a random string of len bytes ending at the guard page, plus its NUL */
+static char	*place(size_t len, int terminate)
+{
+	char	*s;
+	size_t	i;
+
+	s = g_page + GUARD_PAGE - len - (terminate != 0);
+	for (i = 0; i < len; i++)
+		s[i] = "ab$\"' \t\x80\xff"[rand() % 9];
+	if (terminate)
+		s[len] = '\0';
+	return (s);
+}
+
+static void	check_strings(size_t len)
+{
+	char	*s;
+	char	copy[MAX_LEN + 1];
+	int		c;
+
+	s = place(len, 1);
+	c = "ab$\x80\xff"[rand() % 5];
+	if (rand() % 8 == 0)
+		c = 0;
+	check(ft_strlen(s) == strlen(s), "ft_strlen", len, len % 8);
+	check(ft_strchr(s, c) == strchr(s, c), "ft_strchr", len, len % 8);
+	memcpy(copy, s, len + 1);
+	if (len && rand() % 2)
+		copy[rand() % len] ^= (char)(1 + rand() % 255);
+	check((ft_strcmp(s, copy) > 0) == (strcmp(s, copy) > 0)
+		&& (ft_strcmp(s, copy) < 0) == (strcmp(s, copy) < 0),
+		"ft_strcmp", len, len % 8);
+	check((ft_strcmp(copy, s) > 0) == (strcmp(copy, s) > 0)
+		&& (ft_strcmp(copy, s) < 0) == (strcmp(copy, s) < 0),
+		"ft_strcmp", len, len % 8);
+}
+
+static void	check_memory(size_t len)
+{
+	char	*s;
+	char	a[MAX_LEN + 16];
+	char	b[MAX_LEN + 16];
+	size_t	off;
+	int		c;
+
+	s = place(len, 0);
+	c = "ab$\x80\xff"[rand() % 5];
+	check(ft_memchr(s, c, len) == memchr(s, c, len), "ft_memchr", len,
+		len % 8);
+	off = rand() % 8;
+	memset(a, 'x', sizeof(a));
+	memcpy(b, a, sizeof(b));
+	ft_memcpy(a + off, s, len);
+	memcpy(b + off, s, len);
+	check(memcmp(a, b, sizeof(a)) == 0, "ft_memcpy", len, off);
+	ft_memset(a + off, c, len);
+	memset(b + off, c, len);
+	check(memcmp(a, b, sizeof(a)) == 0, "ft_memset", len, off);
+}
+
+int	main(int argc, char **argv)
+{
+	long	iterations;
+	long	i;
+
+	iterations = 200000;
+	if (argc > 1)
+		iterations = atol(argv[1]);
+	g_page = mmap(NULL, 2 * GUARD_PAGE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (g_page == MAP_FAILED || mprotect(g_page + GUARD_PAGE, GUARD_PAGE, PROT_NONE))
+		return (1);
+	srand(42);
+	for (i = 0; i < iterations; i++)
+	{
+		check_strings(rand() % MAX_LEN);
+		check_memory(rand() % MAX_LEN);
+	}
+	printf("libft kernels: %ld iterations, %d failures\n", iterations,
+		g_failures);
+	munmap(g_page, 2 * GUARD_PAGE);
+	return (g_failures != 0);
+}
@@ -0,0 +1,64 @@
+#include "shell_run.h"
+
+/* break / continue counts and here-documents inside loop bodies */
+
+#define LOOP_ONLY ": only meaningful in a `for', `while', or `until' loop\n"
+
+static const t_case	g_cases[] = {
+	{"for over words", "for i in a b c; do echo $i; done\n",
+		"a\nb\nc\n", "", 0},
+	{"while and until",
+		"while false; do echo no; done; until true; do echo no; done\n"
+		"echo $?\n", "0\n", "", 0},
+	{"break leaves the innermost loop",
+		"for i in 1 2; do for j in a b; do echo $i$j; break; done; done\n",
+		"1a\n2a\n", "", 0},
+	{"break 2 leaves both loops",
+		"for i in 1 2; do for j in a b; do echo $i$j; break 2; done; done\n"
+		"echo after\n", "1a\nafter\n", "", 0},
+	{"break count capped to the loop depth",
+		"for i in 1 2 3; do echo $i; break 5; echo no; done\n",
+		"1\n", "", 0},
+	{"continue skips the rest of the body",
+		"for i in 1 2 3; do echo $i; continue; echo no; done\n",
+		"1\n2\n3\n", "", 0},
+	{"continue 2 resumes the outer loop",
+		"for i in 1 2; do\nfor j in a b; do\n"
+		"echo $i$j\ncontinue 2\necho no\ndone\necho never\n"
+		"done\n", "1a\n2a\n", "", 0},
+	{"break ends a while true",
+		"while true; do while true; do break 2; done; echo no; done\n"
+		"echo out\n", "out\n", "", 0},
+	{"break outside a loop",
+		"break\necho $?\ncontinue\necho $?\n", "0\n0\n",
+		"[mini$HELL]: break" LOOP_ONLY "[mini$HELL]: continue" LOOP_ONLY,
+		0},
+	{"break 0 is out of range and leaves the loops",
+		"for i in 1 2; do for j in a b; do break 0; echo $j; done; done\n"
+		"echo $?\n", "1\n",
+		"[mini$HELL]: break: 0: loop count out of range\n", 0},
+	{"continue 0 leaves the loops too",
+		"for i in 1 2; do continue 0; echo $i; done\necho $?\n", "1\n",
+		"[mini$HELL]: continue: 0: loop count out of range\n", 0},
+	{"non-numeric break count",
+		"for i in 1 2; do break x; echo $i; done\necho $?\n", "1\n",
+		"[mini$HELL]: break: x: numeric argument required\n", 0},
+	{"here-document in a multi-line loop body",
+		"while true; do\ncat <<EOF\nbody\nEOF\nbreak\ndone\necho end\n",
+		"body\nend\n", "", 0},
+	{"here-document in every iteration",
+		"for i in 1 2; do\ncat <<A; cat <<B\none\nA\ntwo\nB\ndone\n",
+		"one\ntwo\none\ntwo\n", "", 0},
+	{"loop status is the last body status",
+		"for i in 1; do false; done\necho $?\n", "1\n", "", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== LOOP TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
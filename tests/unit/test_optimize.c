@@ -0,0 +1,110 @@
+#include "shell_run.h"
+
+/*
+ * The optimizer must not change what a command line does: each script
+ * runs once as is and once with MINISHELL_NO_OPTIMIZE set, each in a
+ * fresh directory holding the same files, and stdout, stderr and the
+ * exit status must be identical.
+ */
+
+#define SETUP "printf 'a\\nb\\nc\\n' > f; printf 'x\\n' > other; mkdir dir\n"
+
+static const char	*g_scripts[][2] = {
+	{"cat f | cmd", "cat f | wc -l\ncat f | cat\n"},
+	{"cat -- f | cmd", "cat -- f | wc -l\n"},
+	{"cat of a missing file", "cat missing | wc -l\necho $?\n"},
+	{"cat of a directory", "cat dir | wc -l\necho $?\n"},
+	{"cmd with its own <", "cat f | wc -l < other\ncat f | cat < other\n"},
+	{"cat f | cmd with redirections",
+		"cat f | wc -l > count 2> err\ncat count err\n"},
+	{"right side exits early", "seq 1 100000 > big\ncat big | head -2\n"},
+	{"right side fails", "cat f | nosuchcmd\necho $?\n"},
+	{"cat function", "cat() { echo fn; }\ncat f | wc -l\n"},
+	{"cat f | cmd in a loop", "for i in 1 2; do cat f | tail -1; done\n"},
+	{"cat f | cmd in a function", "g() { cat f | wc -c; }\ng\ng\n"},
+	{"longer pipeline", "cat f | cat | wc -l\ncat f | sort -r | cat f\n"},
+	{"cat f as the last command", "echo x | cat f\n"},
+	{"bare > f", "> new\nls new\ncat new | wc -c\n"},
+	{"bare < missing", "< missing\necho $?\n"},
+	{"bare < f", "< f\necho $?\n"},
+	{"bare redirections to a bad path", "> dir/no/such\necho $?\n"},
+	{"bare redirections keep the shell fds",
+		"> o1 2> o2\necho out\ncd /nope\nls o1 o2\n"},
+	{"bare redirection in a pipeline", "> p1 | echo x\nls p1\n"},
+	{"bare redirection in a loop",
+		"for i in 1 2; do > l$i; done\nls l1 l2\n"},
+	{"bare here-document", "<< E\nbody\nE\necho $?\n"},
+};
+
+/* script run in its own directory, optionally without the optimizer */
+static char	*wrap(const char *script, size_t idx, int plain)
+{
+	char	*full;
+	size_t	len;
+
+	len = strlen(script) + sizeof(SETUP) + 128;
+	full = malloc(len);
+	if (!full)
+		return (NULL);
+	snprintf(full, len, "%smkdir t%zu_%d; cd t%zu_%d\n" SETUP "%s",
+		plain ? "export " OPT_DISABLE_VAR "=1\n" : "", idx, plain, idx,
+		plain, script);
+	return (full);
+}
+
+static void	compare(size_t idx)
+{
+	char	*script[2];
+	char	*out[2];
+	char	*err[2];
+	int		status[2];
+	int		i;
+
+	for (i = 0; i < 2; i++)
+	{
+		out[i] = NULL;
+		err[i] = NULL;
+		script[i] = wrap(g_scripts[idx][1], idx, i);
+		status[i] = -1;
+		if (script[i])
+			status[i] = run_script(script[i], &out[i], &err[i]);
+	}
+	if (!run_result(g_scripts[idx][0], status[0] >= 0
+			&& status[0] == status[1] && out[0] && out[1] && err[0] && err[1]
+			&& !strcmp(out[0], out[1]) && !strcmp(err[0], err[1])))
+		printf(RED "    optimized: [%s] [%s] %d\n    plain: [%s] [%s] %d"
+			RESET "\n", out[0], err[0], status[0], out[1], err[1], status[1]);
+	for (i = 0; i < 2; i++)
+	{
+		free(script[i]);
+		free(out[i]);
+		free(err[i]);
+	}
+}
+
+/* the rewrites must actually happen, or the comparisons prove nothing */
+static void	check_rewrites(void)
+{
+	static const t_case	report = {"optimizer report",
+		"mkdir r1; cd r1\n" SETUP "export " OPT_DEBUG_VAR "=1\n"
+		"cat f | wc -l\n> f\n", "3\n",
+		"[mini$HELL]: optimize: reading f directly instead of through cat\n"
+		"[mini$HELL]: optimize: redirections only, run in the shell\n", 0};
+	static const t_case	off = {"optimizer turned off",
+		"mkdir r2; cd r2\n" SETUP "export " OPT_DEBUG_VAR "=1 "
+		OPT_DISABLE_VAR "=1\ncat f | wc -l\n> f\n", "3\n", "", 0};
+
+	run_case(&report);
+	run_case(&off);
+}
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== OPTIMIZER TESTS ===" RESET "\n\n");
+	check_rewrites();
+	for (i = 0; i < sizeof(g_scripts) / sizeof(g_scripts[0]); i++)
+		compare(i);
+	return (run_summary());
+}
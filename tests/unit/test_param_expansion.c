@@ -0,0 +1,83 @@
+#include "shell_run.h"
+
+/*
+ * ${...} operators: length, defaults, pattern removal and replacement,
+ * substrings, and `:?`, which abandons the rest of the input line.
+ */
+
+#define VARS "export P=/usr/local/lib/libfoo.so.1 E= S='a b  c'\n"
+
+static const t_case	g_cases[] = {
+	{"value and length", VARS "echo \"${P}\" ${#P} ${#E} ${#U}\n",
+		"/usr/local/lib/libfoo.so.1 26 0 0\n", "", 0},
+	{"- and :-", VARS "echo \"[${U:-def}] [${E:-def}] [${E-def}] [${P:-d}]\"\n",
+		"[def] [def] [] [/usr/local/lib/libfoo.so.1]\n", "", 0},
+	{"+ and :+", VARS "echo \"[${U:+alt}] [${E:+alt}] [${E+alt}]\"\n",
+		"[] [] [alt]\n", "", 0},
+	{"= and :=", VARS "echo \"[${N:=set}] [$N]\"; echo \"[${E=x}]"
+		" [${E:=y}] [$E]\"\n", "[set] [set]\n[] [y] [y]\n", "", 0},
+	{"assigning a special parameter", "echo ${1:=x}; echo $?\n", "1\n",
+		"[mini$HELL]: $1: cannot assign in this way\n", 0},
+	{"the word is expanded only when used",
+		VARS "echo \"${U:-$P}\" \"${U:-\"x y\"}\" \"${U:-a$(echo b)c}\"\n"
+		"echo ${P:-$(echo never > ran)}; ls ran\n",
+		"/usr/local/lib/libfoo.so.1 x y abc\n/usr/local/lib/libfoo.so.1\n",
+		"ls: cannot access 'ran': No such file or directory\n", 2},
+	{"prefix and suffix removal",
+		VARS "echo \"${P#*/}\" \"${P##*/}\" \"${P%.*}\" \"${P%%.*}\"\n",
+		"usr/local/lib/libfoo.so.1 libfoo.so.1 /usr/local/lib/libfoo.so"
+		" /usr/local/lib/libfoo\n", "", 0},
+	{"removal without a match", VARS "echo \"${P#nomatch}\" \"${P%/}\"\n",
+		"/usr/local/lib/libfoo.so.1 /usr/local/lib/libfoo.so.1\n", "", 0},
+	{"bracket and quoted patterns",
+		VARS "echo \"${P##*[./]}\" \"${P#\"/usr\"}\" \"${P#'*'}\"\n",
+		"1 /local/lib/libfoo.so.1 /usr/local/lib/libfoo.so.1\n", "", 0},
+	{"replacement",
+		VARS "echo \"${P/lib/LIB}\" \"${P//lib/LIB}\" \"${P/#?usr/X}\""
+		" \"${P/%1/2}\" \"${P/lib}\" \"${S// /_}\"\n",
+		"/usr/local/LIB/libfoo.so.1 /usr/local/LIB/LIBfoo.so.1 X/local/lib/"
+		"libfoo.so.1 /usr/local/lib/libfoo.so.2 /usr/local//libfoo.so.1"
+		" a_b__c\n", "", 0},
+	{"escaped slash in the pattern",
+		"export v=ab/cd w=a/b/c\necho \"${v/\\//X}\" \"${w//\\//-}\""
+		" \"${v/b\\//B}\" \"${v/\\*/S}\"\n", "abXcd a-b-c aBcd ab/cd\n", "", 0},
+	{"substrings",
+		VARS "echo \"${P:5}\" \"${P:5:5}\" \"${P: -4}\" \"${P: -4:2}\""
+		" \"${P:100}\" \"[${P:0:0}]\"\n",
+		"local/lib/libfoo.so.1 local so.1 so  []\n", "", 0},
+	{"substring arithmetic",
+		VARS "echo \"${P:(-1)}\" \"${P:1+1:2}\" \"${P:2:-3}\"\n",
+		"1 sr sr/local/lib/libfoo.s\n", "", 0},
+	{"negative substring length", VARS "echo \"${P:5:-30}\"; echo $?\n",
+		"1\n", "[mini$HELL]: -30: substring expression < 0\n", 0},
+	{":? with a set value", VARS "echo \"${P:?}\" ok\n",
+		"/usr/local/lib/libfoo.so.1 ok\n", "", 0},
+	{":? aborts the rest of the line",
+		"echo \"${U:?not set}\"; echo after\necho next $?\n", "next 1\n",
+		"[mini$HELL]: U: not set\n", 0},
+	{"default messages", VARS "echo ${E:?}\necho ${U?}\necho $?\n", "1\n",
+		"[mini$HELL]: E: parameter null or not set\n"
+		"[mini$HELL]: U: parameter null or not set\n", 0},
+	{"? accepts an empty value", VARS "echo \"[${E?}]\"\n", "[]\n", "", 0},
+	{":? leaves functions and loops",
+		"f() { echo \"${1:?need arg}\"; echo inside; }; f; echo $?\n"
+		"for i in 1 2; do echo ${U:?x}; echo loop $i; done; echo end\n"
+		"f ok; echo $?\n", "ok\ninside\n0\n",
+		"[mini$HELL]: 1: need arg\n[mini$HELL]: U: x\n", 0},
+	{":? in a pipeline fails that side only",
+		"echo ${U:?x} | cat; echo after $?\n", "after 0\n",
+		"[mini$HELL]: U: x\n", 0},
+	{":? in a command substitution fails it only",
+		"echo \"[$(echo ${U:?y}; echo b)]\"; echo \"[$(echo ${U:?z})]\" $?\n",
+		"[]\n[] 1\n", "[mini$HELL]: U: y\n[mini$HELL]: U: z\n", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== PARAMETER EXPANSION TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
@@ -0,0 +1,98 @@
+#include "shell_run.h"
+
+/*
+ * MINISHELL_PIPE_SIZE: apply_pipe_size() on a fresh pipe for valid,
+ * oversized and invalid values, then pipelines whose writer only finishes
+ * before the reader starts when the pipe holds its whole output.
+ */
+
+#define WRITER "{ head -c 200000 /dev/zero; touch w; } | "
+#define READER "{ sleep 0.5; ls w; cat > /dev/null; }\n"
+
+static const t_case	g_cases[] = {
+	{"a large pipe lets the writer finish",
+		"mkdir a; cd a; export " PIPE_SIZE_VAR "=262144; " WRITER READER,
+		"w\n", "", 0},
+	{"the default pipe blocks the writer", "mkdir b; cd b; " WRITER READER,
+		"", "ls: cannot access 'w': No such file or directory\n", 0},
+	{"an invalid size keeps the default",
+		"mkdir c; cd c; export " PIPE_SIZE_VAR "=256k; " WRITER READER, "",
+		"ls: cannot access 'w': No such file or directory\n", 0},
+};
+
+/* the capacity of a new pipe after apply_pipe_size() with value */
+static long	sized_pipe(t_shell *data, const char *value)
+{
+	int		fd[2];
+	long	size;
+
+	if (value)
+		set_env_value(&data->env_list, PIPE_SIZE_VAR, value);
+	else
+		remove_env_node(&data->env_list, PIPE_SIZE_VAR);
+	if (pipe(fd) == -1)
+		return (-1);
+	apply_pipe_size(fd[1], data);
+	size = fcntl(fd[0], F_GETPIPE_SZ);
+	close(fd[0]);
+	close(fd[1]);
+	return (size);
+}
+
+static void	check_size(t_shell *data, const char *value, long want)
+{
+	long	got;
+	char	name[64];
+
+	got = sized_pipe(data, value);
+	snprintf(name, sizeof(name), "%s=%s", PIPE_SIZE_VAR,
+		value ? value : "(unset)");
+	if (!run_result(name, got == want))
+		printf(RED "    expected %ld got %ld" RESET "\n", want, got);
+}
+
+/* the system limit, or -1 when it cannot be read */
+static long	pipe_max(void)
+{
+	FILE	*f;
+	long	max;
+
+	f = fopen(PIPE_MAX_SIZE_PATH, "r");
+	if (!f)
+		return (-1);
+	if (fscanf(f, "%ld", &max) != 1)
+		max = -1;
+	fclose(f);
+	return (max);
+}
+
+int	main(void)
+{
+	t_shell	data;
+	long	def;
+	long	max;
+	char	big[32];
+	size_t	i;
+
+	printf(MAG "=== PIPE SIZE TESTS ===" RESET "\n\n");
+	if (init_shell(&data, environ) != 0)
+		return (1);
+	def = sized_pipe(&data, NULL);
+	check_size(&data, "131072", 131072);
+	check_size(&data, " +262144 ", 262144);
+	check_size(&data, "100000", 131072);
+	max = pipe_max();
+	snprintf(big, sizeof(big), "%ld", max * 4);
+	if (max > 0)
+		check_size(&data, big, max);
+	check_size(&data, "99999999999999999999999", def);
+	check_size(&data, "-131072", def);
+	check_size(&data, "abc", def);
+	check_size(&data, "64k", def);
+	check_size(&data, "0", def);
+	check_size(&data, "", def);
+	cleanup_shell(&data);
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
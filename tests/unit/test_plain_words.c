@@ -0,0 +1,82 @@
+#include "shell_run.h"
+
+/*
+ * Words without '$' or quotes skip the expansion scan and are copied as
+ * is. Each word here must give the same result as the same word with an
+ * empty "" appended, which forces the full scan: directly through
+ * expand_word(), and as command words, globbing and empty words around.
+ */
+
+#define SETUP "touch ab ac a.b; printf '[%%s]' \"\" "
+
+static const char	*g_words[] = {"a", "a*", "*", "a?", "[ab]*", "a.*",
+	"*.b", "~", "~/x", "a~b", "-n", "a=b", "{a,b}", "a\\b", "a\\*", "%s",
+	"--", "/", "*/", "nomatch*", NULL};
+
+/* the word through the fast path, then the full expansion */
+static void	check_expand_word(t_shell *data, const char *word)
+{
+	char	*full;
+	char	*fast;
+	char	*slow;
+
+	full = malloc(strlen(word) + 3);
+	if (!full)
+		return ;
+	sprintf(full, "%s\"\"", word);
+	fast = expand_word(word, data);
+	slow = expand_word(full, data);
+	if (!run_result(word, fast && slow && !strcmp(fast, slow)))
+		printf(RED "    fast [%s] full [%s]" RESET "\n", fast, slow);
+	free(full);
+	free(fast);
+	free(slow);
+}
+
+/* the word as a command word, in a fresh directory, both ways */
+static void	check_command_word(const char *word, size_t idx)
+{
+	char	script[2][256];
+	char	*out[2];
+	char	*err[2];
+	int		status[2];
+	int		i;
+
+	for (i = 0; i < 2; i++)
+	{
+		snprintf(script[i], sizeof(script[i]), "mkdir w%zu_%d; cd w%zu_%d\n"
+			SETUP "%s%s \"\"; echo\n", idx, i, idx, i, word, i ? "\"\"" : "");
+		out[i] = NULL;
+		err[i] = NULL;
+		status[i] = run_script(script[i], &out[i], &err[i]);
+	}
+	if (!run_result(word, status[0] == status[1] && out[0] && out[1]
+			&& err[0] && err[1] && !strcmp(out[0], out[1])
+			&& !strcmp(err[0], err[1])))
+		printf(RED "    fast [%s] full [%s]" RESET "\n", out[0], out[1]);
+	for (i = 0; i < 2; i++)
+	{
+		free(out[i]);
+		free(err[i]);
+	}
+}
+
+int	main(void)
+{
+	static const t_case	empty = {"empty words next to plain words",
+		"printf '[%s]' '' a \"\" b '' ''; echo\n", "[][a][][b][][]\n", "",
+		0};
+	t_shell				data;
+	size_t				i;
+
+	printf(MAG "=== PLAIN WORD TESTS ===" RESET "\n\n");
+	if (init_shell(&data, environ) != 0)
+		return (1);
+	for (i = 0; g_words[i]; i++)
+		check_expand_word(&data, g_words[i]);
+	cleanup_shell(&data);
+	for (i = 0; g_words[i]; i++)
+		check_command_word(g_words[i], i);
+	run_case(&empty);
+	return (run_summary());
+}
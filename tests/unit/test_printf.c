@@ -0,0 +1,60 @@
+#include "shell_run.h"
+
+/* printf: conversions, flags, escapes, format reuse and errors */
+
+static const t_case	g_cases[] = {
+	{"format reused for extra arguments", "printf '%s|%s\\n' a b c\n",
+		"a|b\nc|\n", "", 0},
+	{"integers", "printf '%d %i\\n' 42 -7 0x1f 010\n", "42 -7\n31 8\n", "",
+		0},
+	{"width and precision", "printf '%5s|%-5s|%.2s|%.3d\\n' ab cd efgh 5\n",
+		"   ab|cd   |ef|005\n", "", 0},
+	{"flags", "printf '%05d|%-4d|%+d|% d\\n' 42 7 3 4\n",
+		"00042|7   |+3| 4\n", "", 0},
+	{"bases", "printf '%x %X %o %#x %#o\\n' 255 255 8 255 8\n",
+		"ff FF 10 0xff 010\n", "", 0},
+	{"unsigned, char and %%", "printf '%u %c %%\\n' 3 hello\n", "3 h %\n",
+		"", 0},
+	{"star width", "printf '%*d|%-*s|\\n' 4 5 3 x\n", "   5|x  |\n", "", 0},
+	{"character value", "printf '%d %d\\n' \"'A\" '\"a'\n", "65 97\n", "",
+		0},
+	{"escapes in the format", "printf 'x\\ty\\\\z\\101\\n'\n", "x\ty\\zA\n",
+		"", 0},
+	{"%b escapes", "printf '%b\\n' 'a\\tb' 'c\\0141'\n", "a\tb\nca\n", "",
+		0},
+	{"\\c in %b stops the output", "printf '%b|%s' 'a\\cb' x; echo\n",
+		"a\n", "", 0},
+	{"%q quoting", "printf '%q\\n' \"a b\" \"it's\" \"\"\n",
+		"a\\ b\nit\\'s\n''\n", "", 0},
+	{"missing arguments", "printf '%s|%d|\\n'\n", "|0|\n", "", 0},
+	{"no trailing newline", "printf 'no newline'; echo\n", "no newline\n",
+		"", 0},
+	{"--", "printf -- '%s\\n' dash\n", "dash\n", "", 0},
+	{"invalid number",
+		"printf '%d\\n' abc; echo $?\nprintf '%d\\n' 12abc; echo $?\n",
+		"0\n1\n12\n1\n", "[mini$HELL]: printf: abc: invalid number\n"
+		"[mini$HELL]: printf: 12abc: invalid number\n", 0},
+	{"out of range", "printf '%d\\n' 99999999999999999999\n",
+		"9223372036854775807\n", "[mini$HELL]: printf: warning: "
+		"99999999999999999999: Numerical result out of range\n", 0},
+	{"invalid conversion", "printf '%z\\n' 1; echo $?\n", "1\n",
+		"[mini$HELL]: printf: `\\': invalid format character\n", 0},
+	{"no format", "printf; echo $?\n", "2\n",
+		"[mini$HELL]: printf: usage: printf format [arguments]\n", 0},
+	{"buffered output keeps its order",
+		"printf 'a\\n'; /bin/echo b; printf 'c\\n' > o; printf 'd\\n'"
+		" >> o; cat o\n", "a\nb\nc\nd\n", "", 0},
+	{"many lines through a pipe",
+		"export i=0; while [ $i -lt 2000 ]; do export i=$((i + 1));"
+		" printf '%05d\\n' $i; done | tail -1\n", "02000\n", "", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== PRINTF TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
@@ -0,0 +1,66 @@
+#include "shell_run.h"
+
+/*
+ * read: options, field splitting, and where the input is left. A regular
+ * file is read a block at a time and the offset moved back to the end of
+ * the line; the script itself is read the same way.
+ */
+
+static const t_case	g_cases[] = {
+	{"backslashes without and with -r",
+		"printf 'a\\\\b c\\n' > in; read x < in; echo \"[$x]\"\n"
+		"read -r x < in; echo \"[$x]\"\n", "[ab c]\n[a\\b c]\n", "", 0},
+	{"-d delimiter", "printf 'one:two:three' > in; read -d : x < in;"
+		" echo \"[$x] $?\"\n", "[one] 0\n", "", 0},
+	{"-d '' reads to the end", "printf 'one:two' > in; read -d '' x < in;"
+		" echo \"[$x] $?\"\n", "[one:two] 1\n", "", 0},
+	{"-n count", "printf 'abcdef\\n' > in; read -n 3 x < in; echo \"[$x]\"\n"
+		"read -n 10 x < in; echo \"[$x]\"\n", "[abc]\n[abcdef]\n", "", 0},
+	{"-n stops at the offset it reached",
+		"printf 'abcdef\\n' > in; f() { read -n 2 x; cat; }; f < in\n",
+		"cdef\n", "", 0},
+	{"fields, the last one takes the rest",
+		"printf ' a  b  c d \\n' > in; read p q r < in; echo \"[$p][$q][$r]\"\n"
+		"read p < in; echo \"[$p]\"\n", "[a][b][c d]\n[a  b  c d]\n", "", 0},
+	{"REPLY keeps the blanks",
+		"printf ' a b \\n' > in; read < in; echo \"[$REPLY]\"\n", "[ a b ]\n",
+		"", 0},
+	{"file offset moved back to the end of the line",
+		"printf 'l1\\nl2\\nl3\\n' > in\n"
+		"f() { read a; read b; echo $a $b; cat; }; f < in\n", "l1 l2\nl3\n", "",
+		0},
+	{"unterminated last line",
+		"printf 'no newline' > in; read x < in; echo \"[$x] $?\"\n"
+		"read x < /dev/null; echo \"[$x] $?\"\n", "[no newline] 1\n[] 1\n", "",
+		0},
+	{"arithmetic sees the value read",
+		"export i=100\necho $((i))\nread i <<E\n42\nE\necho $((i + 1))\n",
+		"100\n43\n", "", 0},
+	{"pipe input", "printf 'a\\nb\\nc\\n' | while read l; do echo \"<$l>\";"
+		" done\n", "<a>\n<b>\n<c>\n", "", 0},
+	{"-t timeout", "sleep 1 | { read -t 0.1 x; echo $?; }\n", "142\n", "",
+		0},
+	{"-t with data ready", "echo hi | { read -t 1 x; echo \"$x $?\"; }\n",
+		"hi 0\n", "", 0},
+	{"bad arguments",
+		"read -n x y < /dev/null; echo $?\nread 1bad < /dev/null; echo $?\n",
+		"1\n1\n", "[mini$HELL]: read: x: invalid number\n"
+		"[mini$HELL]: read: `1bad': not a valid identifier\n", 0},
+	{"the next line of the script",
+		"read s\nscript line\necho \"[$s]\"\n", "[script line]\n", "", 0},
+	{"the rest of the script", "read s\nline\ncat\nrest one\nrest two\n",
+		"rest one\nrest two\n", "", 0},
+	{"the script after a here-document",
+		"cat << E\nbody\nE\nread s\nafter\necho \"[$s]\"\n", "body\n[after]\n",
+		"", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== READ TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
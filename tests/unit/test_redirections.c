@@ -0,0 +1,55 @@
+#include "shell_run.h"
+
+/*
+ * Redirections of commands run in the shell process: only the fds a
+ * redirection list touches are saved, and all of them must be restored
+ * afterwards, whatever happened.
+ */
+
+#define FD_COUNT "ls /proc/self/fd | wc -l\n"
+
+static const t_case	g_cases[] = {
+	{"stdout restored after a builtin", "echo a > o1; echo b\ncat o1\n",
+		"b\na\n", "", 0},
+	{"stdout and stderr restored", "pwd > o2 2>&1; echo still\n", "still\n",
+		"", 0},
+	{"stderr restored after a failing builtin",
+		"cd /nope 2> e1; cd /nope2\n", "",
+		"[mini$HELL]: cd: /nope2: No such file or directory\n", 1},
+	{"redirection applied in order", "echo x 3> o3 >&3; cat o3\n", "x\n",
+		"", 0},
+	{"dup of a later redirected fd", "echo y >&2 2>/dev/null\necho after\n",
+		"after\n", "y\n", 0},
+	{"input redirection restored",
+		"echo line > in1\nread a < in1; echo $a\necho next\n",
+		"line\nnext\n", "", 0},
+	{"input redirection restored after a function",
+		"echo line > in1\nf() { cat; }\nf < in1; echo next\n",
+		"line\nnext\n", "", 0},
+	{"failed redirection leaves the fds alone",
+		"echo x > /nonexistent/f; echo y\n", "y\n",
+		"/nonexistent/f: No such file or directory\n", 0},
+	{"closing a fd for one command", "echo x 5>&-; echo $?\n", "x\n0\n",
+		"", 0},
+	{"closing stdout for one command", "echo x >&-; echo back\n", "back\n",
+		NULL, 0},
+	{"function with a redirection",
+		"f() { echo fn; echo err >&2; }\nf > fo 2> fe; cat fo fe; echo vis\n",
+		"fn\nerr\nvis\n", "", 0},
+	{"loop with a redirection",
+		"for i in 1 2; do echo $i; done > lo; echo out; cat lo\n",
+		"out\n1\n2\n", "", 0},
+	{"no descriptor leaked",
+		FD_COUNT "echo a > l1 2> l2 3> l3; pwd < l1 > l2; cd /nope 2> l3\n"
+		"f() { echo x; }\nf > l1 4>&1\n" FD_COUNT, "4\n4\n", "", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== REDIRECTION TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
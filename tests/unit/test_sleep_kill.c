@@ -0,0 +1,71 @@
+#include "shell_run.h"
+
+/* sleep, kill, true, false and `:`: operands, options and errors */
+
+#define ELAPSED_MS "export a=$(date +%s%N); "
+#define SINCE_MS "; export b=$(date +%s%N); echo $(( (b - a) / 1000000 ))"
+#define VICTIM "sh -c 'echo $$ > pid; exec sleep 5' | { sleep 0.3; "
+
+static const t_case	g_cases[] = {
+	{"intervals", "sleep 0.1; echo $?; sleep .05 0.05; echo $?\n"
+		"sleep 0.01s 0m 0h 0d; echo $?; sleep 1.; echo $?\n"
+		"sleep -- 0.01; echo $?\n", "0\n0\n0\n0\n0\n", "", 0},
+	{"intervals are added",
+		ELAPSED_MS "sleep 0.2 0.1" SINCE_MS " > ms; [ $(cat ms) -ge 300 ];"
+		" echo $?\n", "0\n", "", 0},
+	{"unit suffix", ELAPSED_MS "sleep 0.002m" SINCE_MS " > ms;"
+		" [ $(cat ms) -ge 120 ]; echo $?\n", "0\n", "", 0},
+	{"missing operand", "sleep; echo $?\n", "1\n",
+		"[mini$HELL]: sleep: missing operand\n", 0},
+	{"invalid intervals",
+		"sleep abc; sleep 1x; sleep -1; sleep 0.5.5; sleep ''; echo $?\n",
+		"1\n", "[mini$HELL]: sleep: invalid time interval 'abc'\n"
+		"[mini$HELL]: sleep: invalid time interval '1x'\n"
+		"[mini$HELL]: sleep: invalid time interval '-1'\n"
+		"[mini$HELL]: sleep: invalid time interval '0.5.5'\n"
+		"[mini$HELL]: sleep: invalid time interval ''\n", 0},
+	{"a bad operand stops before waiting",
+		ELAPSED_MS "sleep 2 x 2>/dev/null" SINCE_MS " > ms;"
+		" [ $(cat ms) -lt 1000 ]; echo $?\n", "0\n", "", 0},
+	{"kill -l", "kill -l 9 15 SIGHUP 130\nkill -l | head -1\n",
+		"KILL\nTERM\n1\nINT\n"
+		" 1) SIGHUP\t 2) SIGINT\t 3) SIGQUIT\t 4) SIGILL\t 5) SIGTRAP\n", "",
+		0},
+	{"signal forms",
+		"kill -s TERM 999999; kill -9 999999; kill -SIGKILL 999999;"
+		" kill -n 9 999999; echo $?\n", "1\n",
+		"[mini$HELL]: kill: (999999) - No such process\n"
+		"[mini$HELL]: kill: (999999) - No such process\n"
+		"[mini$HELL]: kill: (999999) - No such process\n"
+		"[mini$HELL]: kill: (999999) - No such process\n", 0},
+	{"signal a process", VICTIM "kill $(cat pid); echo $?; }\n", "0\n", "",
+		0},
+	{"signal 0 tests the process",
+		VICTIM "kill -0 $(cat pid); echo $?; kill -s KILL $(cat pid); }\n",
+		"0\n", "", 0},
+	{"invalid signals", "kill -BOGUS 1; echo $?; kill -l 300; echo $?\n"
+		"kill -s; echo $?\n", "1\n1\n1\n",
+		"[mini$HELL]: kill: BOGUS: invalid signal specification\n"
+		"[mini$HELL]: kill: 300: invalid signal specification\n"
+		"[mini$HELL]: kill: -s: option requires an argument\n", 0},
+	{"invalid process", "kill abc; echo $?\n", "1\n",
+		"[mini$HELL]: kill: abc: arguments must be process or job IDs\n", 0},
+	{"job specifications name no job", "kill %1; echo $?\n", "1\n",
+		"[mini$HELL]: kill: %1: no such job\n", 0},
+	{"no operand", "kill; echo $?\n", "2\n",
+		"[mini$HELL]: kill: usage: kill [-s sig | -n num | -sig] pid | jobspec"
+		" ...\n", 0},
+	{"true, false and :",
+		"true; echo $?; false; echo $?; :; echo $?; true --help; echo $?\n"
+		": ignored $(echo args); echo $?\n", "0\n1\n0\n0\n0\n", "", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== SLEEP AND KILL TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
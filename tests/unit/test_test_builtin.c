@@ -0,0 +1,65 @@
+#include "shell_run.h"
+
+/* test and [: file, string and integer operators, ! ( ) -a -o, errors */
+
+#define T "t() { test \"$@\"; echo $?; }\n"
+#define FILES "mkdir -p tt; cd tt; touch f; mkdir -p d; ln -sf f l;" \
+	" printf x > nz\n"
+
+static const t_case	g_cases[] = {
+	{"file operators",
+		FILES T "t -e f; t -e nope; t -f f; t -f d; t -d d; t -d f\n",
+		"0\n1\n0\n1\n0\n1\n", "", 0},
+	{"size, link and permission operators",
+		FILES T "t -s nz; t -s f; t -L l; t -h f; t -r f; t -w f; t -x f;"
+		" t -x d\n", "0\n1\n0\n1\n0\n0\n1\n0\n", "", 0},
+	{"file comparisons",
+		FILES T "t f -ef f; t l -ef f; t f -ef nz; t nope -nt f; t f -ot nope\n",
+		"0\n0\n1\n1\n1\n", "", 0},
+	{"terminal", T "t -t 99\n", "1\n", "", 0},
+	{"string operators",
+		T "t -z \"\"; t -z a; t -n a; t -n \"\"; t a; t \"\"\n",
+		"0\n1\n0\n1\n0\n1\n", "", 0},
+	{"string comparisons",
+		T "t a = a; t a = b; t a != b; t a == a; t b \">\" a; t b \"<\" a\n",
+		"0\n1\n0\n0\n0\n1\n", "", 0},
+	{"integer comparisons",
+		T "t 1 -eq 1; t 2 -ne 2; t 1 -lt 2; t 2 -le 2; t 3 -gt 2; t 3 -ge 4;"
+		" t -1 -lt 0; t \" 12 \" -eq 12\n", "0\n1\n0\n0\n0\n1\n0\n0\n", "", 0},
+	{"negation", T "t ! a; t ! \"\"; t ! ! a\n", "1\n0\n0\n", "", 0},
+	{"-a and -o",
+		T "t a -a b; t a -a \"\"; t \"\" -o b; t \"\" -o \"\"\n",
+		"0\n1\n0\n1\n", "", 0},
+	{"parentheses",
+		T "t \"(\" a = a \")\"; t ! \"(\" a = b \")\"; t \"(\" a \")\";"
+		" t a -a \"(\" \"\" -o b \")\"\n", "0\n0\n0\n0\n", "", 0},
+	{"one argument is a string test",
+		T "t -n; t -z; t -e; t =; t \"(\"\n", "0\n0\n0\n0\n0\n", "", 0},
+	{"two arguments with a unary operator",
+		T "t -n =; t ! =\n", "0\n1\n", "", 0},
+	{"[ needs its ]",
+		"[ a = a ]; echo $?\n[ ]; echo $?\n[ a = a; echo $?\n", "0\n1\n2\n",
+		"[mini$HELL]: [: missing `]'\n", 0},
+	{"no arguments", "test; echo $?\n", "1\n", "", 0},
+	{"integer expected",
+		T "t x -eq 1; t 99999999999999999999 -gt 1\n", "2\n2\n",
+		"[mini$HELL]: test: x: integer expression expected\n"
+		"[mini$HELL]: test: 99999999999999999999: integer expression expected\n",
+		0},
+	{"unary operator expected", T "t 1 -eq; t = =; t \"(\" \")\"\n",
+		"2\n2\n2\n", "[mini$HELL]: test: 1: unary operator expected\n"
+		"[mini$HELL]: test: =: unary operator expected\n"
+		"[mini$HELL]: test: (: unary operator expected\n", 0},
+	{"too many arguments", T "t a b c d e\n", "2\n",
+		"[mini$HELL]: test: too many arguments\n", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== TEST BUILTIN TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}
@@ -0,0 +1,46 @@
+#include "shell_run.h"
+
+/*
+ * Builtin output is buffered per fd: a failed write must still be
+ * reported once, with status 1, and buffering must not reorder stdout
+ * and stderr.
+ */
+
+#define NOSPACE ": write error: No space left on device\n"
+
+static const t_case	g_cases[] = {
+	{"echo", "echo x > /dev/full\necho $?\n", "1\n",
+		"[mini$HELL]: echo" NOSPACE, 0},
+	{"pwd", "pwd > /dev/full\necho $?\n", "1\n",
+		"[mini$HELL]: pwd" NOSPACE, 0},
+	{"printf", "printf 'a\\n' > /dev/full\necho $?\n", "1\n",
+		"[mini$HELL]: printf" NOSPACE, 0},
+	{"env", "env > /dev/full\necho $?\n", "1\n",
+		"[mini$HELL]: env" NOSPACE, 0},
+	{"export", "export > /dev/full\necho $?\n", "1\n",
+		"[mini$HELL]: export" NOSPACE, 0},
+	{"the shell goes on", "echo x > /dev/full; echo after\n", "after\n",
+		"[mini$HELL]: echo" NOSPACE, 0},
+	{"stderr unavailable too", "echo x 2>/dev/full >/dev/full; echo $?\n",
+		"1\n", "", 0},
+	{"echo larger than the buffer",
+		"echo \"$(seq 1 20000)\" > copy\nseq 1 20000 | cmp - copy; echo $?\n",
+		"0\n", "", 0},
+	{"stdout and stderr keep their order",
+		"f() { echo a; cd /nope; echo b; pwd >&2; echo c; }\n"
+		"f 2>&1 | sed 's|/.*|path|'\n",
+		"a\n[mini$HELL]: cd: path\nb\npath\nc\n", "", 0},
+	{"loop output redirected once",
+		"for i in 1 2 3; do echo $i; done > lst; cat lst\n", "1\n2\n3\n",
+		"", 0},
+};
+
+int	main(void)
+{
+	size_t	i;
+
+	printf(MAG "=== WRITE ERROR TESTS ===" RESET "\n\n");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++)
+		run_case(&g_cases[i]);
+	return (run_summary());
+}